@@ -0,0 +1,135 @@
+#!/bin/python
+
+# Running run_output_concurrent_test.py does the following:
+
+# - Runs Enzo-E with output-concurrent.in, which writes the same
+#   adaptive mesh with the "output" method sequentially (Dir_seq_*)
+#   and with concurrent = true (Dir_conc_*)
+# - Checks that each sequential file has a concurrent counterpart with
+#   the same block groups, attributes, and datasets, and that the
+#   block_list files list the same blocks (concurrent mode writes
+#   blocks in arrival order, so only the order may differ)
+# - Deletes the output directories
+
+# run_output_concurrent_test.py takes the following argument:
+
+# - "--launch_cmd" which is the command used to run Enzo-E.
+
+#   To run Enzo-E as a serial program, set --launch_cmd to /path/to/bin/enzo-e
+#   To run Enzo-E as a parallel program, set --launch_cmd to
+#   "/path/to/bin/charmrun +p 4 ++local /path/to/bin/enzo-e"
+
+import argparse
+import glob
+import os
+import shutil
+import subprocess
+import sys
+
+import h5py
+import numpy as np
+
+def run_test(executable):
+
+    param_file = 'input/Output/output-concurrent.in'
+    command = executable + ' ' + param_file
+    subprocess.call(command,shell = True)
+
+def compare_attrs(name, attrs_seq, attrs_conc):
+    if sorted(attrs_seq.keys()) != sorted(attrs_conc.keys()):
+        print("MISMATCH attribute names in " + name)
+        return False
+    passed = True
+    for key in attrs_seq.keys():
+        if not np.array_equal(attrs_seq[key], attrs_conc[key]):
+            print("MISMATCH attribute " + key + " in " + name)
+            passed = False
+    return passed
+
+def compare_files(file_seq, file_conc):
+
+    passed = True
+    with h5py.File(file_seq,'r') as f_seq, h5py.File(file_conc,'r') as f_conc:
+
+        passed = compare_attrs(file_seq, f_seq.attrs, f_conc.attrs)
+
+        if sorted(f_seq.keys()) != sorted(f_conc.keys()):
+            print("MISMATCH block groups in " + file_seq)
+            return False
+
+        for block in f_seq.keys():
+            group_seq = f_seq[block]
+            group_conc = f_conc[block]
+            name = file_seq + ":" + block
+            passed = compare_attrs(name, group_seq.attrs,
+                                   group_conc.attrs) and passed
+            if sorted(group_seq.keys()) != sorted(group_conc.keys()):
+                print("MISMATCH datasets in " + name)
+                passed = False
+                continue
+            for dataset in group_seq.keys():
+                if not np.array_equal(group_seq[dataset][()],
+                                      group_conc[dataset][()]):
+                    print("MISMATCH dataset " + dataset + " in " + name)
+                    passed = False
+    return passed
+
+def compare_block_lists(list_seq, list_conc):
+    with open(list_seq) as f_seq, open(list_conc) as f_conc:
+        lines_seq = f_seq.read().split()
+        lines_conc = f_conc.read().split()
+    if sorted(lines_seq) != sorted(lines_conc):
+        print("MISMATCH blocks in " + list_seq)
+        return False
+    return True
+
+def analyze_test():
+
+    dir_list = sorted(glob.glob("Dir_seq_*"))
+    if len(dir_list) == 0:
+        print("No output directories found")
+        return False
+
+    passed = True
+    for dir_seq in dir_list:
+        dir_conc = dir_seq.replace("Dir_seq_","Dir_conc_")
+        file_list = sorted(glob.glob(os.path.join(dir_seq,"*.h5")))
+        if len(file_list) == 0:
+            print("No output files found in " + dir_seq)
+            passed = False
+        for file_seq in file_list:
+            file_conc = os.path.join(dir_conc,os.path.basename(file_seq))
+            if not os.path.isfile(file_conc):
+                print("Missing concurrent output file " + file_conc)
+                passed = False
+                continue
+            passed = compare_files(file_seq,file_conc) and passed
+            passed = compare_block_lists(file_seq + ".block_list",
+                                         file_conc + ".block_list") and passed
+        print("Compared {} files in {} and {}".format
+              (len(file_list),dir_seq,dir_conc))
+    return passed
+
+def cleanup():
+    for dir_name in glob.glob("Dir_seq_*") + glob.glob("Dir_conc_*"):
+        if os.path.isdir(dir_name):
+            shutil.rmtree(dir_name)
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--launch_cmd', required=True,type=str)
+    args = parser.parse_args()
+
+    if not os.path.isdir('input'):
+        raise RuntimeError('./input must refer to the Enzo-E input directory')
+
+    run_test(args.launch_cmd)
+
+    tests_passed = analyze_test()
+
+    cleanup()
+
+    if tests_passed:
+        sys.exit(0)
+    else:
+        sys.exit(3)
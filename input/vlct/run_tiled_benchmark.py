@@ -0,0 +1,74 @@
+#!/bin/python
+
+# Compares the throughput of the full-block and tiled execution modes of the
+# VL integrator
+# - This script expects to be called from the root level of the repository
+#   OR at the same level where its defined
+#
+# Specifically, this script:
+#   1.) Runs the same problem (a 3D sound wave with 16 passive scalars) with
+#       Method:mhd_vlct:tile_depth = 0 and 4, and reports the wall-clock time
+#       and cell-updates per second of each run
+#   2.) Checks that both modes produce the same result (the L1 norm of the
+#       difference between the final outputs should vanish)
+
+import argparse
+import os.path
+import shutil
+import sys
+import time
+
+from testing_utils import EnzoEWrapper, CalcSimL1Norm, testing_context
+
+modes = ["full", "tiled"]
+dir_template = "method_vlct-tiled_benchmark-{:s}"
+
+# 128^3 cells evolved for 20 cycles
+num_cell_updates = 128**3 * 20
+
+calc_l1_norm = CalcSimL1Norm(["density","velocity_x","velocity_y","velocity_z",
+                              "total_energy","color_00","color_15"])
+
+def run_benchmark(executable):
+    temp = 'input/vlct/tiled_benchmark/method_vlct_{}.in'
+    call_test = EnzoEWrapper(executable,temp)
+
+    elapsed = {}
+    for mode in modes:
+        t_start = time.time()
+        call_test(mode)
+        elapsed[mode] = time.time() - t_start
+        print("{:>6s}: {:8.3f} s  {:.3e} cell-updates/s".format
+              (mode, elapsed[mode], num_cell_updates/elapsed[mode]))
+    print("speedup of tiled mode: {:.3f}".format
+          (elapsed["full"]/elapsed["tiled"]))
+
+def analyze():
+    norm = calc_l1_norm(dir_template.format("full"),
+                        dir_template.format("tiled"))
+    if norm != 0.0:
+        print("L1 norm of difference between modes is {:s}".format
+              (repr(norm)))
+        return False
+    return True
+
+def cleanup():
+    for mode in modes:
+        dir_name = dir_template.format(mode)
+        if os.path.isdir(dir_name):
+            shutil.rmtree(dir_name)
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--launch_cmd', required=True,type=str)
+    args = parser.parse_args()
+
+    with testing_context():
+        run_benchmark(args.launch_cmd)
+        passed = analyze()
+        cleanup()
+
+    if passed:
+        sys.exit(0)
+    else:
+        sys.exit(3)
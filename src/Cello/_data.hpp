@@ -107,6 +107,7 @@ class FieldFace;
 
 #include "data_Data.hpp"
 
+#include "data_DataMsgPool.hpp"
 #include "data_DataMsg.hpp"
 
 #ifdef DEBUG_FIELD
@@ -72,6 +72,8 @@ namespace cello {
 #include "io_IoReader.hpp"
 #include "io_IoWriter.hpp"
 
+#include "io_FileFilter.hpp"
+
 #include "io_Input.hpp"
 
 #include "io_Output.hpp"
@@ -22,6 +22,7 @@
 //----------------------------------------------------------------------
 
 #include "memory_Memory.hpp"
+#include "memory_ScratchArena.hpp"
 
 #endif /* _MEMORY_HPP */
 
@@ -12,6 +12,7 @@
 // System includes
 //----------------------------------------------------------------------
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <string>
@@ -30,6 +31,7 @@
 //----------------------------------------------------------------------
 
 #include "parallel.def"
+#include "parallel_ParallelFor.hpp"
 
 #endif /* _PARALLEL_HPP */
 
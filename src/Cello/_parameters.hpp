@@ -33,6 +33,7 @@ extern const char * parameter_type_name [];
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <algorithm>
 #include <map>
 #include <string>
 #include <vector>
@@ -44,6 +45,7 @@ extern const char * parameter_type_name [];
 
 #include "parse.h"
 #include "parameters_Config.hpp"
+#include "parameters_ParamCode.hpp"
 #include "parameters_Param.hpp"
 #include "parameters_ParamNode.hpp"
 #include "parameters_Parameters.hpp"
@@ -22,4 +22,5 @@
 #include "charm_MsgInitial.hpp"
 #include "charm_MsgOutput.hpp"
 #include "charm_MsgRefine.hpp"
+#include "charm_MsgRefreshAggregate.hpp"
 #include "charm_MsgRefresh.hpp"
@@ -20,7 +20,11 @@ MsgRefresh::MsgRefresh()
       is_local_(true),
       id_refresh_(-1),
       data_msg_(nullptr),
-      buffer_(nullptr)
+      buffer_(nullptr),
+      msg_aggregate_(nullptr),
+      buffer_aggregate_(nullptr),
+      size_aggregate_(0),
+      is_pooled_(false)
 {
   ++counter[cello::index_static()];
 }
@@ -30,10 +34,12 @@ MsgRefresh::MsgRefresh()
 MsgRefresh::~MsgRefresh()
 {
   --counter[cello::index_static()];
-  delete data_msg_;
+  DataMsgPool::instance()->delete_data_msg(data_msg_);
   data_msg_ = nullptr;
   CkFreeMsg (buffer_);
   buffer_=nullptr;
+  if (msg_aggregate_) msg_aggregate_->release();
+  msg_aggregate_ = nullptr;
 }
 
 //----------------------------------------------------------------------
@@ -43,7 +49,7 @@ void MsgRefresh::set_data_msg  (DataMsg * data_msg)
   if (data_msg_) {
     WARNING ("MsgRefresh::set_data_msg()",
 	     "overwriting existing data_msg_");
-    delete data_msg_;
+    DataMsgPool::instance()->delete_data_msg(data_msg_);
   }
   data_msg_ = data_msg;
 }
@@ -54,17 +60,26 @@ void * MsgRefresh::pack (MsgRefresh * msg)
 {
   if (msg->buffer_ != nullptr) return msg->buffer_;
 
-  int size = 0;
+  if (msg->msg_aggregate_ != nullptr) {
 
-  size += sizeof(int); // id_refresh
-  size += sizeof(int);  // have_data
-  int have_data = (msg->data_msg_ != nullptr);
+    // message was created by unpack_aggregate() and is being forwarded
+    // to a Block that migrated: copy its bytes from the aggregate
 
-  if (have_data) {
-    // data_msg_
-    size += msg->data_msg_->data_size();
+    const int size = msg->size_aggregate_;
+    char * buffer = (char *) CkAllocBuffer (msg,size);
+    memcpy (buffer,msg->buffer_aggregate_,size);
+
+    DataMsgPool::instance()->delete_msg_refresh(msg);
+
+    return (void *) buffer;
   }
 
+  //--------------------------------------------------
+  //  1. determine buffer size
+  //--------------------------------------------------
+
+  const int size = msg->data_size();
+
   //--------------------------------------------------
   //  2. allocate buffer using CkAllocBuffer()
   //--------------------------------------------------
@@ -75,22 +90,9 @@ void * MsgRefresh::pack (MsgRefresh * msg)
   //  3. serialize message data into buffer 
   //--------------------------------------------------
 
-  union {
-    char * pc;
-    int  * pi;
-  };
-
-  pc = buffer;
-
-  (*pi++) = msg->id_refresh_;
-
-  have_data = (msg->data_msg_ != nullptr);
-  (*pi++) = have_data;
-  if (have_data) {
-    pc = msg->data_msg_->save_data(pc);
-  }
+  char * pc = msg->save_data(buffer);
 
-  delete msg;
+  DataMsgPool::instance()->delete_msg_refresh(msg);
 
   // Return the buffer
 
@@ -119,28 +121,103 @@ MsgRefresh * MsgRefresh::unpack(void * buffer)
   // 2. De-serialize message data from input buffer into the allocated
   // message (must be consistent with pack())
 
+  msg->load_data((char *) buffer);
+
+  // 3. Save the input buffer for freeing later
+
+  msg->buffer_ = buffer;
+
+  return msg;
+}
+
+//----------------------------------------------------------------------
+
+MsgRefresh * MsgRefresh::unpack_aggregate
+(MsgRefreshAggregate * msg_aggregate, char * buffer, int size)
+{
+  MsgRefresh * msg = new MsgRefresh;
+
+  msg->is_local_ = false;
+
+  char * pc = msg->load_data(buffer);
+
+  ASSERT2("MsgRefresh::unpack_aggregate()",
+	  "buffer size mismatch %ld unpacked %d expected",
+	  (pc - buffer),size,
+	  (pc - buffer) == size);
+
+  // keep the aggregated message until this message is deleted
+
+  msg->msg_aggregate_    = msg_aggregate;
+  msg->buffer_aggregate_ = buffer;
+  msg->size_aggregate_   = size;
+  ++msg_aggregate->num_pending;
+
+  return msg;
+}
+
+//----------------------------------------------------------------------
+
+int MsgRefresh::data_size () const
+{
+  int size = 0;
+
+  size += sizeof(int); // id_refresh
+  size += sizeof(int);  // have_data
+
+  if (data_msg_ != nullptr) {
+    size += data_msg_->data_size();
+  }
+
+  return size;
+}
+
+//----------------------------------------------------------------------
+
+char * MsgRefresh::save_data (char * buffer) const
+{
   union {
     char * pc;
     int  * pi;
   };
 
-  pc = (char *) buffer;
+  pc = buffer;
 
-  msg->id_refresh_ = (*pi++) ;
+  (*pi++) = id_refresh_;
 
-  int have_data = (*pi++);
+  const int have_data = (data_msg_ != nullptr);
+  (*pi++) = have_data;
   if (have_data) {
-    msg->data_msg_ = new DataMsg;
-    pc = msg->data_msg_->load_data(pc);
-  } else {
-    msg->data_msg_ = nullptr;
+    pc = data_msg_->save_data(pc);
   }
 
-  // 3. Save the input buffer for freeing later
+  return pc;
+}
 
-  msg->buffer_ = buffer;
+//----------------------------------------------------------------------
 
-  return msg;
+char * MsgRefresh::load_data (char * buffer)
+{
+  union {
+    char * pc;
+    int  * pi;
+  };
+
+  pc = buffer;
+
+  id_refresh_ = (*pi++) ;
+
+  int have_data = (*pi++);
+  if (have_data) {
+    // recycle unpacked objects across refresh messages
+    const bool use_pool = true;
+    data_msg_ = DataMsgPool::instance()->new_data_msg();
+    pc = data_msg_->load_data(pc,use_pool);
+  } else {
+    data_msg_ = nullptr;
+  }
+
+  return pc;
 }
 
 //----------------------------------------------------------------------
@@ -172,4 +249,5 @@ void MsgRefresh::print (const char * message, FILE * fp_in)
   fprintf (fp,"%s MSG_REFRESH is_local_ %d\n",message,is_local_?1:0);
   fprintf (fp,"%s MSG_REFRESH id_refresh_ %d\n",message,id_refresh_);
   fprintf (fp,"%s MSG_REFRESH buffer_ %p\n",message,buffer_);
+  fprintf (fp,"%s MSG_REFRESH msg_aggregate_ %p\n",message,(void*)msg_aggregate_);
 }
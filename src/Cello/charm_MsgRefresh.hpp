@@ -12,11 +12,14 @@
 
 class Data;
 class DataMsg;
+class MsgRefreshAggregate;
 
 class MsgRefresh : public CMessage_MsgRefresh {
 
 public: // interface
 
+  friend class DataMsgPool;
+
   static long counter[CONFIG_NODE_SIZE];
 
   MsgRefresh() ;
@@ -49,7 +52,18 @@ public: // interface
   void update (Data * data);
 
   void print(const char * message, FILE * fp=nullptr);
-  
+
+  /// Return the number of bytes required to serialize the message
+  int data_size () const;
+
+  /// Serialize the message into the provided empty memory buffer.
+  /// Returns the next open position in the buffer
+  char * save_data (char * buffer) const;
+
+  /// Restore the message from the provided initialized memory buffer.
+  /// Returns the next open position in the buffer
+  char * load_data (char * buffer);
+
 public: // static methods
 
   /// Pack data to serialize
@@ -57,6 +71,13 @@ public: // static methods
 
   /// Unpack data to de-serialize
   static MsgRefresh * unpack(void *);
+
+  /// Create a message from one serialized message of size bytes
+  /// within the aggregated message's buffer.  The message references
+  /// the buffer in place, and releases the aggregated message when
+  /// deleted
+  static MsgRefresh * unpack_aggregate
+  (MsgRefreshAggregate * msg_aggregate, char * buffer, int size);
   
 protected: // attributes
 
@@ -71,6 +92,15 @@ protected: // attributes
   /// Saved Charm++ buffer for deleting after unpack()
   void * buffer_;
 
+  /// Aggregated message referenced by unpack_aggregate(), and the
+  /// location and size of this message's data in its buffer
+  MsgRefreshAggregate * msg_aggregate_;
+  char * buffer_aggregate_;
+  int size_aggregate_;
+
+  /// Whether the message was created by the DataMsgPool
+  bool is_pooled_;
+
 };
 
 #endif /* CHARM_MSG_HPP */
@@ -0,0 +1,49 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     charm_MsgRefreshAggregate.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    [\ref Charm] Declaration of the MsgRefreshAggregate Charm++ Message
+
+#ifndef CHARM_MSG_REFRESH_AGGREGATE_HPP
+#define CHARM_MSG_REFRESH_AGGREGATE_HPP
+
+class MsgRefreshAggregate : public CMessage_MsgRefreshAggregate {
+
+  /// @class    MsgRefreshAggregate
+  /// @ingroup  Charm
+  /// @brief    [\ref Charm] Field faces from all Blocks on one process
+  /// sent to Blocks on another process in a single message.  The
+  /// buffer holds the face count followed by [ index | size | MsgRefresh
+  /// data ] for each face.  MsgRefresh messages unpacked from the
+  /// buffer reference it in place, and the message is deleted when the
+  /// last of them is released.
+
+public: // interface
+
+  MsgRefreshAggregate()
+    : CMessage_MsgRefreshAggregate(),
+      n(0),
+      num_pending(0)
+  { }
+
+  /// Release one MsgRefresh referencing the buffer, deleting the
+  /// message after the last one
+  void release()
+  {
+    if (--num_pending == 0) delete this;
+  }
+
+public: // attributes
+
+  /// Buffer length in bytes
+  int n;
+
+  /// Buffer data
+  char * buffer;
+
+  /// Number of MsgRefresh messages still referencing the buffer
+  int num_pending;
+};
+
+#endif /* CHARM_MSG_REFRESH_AGGREGATE_HPP */
@@ -15,7 +15,7 @@
 void Matrix::residual (int ir, int ib, int ix, Block * block, int g0) throw()
 {
 
-  matvec(ir,ix,block);
+  matvec(ir,ix,block,g0);
 
   Field field = block->data()->field();
 
@@ -42,6 +42,92 @@ void Matrix::residual (int ir, int ib, int ix, Block * block, int g0) throw()
 
 //----------------------------------------------------------------------
 
+void Matrix::matvec_dot (int iy, int ix, int n, const int * iw,
+			 long double * dot,
+			 Block * block, int g0) throw()
+{
+  // Default implementation: separate passes for the product and the
+  // dot products.  Subclasses may override with a fused kernel
+
+  matvec(iy,ix,block,g0);
+
+  for (int k=0; k<n; k++) dot[k] = 0.0;
+
+  dot_(iy,n,iw,dot,block);
+}
+
+//----------------------------------------------------------------------
+
+long double Matrix::residual_norm (int ir, int ib, int ix,
+				   Block * block, int g0) throw()
+{
+  residual(ir,ib,ix,block,g0);
+
+  long double rr = 0.0;
+
+  dot_(ir,1,&ir,&rr,block);
+
+  return rr;
+}
+
+//----------------------------------------------------------------------
+
+void Matrix::dot_ (int iy, int n, const int * iw, long double * dot,
+		   Block * block) const throw()
+{
+  Field field = block->data()->field();
+
+  int mx,my,mz;
+  int gx,gy,gz;
+  field.dimensions (iy,&mx,&my,&mz);
+  field.ghost_depth(iy,&gx,&gy,&gz);
+
+  std::vector<void *> w(n);
+  for (int k=0; k<n; k++) w[k] = field.values(iw[k]);
+
+  void * y = field.values(iy);
+
+  int precision = field.precision(iy);
+
+  if      (precision == precision_single)
+    dot_((const float *)(y), n, (const float * const *)(w.data()), dot,
+	 mx,my,mz,gx,gy,gz);
+  else if (precision == precision_double)
+    dot_((const double *)(y), n, (const double * const *)(w.data()), dot,
+	 mx,my,mz,gx,gy,gz);
+  else if (precision == precision_quadruple)
+    dot_((const long double *)(y), n,
+	 (const long double * const *)(w.data()), dot,
+	 mx,my,mz,gx,gy,gz);
+  else
+    ERROR1("Matrix::dot_()", "precision %d not recognized", precision);
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void Matrix::dot_ (const T * y, int n, const T * const * w,
+		   long double * dot,
+		   int mx, int my, int mz,
+		   int gx, int gy, int gz) const throw()
+{
+  for (int k=0; k<n; k++) {
+    const T * wk = w[k];
+    long double sum = 0.0;
+    for (int iz=gz; iz<mz-gz; iz++) {
+      for (int iy=gy; iy<my-gy; iy++) {
+	for (int ix=gx; ix<mx-gx; ix++) {
+	  const int i=ix + mx*(iy + my*iz);
+	  sum += y[i]*wk[i];
+	}
+      }
+    }
+    dot[k] += sum;
+  }
+}
+
+//----------------------------------------------------------------------
+
 template <class T>
 void Matrix::residual_ (T * r, T * b,
 			int mx, int my, int mz,
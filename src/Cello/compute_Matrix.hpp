@@ -38,6 +38,18 @@ public: // interface
   /// Compute residual R <-- B - A*X
   void residual (int ir, int ib, int ix, Block * block, int g0=1) throw();
   
+  /// Apply the matrix Y <-- A*X and compute the dot products dot[k]
+  /// = Y*W[k] of Y with the n fields iw[k] over the Block's active
+  /// zones.  iw[k] may be iy, giving the norm Y*Y
+  virtual void matvec_dot (int iy, int ix, int n, const int * iw,
+			   long double * dot,
+			   Block * block, int g0=1) throw();
+
+  /// Compute residual R <-- B - A*X and return the norm R*R over the
+  /// Block's active zones
+  virtual long double residual_norm (int ir, int ib, int ix,
+				     Block * block, int g0=1) throw();
+
 
 public: // virtual functions
 
@@ -63,6 +75,15 @@ protected: // functions
 		 int mx, int my, int mz,
 		 int ig0) throw();
 
+  /// Accumulate dot[k] += Y*W[k] over the Block's active zones
+  void dot_ (int iy, int n, const int * iw, long double * dot,
+	     Block * block) const throw();
+
+  template<class T>
+  void dot_ (const T * y, int n, const T * const * w, long double * dot,
+	     int mx, int my, int mz,
+	     int gx, int gy, int gz) const throw();
+
 };
 
 #endif /* COMPUTE_MATRIX_HPP */
@@ -233,8 +233,17 @@ void Block::adapt_end_()
   const int initial_cycle = cello::config()->initial_cycle;
   const bool is_first_cycle = (initial_cycle == cycle());
   const int level_maximum = cello::config()->mesh_max_level;
-
-  bool adapt_again = (is_first_cycle && (adapt_step_ < level_maximum));
+  const int max_steps = cello::config()->adapt_max_steps;
+
+  // Repeat the adapt step to refine multiple levels in one adapt
+  // phase: up to level_maximum times in the first cycle, and up to
+  // Adapt:max_steps times afterwards while the mesh is still changing.
+  // (Only the root Block's decision is used, and it has
+  // adapt_changed_ from the r_adapt_next() reduction)
+  ++adapt_phase_step_;
+  bool adapt_again =
+    (is_first_cycle && (adapt_step_ < level_maximum)) ||
+    (adapt_changed_ != 0 && adapt_phase_step_ < max_steps);
   adapt_step_++;
   adapt_ready_ = false;
   adapt_balanced_ = false;
@@ -265,7 +274,8 @@ bool Block::do_adapt_()
 /// Return if not a leaf; otherwise, apply all Refine refinement
 /// criteria to the Block, and set level_desired accordingly:
 /// level+1 if it needs to refine, level - 1 if it can coarsen,
-/// or level.
+/// or level.  Refining more than one level per adapt phase is done
+/// by repeating the adapt step (see adapt_end_()).
 ///
 /// @param[in]  level_maximum   Maximum level to refine
 ///
@@ -275,37 +285,131 @@ int Block::adapt_compute_desired_level_(int level_maximum)
   TRACE_ADAPT("adapt_compute_desired_level_",this);
   if (! is_leaf()) return adapt_same;
 
-  int adapt = adapt_unknown;
+  int adapt = adapt_apply_refine_();
 
   int level = this->level();
   int level_desired = level;
 
+  const int initial_cycle = cello::config()->initial_cycle;
+  const bool is_first_cycle = (initial_cycle == cycle());
+
+  // Blocks created (or coarsened) earlier in this adapt phase may not
+  // coarsen, so that later steps of a multi-step adapt phase
+  // (Adapt:max_steps > 1) do not undo refinement
+
+  if (adapt == adapt_coarsen && level > 0 && ! is_first_cycle &&
+      ! adapt_created_)
+    level_desired = level - 1;
+  else if (adapt == adapt_refine  && level < level_maximum)
+    level_desired = level + 1;
+  else {
+    adapt = adapt_same;
+    level_desired = level;
+  }
+
+  return level_desired;
+}
+
+//----------------------------------------------------------------------
+
+/// @brief Evaluate all refinement criteria scheduled for this cycle,
+/// returning the maximum of their results.
+///
+/// Criteria that support tiled evaluation (Refine::tile_begin()) are
+/// evaluated together one tile of rows at a time, so that fields read
+/// by more than one criterion are still in cache.  Each criterion
+/// stops once its own result is known, and once any criterion
+/// requires refinement only criteria with an output field continue.
+/// The remaining criteria are then evaluated with Refine::apply().
+/// Time in criterion i is accumulated in performance region
+/// num_perf_region + i.
+
+int Block::adapt_apply_refine_()
+{
+  // approximate number of cells per tile
+  const int cells_per_tile = 4096;
+
   Problem * problem = cello::problem();
-  Refine * refine;
 
+  std::vector<Refine *> tile_list;
+  std::vector<int>      tile_index;
+  std::vector<int>      tile_rows;
+  std::vector<Refine *> apply_list;
+  std::vector<int>      apply_index;
+
+  Refine * refine;
   int index_refine = 0;
-  while ((refine = problem->refine(index_refine++))) {
+  for (; (refine = problem->refine(index_refine)); index_refine++) {
 
     Schedule * schedule = refine->schedule();
 
     if ((schedule==NULL) || schedule->write_this_cycle(cycle(),time()) ) {
-      adapt = std::max(adapt,refine->apply(this));
+      const int index_region = num_perf_region + index_refine;
+      performance_start_(index_region);
+      const int num_rows = refine->tile_begin(this);
+      performance_stop_(index_region);
+      if (num_rows > 0) {
+        tile_list.push_back(refine);
+        tile_index.push_back(index_region);
+        tile_rows.push_back(num_rows);
+      } else {
+        apply_list.push_back(refine);
+        apply_index.push_back(index_region);
+      }
     }
+  }
+
+  int adapt = adapt_unknown;
 
+  // Evaluate tiled criteria in a single sweep over the Block
+
+  if (tile_list.size() > 0) {
+
+    int nx,ny,nz;
+    data()->field_data()->size(&nx,&ny,&nz);
+    const int num_rows_max =
+      *std::max_element(tile_rows.begin(),tile_rows.end());
+    const int num_tiles = std::max
+      (1,std::min(num_rows_max, (nx*ny*nz) / cells_per_tile));
+
+    bool is_refine = false;
+    bool is_done = false;
+    for (int it=0; it<num_tiles && ! is_done; it++) {
+      is_done = true;
+      for (size_t k=0; k<tile_list.size(); k++) {
+        refine = tile_list[k];
+        const bool is_needed = ! (refine->tile_decided() ||
+                                  (is_refine && ! refine->has_output()));
+        if (is_needed) {
+          const long long num_rows = tile_rows[k];
+          const int ir_begin = (num_rows*it)     / num_tiles;
+          const int ir_end   = (num_rows*(it+1)) / num_tiles;
+          performance_start_(tile_index[k]);
+          refine->tile_apply(ir_begin,ir_end);
+          performance_stop_(tile_index[k]);
+          is_refine = is_refine || refine->tile_refine();
+          is_done = false;
+        }
+      }
+    }
+
+    for (size_t k=0; k<tile_list.size(); k++) {
+      adapt = std::max(adapt,tile_list[k]->tile_end());
+    }
   }
-  const int initial_cycle = cello::config()->initial_cycle;
-  const bool is_first_cycle = (initial_cycle == cycle());
 
-  if (adapt == adapt_coarsen && level > 0 && ! is_first_cycle)
-    level_desired = level - 1;
-  else if (adapt == adapt_refine  && level < level_maximum)
-    level_desired = level + 1;
-  else {
-    adapt = adapt_same;
-    level_desired = level;
+  // Evaluate remaining criteria
+
+  for (size_t k=0; k<apply_list.size(); k++) {
+    refine = apply_list[k];
+    if (adapt != adapt_refine || refine->has_output()) {
+      performance_start_(apply_index[k]);
+      adapt = std::max(adapt,refine->apply(this));
+      performance_stop_(apply_index[k]);
+    }
   }
 
-  return level_desired;
+  return adapt;
 }
 
 //----------------------------------------------------------------------
@@ -461,13 +565,17 @@ void Block::particle_scatter_children_ (ParticleData * particle_list[],
     const bool is_float =
       (cello::type_is_float(particle.attribute_type(it,ia_x)));
 
-    // (...stride may be != 1 if particle attributes are interleaved)
-    const int d  = particle.stride(it,ia_x);
-
     // ...for each batch of particles
 
     const int nb = particle.num_batches(it);
 
+    // ...position and index arrays are reused for all batches
+    const int mb = particle.batch_size();
+    std::vector<double> xa(mb);
+    std::vector<double> ya(mb);
+    std::vector<double> za(mb);
+    std::vector<int> index(mb);
+
     for (int ib=0; ib<nb; ib++) {
 
       const int np = particle.num_particles(it,ib);
@@ -475,25 +583,19 @@ void Block::particle_scatter_children_ (ParticleData * particle_list[],
       // ...all particles will be moved
       const bool * mask = nullptr;
 
-      // ...extract particle position arrays
-      std::vector<double> xa(np);
-      std::vector<double> ya(np);
-      std::vector<double> za(np);
-
+      // ...extract particle position arrays (contiguous regardless of
+      // whether attributes are interleaved)
       particle.position(it,ib,xa.data(),ya.data(),za.data());
 
-      // ...and corresponding particle indices
-      std::vector<int> index(np);
-
       if (is_float) {
 
 	// absolute coordinates
 
 	for (int ip=0; ip<np; ip++) {
 
-	  const double x = xa[ip*d];
-	  const double y = ya[ip*d];
-	  const double z = za[ip*d];
+	  const double x = xa[ip];
+	  const double y = ya[ip];
+	  const double z = za[ip];
 
 	  const int rank = cello::rank();
 	  int ix = (rank >= 1) ? ( (x < x0) ? 0 : 1) : 0;
@@ -512,8 +614,6 @@ void Block::particle_scatter_children_ (ParticleData * particle_list[],
       particle.scatter (it,ib, np, mask, index.data(), npa, particle_list);
       // ... delete scattered particles
       count += particle.delete_particles (it,ib,mask);
-
-      delete [] mask;
     }
   }
   cello::simulation()->data_delete_particles(count);
@@ -987,6 +1087,7 @@ void Block::p_adapt_recv_child (MsgCoarsen * msg)
   adapt_delete_child_(index_child);
 
   age_ = 0;
+  adapt_created_ = true;
 
   delete msg;
 
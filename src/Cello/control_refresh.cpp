@@ -139,7 +139,7 @@ void Block::refresh_wait (int id_refresh, int callback)
     // unpack message data into Block data
     msg->update(data());
 
-    delete msg;
+    DataMsgPool::instance()->delete_msg_refresh(msg);
     sync->advance();
   }
 
@@ -208,7 +208,7 @@ void Block::p_refresh_recv (MsgRefresh * msg_refresh)
     // unpack message data into Block data if ready
     msg_refresh->update(data());
 
-    delete msg_refresh;
+    DataMsgPool::instance()->delete_msg_refresh(msg_refresh);
 
     sync->advance();
 
@@ -247,6 +247,11 @@ int Block::refresh_load_field_faces_ (Refresh & refresh)
   const int min_face_rank = refresh.min_face_rank();
   const int neighbor_type = refresh.neighbor_type();
 
+  // Field faces for Blocks on remote processes are packed by process
+  // if the Refresh object requests aggregation
+
+  const bool aggregate = refresh.aggregate();
+
   if (neighbor_type == neighbor_leaf ||
       neighbor_type == neighbor_tree) {
 
@@ -280,12 +285,12 @@ int Block::refresh_load_field_faces_ (Refresh & refresh)
 
       if (pad == 0) {
         refresh_load_field_face_
-          (refresh,refresh_type,index_neighbor,if3,ic3);
+          (refresh,refresh_type,index_neighbor,if3,ic3,aggregate);
         ++count;
       } else {
         if (level_face == level) {
           refresh_load_field_face_
-            (refresh,refresh_type,index_neighbor,if3,ic3);
+            (refresh,refresh_type,index_neighbor,if3,ic3,aggregate);
           ++count;
         } else {
           count += refresh_load_coarse_face_
@@ -316,13 +321,15 @@ int Block::refresh_load_field_faces_ (Refresh & refresh)
       if ( ! is_leaf() || face_level(if3) >= level()) {
 	Index index_face = it_face.index();
 	int ic3[3] = {0,0,0};
-	refresh_load_field_face_ (refresh,refresh_same,index_face,if3,ic3);
+	refresh_load_field_face_
+          (refresh,refresh_same,index_face,if3,ic3,aggregate);
 	++count;
 
       }
 
     }
   }
+
   return count;
 }
 
@@ -330,22 +337,37 @@ int Block::refresh_load_field_faces_ (Refresh & refresh)
 
 void Block::refresh_load_field_face_
 ( Refresh & refresh,  int refresh_type,
-  Index index_neighbor,  int if3[3], int ic3[3])
+  Index index_neighbor,  int if3[3], int ic3[3],
+  bool aggregate)
 {
-  // create refresh message
-
-  MsgRefresh * msg_refresh = new MsgRefresh;
+  // messages and field faces are recycled through the pool
+  DataMsgPool * pool = DataMsgPool::instance();
 
   // create field face
   if (refresh_type == refresh_coarse) {
     index_.child(index_.level(),ic3,ic3+1,ic3+2);
   }
-  int g3[3] = {0,0,0};
-  FieldFace * field_face = create_face
-    (if3, ic3, g3, refresh_type, &refresh,false);
+  FieldFace * field_face = pool->new_field_face();
+  field_face -> set_refresh_type (refresh_type);
+  field_face -> set_child (ic3[0],ic3[1],ic3[2]);
+  field_face -> set_face (if3[0],if3[1],if3[2]);
+  field_face -> set_ghost(0,0,0);
+  field_face -> set_refresh_copy (refresh);
+
+  // copy directly into the neighbor's ghost zones if it's on this
+  // process and already waiting for this refresh
+
+  if (refresh_local_field_face_(refresh,index_neighbor,field_face)) {
+    pool->delete_field_face(field_face);
+    return;
+  }
+
+  // create refresh message
+
+  MsgRefresh * msg_refresh = pool->new_msg_refresh();
 
   // create data message
-  DataMsg * data_msg = new DataMsg;
+  DataMsg * data_msg = pool->new_data_msg();
   // initialize data message
   data_msg -> set_field_face (field_face,true);
   data_msg -> set_field_data (data()->field_data(),false);
@@ -354,8 +376,164 @@ void Block::refresh_load_field_face_
   msg_refresh->set_refresh_id (refresh.id());
   msg_refresh->set_data_msg (data_msg);
 
-  thisProxy[index_neighbor].p_refresh_recv (msg_refresh);
+  const int ip_neighbor = (! aggregate) ? CkMyPe() :
+    thisProxy.ckLocMgr()->lastKnown(CkArrayIndexIndex(index_neighbor));
+
+  if (ip_neighbor == CkMyPe()) {
+
+    thisProxy[index_neighbor].p_refresh_recv (msg_refresh);
+
+  } else {
+
+    cello::simulation()->refresh_aggregate_face
+      (ip_neighbor,index_neighbor,msg_refresh);
+
+  }
+}
+
+//----------------------------------------------------------------------
+
+bool Block::refresh_local_field_face_
+(Refresh & refresh, Index index_neighbor, FieldFace * field_face)
+{
+  Block * block_neighbor = thisProxy[index_neighbor].ckLocal();
+
+  if (block_neighbor == nullptr) return false;
+
+  Sync * sync_neighbor = block_neighbor->sync_(refresh.id());
+
+  // Only copy if the neighbor is ready to accept data, and leave the
+  // last face to the message path so the neighbor's completion is
+  // handled by refresh_check_done() in its own entry method
+
+  const bool is_ready = (sync_neighbor->state() == RefreshState::READY);
+  const bool is_last  = (sync_neighbor->value() + 1 >= sync_neighbor->stop());
+
+  if ( ! is_ready || is_last) return false;
+
+  Field field_src = data()->field();
+  Field field_dst = block_neighbor->data()->field();
+
+  field_face->face_to_face(field_src, field_dst);
+
+  sync_neighbor->advance();
+
+  cello::simulation()->performance()->increment_counter
+    (perf_index_refresh_msg_saved, 1);
+
+  return true;
+}
+
+//----------------------------------------------------------------------
+
+void Simulation::refresh_aggregate_face
+(int ip, Index index, MsgRefresh * msg_refresh)
+{
+  // append [ index | size | MsgRefresh data ] to the buffer for the
+  // destination process; the first int in the buffer is the face count
+
+  std::vector<char> & buffer = refresh_aggregate_[ip];
+  if (buffer.size() == 0) {
+    buffer.resize(sizeof(int),0);
+  }
+
+  const int size = msg_refresh->data_size();
+  const int offset = buffer.size();
+  buffer.resize(offset + index.data_size() + sizeof(int) + size);
 
+  char * pc = buffer.data() + offset;
+  pc = index.save_data(pc);
+  SAVE_SCALAR_TYPE(pc,int,size);
+  pc = msg_refresh->save_data(pc);
+
+  int count;
+  memcpy (&count, buffer.data(), sizeof(int));
+  ++count;
+  memcpy (buffer.data(), &count, sizeof(int));
+
+  DataMsgPool::instance()->delete_msg_refresh(msg_refresh);
+
+  // send once the other Blocks on this process have added their faces
+
+  if (! refresh_aggregate_flush_) {
+    refresh_aggregate_flush_ = true;
+    thisProxy[CkMyPe()].p_refresh_flush_aggregate();
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Simulation::p_refresh_flush_aggregate ()
+{
+  for (auto it = refresh_aggregate_.begin();
+       it != refresh_aggregate_.end(); ++it) {
+
+    const int ip = it->first;
+    std::vector<char> & buffer = it->second;
+
+    // buffers are kept between phases so their memory is reused
+    if (buffer.size() == 0) continue;
+
+    int count;
+    memcpy (&count, buffer.data(), sizeof(int));
+
+    // count messages and message envelope bytes not sent
+
+    performance_->increment_counter
+      (perf_index_refresh_msg_saved, count - 1);
+    performance_->increment_counter
+      (perf_index_refresh_bytes_saved, (count - 1)*sizeof(envelope));
+
+    const int n = buffer.size();
+    MsgRefreshAggregate * msg = new (n) MsgRefreshAggregate;
+    msg->n = n;
+    memcpy (msg->buffer, buffer.data(), n);
+
+    thisProxy[ip].p_refresh_recv_aggregate (msg);
+
+    buffer.clear();
+  }
+
+  refresh_aggregate_flush_ = false;
+}
+
+//----------------------------------------------------------------------
+
+void Simulation::p_refresh_recv_aggregate (MsgRefreshAggregate * msg)
+{
+  CProxy_Block proxy_block = cello::block_array();
+
+  char * buffer = msg->buffer;
+  char * pc = buffer;
+
+  int count;
+  LOAD_SCALAR_TYPE(pc,int,count);
+
+  // hold the aggregated message until all faces have been unpacked
+
+  ++msg->num_pending;
+
+  for (int i=0; i<count; i++) {
+
+    Index index;
+    pc = index.load_data(pc);
+    int size;
+    LOAD_SCALAR_TYPE(pc,int,size);
+
+    // unpack in place: the message references the aggregated buffer,
+    // which is deleted after the last face is processed
+
+    MsgRefresh * msg_refresh = MsgRefresh::unpack_aggregate(msg,pc,size);
+    pc += size;
+
+    proxy_block[index].p_refresh_recv (msg_refresh);
+  }
+
+  ASSERT2("Simulation::p_refresh_recv_aggregate()",
+	  "buffer size mismatch %ld unpacked %d received",
+	  (pc - buffer),msg->n, (pc - buffer) == msg->n);
+
+  msg->release();
 }
 
 //----------------------------------------------------------------------
@@ -1255,6 +1433,15 @@ void Block::particle_scatter_neighbors_
  Particle particle,
  const bool copy)
 {
+  // mask and index arrays are reused for all batches
+  const int mb = particle.batch_size();
+  std::vector<char> mask_array (mb);
+  std::vector<char> move_array (mb);
+  std::vector<int>  index_array (mb);
+  bool * mask = (bool *) mask_array.data();
+  bool * move = (bool *) move_array.data();
+  int * index = index_array.data();
+
   if (copy){
 
     // Loop over particle types
@@ -1285,18 +1472,13 @@ void Block::particle_scatter_neighbors_
 
         is_copy = (int64_t *) particle.attribute_array(it, ia_copy, ib);
 
-        // ...initialize mask used for copying
-        bool * mask = new bool[np];
-        // Index array not needed for copying
-        int * index = nullptr;
-
         // Loop over particles in this batch and fill in the mask
         for (int ip=0; ip<np; ip++) mask[ip] = !is_copy[ip*d_copy];
 
-        // ...scatter particles to particle array
-        particle.scatter  (it,ib,np,mask,index,npa,particle_array, copy);
+        // ...scatter particles to particle array (index array not
+        // needed for copying)
+        particle.scatter  (it,ib,np,mask,nullptr,npa,particle_array, copy);
 
-        delete [] mask;
       } // Loop over batches
     } // Loop over particle types
   } // if (copy)
@@ -1331,39 +1513,35 @@ void Block::particle_scatter_neighbors_
       const bool is_float =
 	(cello::type_is_float(particle.attribute_type(it,ia_x)));
 
-      // (...stride may be != 1 if particle attributes are interleaved)
-      const int d  = particle.stride(it,ia_x);
-
       // ...for each batch of particles
 
       const int nb = particle.num_batches(it);
 
+      // (...position arrays are reused for all batches)
+      std::vector<double> xa(mb,0.0);
+      std::vector<double> ya(mb,0.0);
+      std::vector<double> za(mb,0.0);
+
       for (int ib=0; ib<nb; ib++) {
 
 	const int np = particle.num_particles(it,ib);
 
 	if (np == 0) continue;
 
-	// ...extract particle position arrays
-
-	std::vector<double> xa(np,0.0);
-	std::vector<double> ya(np,0.0);
-	std::vector<double> za(np,0.0);
+	// ...extract particle position arrays (contiguous regardless
+	// of whether attributes are interleaved)
 
 	particle.position(it,ib,xa.data(),ya.data(),za.data());
 
 	// ...initialize mask used for scatter and delete
 	// ...and corresponding particle indices
 
-	bool * mask = new bool[np];
-	int * index = new int[np];
-
 	for (int ip=0; ip<np; ip++) {
 
 	  // look at block scatter children for help?
-	  double x = is_float ? 2.0*(xa[ip*d]-x0)/xl : xa[ip*d];
-	  double y = is_float ? 2.0*(ya[ip*d]-y0)/yl : ya[ip*d];
-	  double z = is_float ? 2.0*(za[ip*d]-z0)/zl : za[ip*d];
+	  double x = is_float ? 2.0*(xa[ip]-x0)/xl : xa[ip];
+	  double y = is_float ? 2.0*(ya[ip]-y0)/yl : ya[ip];
+	  double z = is_float ? 2.0*(za[ip]-z0)/zl : za[ip];
 
 	  int ix = (rank >= 1) ? (x + 2) : 0;
 	  int iy = (rank >= 2) ? (y + 2) : 0;
@@ -1375,7 +1553,7 @@ void Block::particle_scatter_neighbors_
 
 	    CkPrintf ("%d ix iy iz %d %d %d\n",CkMyPe(),ix,iy,iz);
 	    CkPrintf ("%d x y z %f %f %f\n",CkMyPe(),x,y,z);
-	    CkPrintf ("%d xa ya za %f %f %f\n",CkMyPe(),xa[ip*d],ya[ip*d],za[ip*d]);
+	    CkPrintf ("%d xa ya za %f %f %f\n",CkMyPe(),xa[ip],ya[ip],za[ip]);
 	    CkPrintf ("%d xm ym zm %f %f %f\n",CkMyPe(),xm,ym,zm);
 	    CkPrintf ("%d xp yp zp %f %f %f\n",CkMyPe(),xp,yp,zp);
 	    ERROR3 ("Block::particle_scatter_neighbors_",
@@ -1390,16 +1568,17 @@ void Block::particle_scatter_neighbors_
 	  in_block = in_block && (!(rank >= 2) || (1 <= iy && iy <= 2));
 	  in_block = in_block && (!(rank >= 3) || (1 <= iz && iz <= 2));
 	  mask[ip] = ! in_block;
+	  // ...particles leaving the domain through a non-periodic
+	  // boundary have no neighbor, and are deleted without moving
+	  move[ip] = mask[ip] && (particle_array[i] != nullptr);
 	}
 
 	// ...scatter particles to particle array
-	particle.scatter  (it,ib,np,mask,index,npa,particle_array, copy);
+	particle.scatter  (it,ib,np,move,index,npa,particle_array, copy);
 
 	// ... delete scattered particles if moved
 	count += particle.delete_particles (it,ib,mask);
 
-	delete [] mask;
-	delete [] index;
       } // Loop over batches
     } // Loop over particle types
 
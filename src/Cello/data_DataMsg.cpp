@@ -246,7 +246,7 @@ char * DataMsg::save_data (char * buffer) const
 
 //----------------------------------------------------------------------
 
-char * DataMsg::load_data (char * buffer)
+char * DataMsg::load_data (char * buffer, bool use_pool)
 {
   TRACE_DATA_MSG("load_data()");
   // 2. De-serialize message data from input buffer into the allocated
@@ -260,6 +260,9 @@ char * DataMsg::load_data (char * buffer)
 
   pc = buffer;
 
+  is_pooled_ = use_pool;
+  DataMsgPool * pool = DataMsgPool::instance();
+
   int n_ff,n_fa,n_pa,n_fd;
   LOAD_SCALAR_TYPE(pc,int,n_ff);
   LOAD_SCALAR_TYPE(pc,int,n_fa);
@@ -268,7 +271,8 @@ char * DataMsg::load_data (char * buffer)
 
   // load field face
   if (n_ff > 0) {
-    field_face_ = new FieldFace(cello::rank());
+    field_face_ = is_pooled_ ?
+      pool->new_field_face() : new FieldFace(cello::rank());
     pc = field_face_->load_data (pc);
   } else {
     field_face_ = nullptr;
@@ -285,7 +289,8 @@ char * DataMsg::load_data (char * buffer)
   // load particle data
   if (n_pa > 0) {
     particle_data_delete_ = true;
-    ParticleData * pd = particle_data_ = new ParticleData;
+    ParticleData * pd = particle_data_ = is_pooled_ ?
+      pool->new_particle_data() : new ParticleData;
     pd->allocate(cello::particle_descr());
     pc = pd->load_data(cello::particle_descr(),pc);
   } else {
@@ -298,7 +303,8 @@ char * DataMsg::load_data (char * buffer)
     for (int i=0; i<n_fd; i++) {
       face_fluxes_delete_[i] = (*pi++);
       face_fluxes_delete_[i] = true;
-      FaceFluxes * ff = new FaceFluxes;
+      FaceFluxes * ff = is_pooled_ ?
+        pool->new_face_fluxes() : new FaceFluxes;
       face_fluxes_list_[i] = ff;
       pc = ff->load_data(pc);
     }
@@ -375,8 +381,7 @@ void DataMsg::update (Data * data, bool is_local, bool is_kept)
   }
 
   if (ff != nullptr) {
-    delete field_face_;
-    field_face_ = nullptr;
+    delete_field_face_();
   }
 
   // Update fluxes
@@ -389,8 +394,7 @@ void DataMsg::update (Data * data, bool is_local, bool is_kept)
       flux_data->sum_neighbor_fluxes
         (face_fluxes,face.axis(), 1 - face.face(), i);
       if (face_fluxes_delete_[i]) {
-        delete face_fluxes;
-        face_fluxes_list_[i] = nullptr;
+        delete_face_fluxes_(i);
       }
     }
   }
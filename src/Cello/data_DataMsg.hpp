@@ -30,7 +30,8 @@ public: // interface
       face_fluxes_delete_(),
       coarse_field_buffer_(),
       coarse_field_list_src_(),
-      coarse_field_list_dst_()
+      coarse_field_list_dst_(),
+      is_pooled_(false)
   {
     for (int i=0; i<3; i++) {
       iam3_cf_[i]  =0;
@@ -48,22 +49,19 @@ public: // interface
     --counter[cello::index_static()];
     
     if (field_face_delete_) {
-      delete field_face_;
-      field_face_ = nullptr;
+      delete_field_face_();
     }
     if (field_data_delete_) {
       delete field_data_u_;
       field_data_u_ = nullptr;
     }
     if (particle_data_delete_) {
-      delete particle_data_;
-      particle_data_ = nullptr;
+      delete_particle_data();
     }
     
     for (size_t i=0; i<face_fluxes_list_.size(); i++) {
       if (face_fluxes_delete_[i]) {
-        delete face_fluxes_list_[i];
-        face_fluxes_list_[i] = nullptr;
+        delete_face_fluxes_(i);
       }
     }
     face_fluxes_list_.clear();
@@ -143,7 +141,11 @@ public: // interface
   /// Delete the ParticleData object
   void delete_particle_data  () 
   { 
-    delete particle_data_;
+    if (is_pooled_) {
+      DataMsgPool::instance()->delete_particle_data(particle_data_);
+    } else {
+      delete particle_data_;
+    }
     particle_data_ = nullptr; 
   }
 
@@ -203,8 +205,18 @@ public: // interface
 
   /// Restore the object from the provided initialized memory buffer data.
   /// Returns the next open position in the buffer to simplify
-  /// serializing multiple objects in one buffer.
-  char * load_data (char * buffer);
+  /// serializing multiple objects in one buffer.  If use_pool is
+  /// true, FieldFace, ParticleData, and FaceFluxes objects are taken
+  /// from and returned to the process's DataMsgPool.
+  char * load_data (char * buffer, bool use_pool = false);
+
+  /// Set whether owned objects are returned to the DataMsgPool
+  void set_pooled (bool is_pooled)
+  { is_pooled_ = is_pooled; }
+
+  /// Return whether owned objects are returned to the DataMsgPool
+  bool is_pooled () const
+  { return is_pooled_; }
 
   /// Update the Data with the data stored in this DataMsg. "is_local"
   /// is true if the data in the source and destination are on the
@@ -215,6 +227,30 @@ public: // interface
   /// Debugging
   void print (const char * message, FILE * fp = nullptr) const;
 
+protected: // functions
+
+  /// Delete the FieldFace object, or return it to the pool
+  void delete_field_face_ ()
+  {
+    if (is_pooled_) {
+      DataMsgPool::instance()->delete_field_face(field_face_);
+    } else {
+      delete field_face_;
+    }
+    field_face_ = nullptr;
+  }
+
+  /// Delete the ith FaceFluxes object, or return it to the pool
+  void delete_face_fluxes_ (int i)
+  {
+    if (is_pooled_) {
+      DataMsgPool::instance()->delete_face_fluxes(face_fluxes_list_[i]);
+    } else {
+      delete face_fluxes_list_[i];
+    }
+    face_fluxes_list_[i] = nullptr;
+  }
+
 protected: // attributes
 
   /// Field Face Data
@@ -262,6 +298,9 @@ protected: // attributes
   /// loop limits for the receiving field
   int ifmr3_cf_[3], ifpr3_cf_[3];
 
+  /// Whether unpacked objects belong to the DataMsgPool
+  bool is_pooled_;
+
 };
 
 #endif /* DATA_DATA_MSG_HPP */
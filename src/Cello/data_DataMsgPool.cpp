@@ -0,0 +1,228 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     data_DataMsgPool.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    [\ref Data] Implementation of the DataMsgPool class
+
+#include "data.hpp"
+
+DataMsgPool DataMsgPool::instance_[CONFIG_NODE_SIZE];
+
+//----------------------------------------------------------------------
+
+MsgRefresh * DataMsgPool::new_msg_refresh()
+{
+  if (msg_refresh_list_.size() > 0) {
+    MsgRefresh * msg_refresh = msg_refresh_list_.back();
+    msg_refresh_list_.pop_back();
+    count_(true);
+    return msg_refresh;
+  }
+  count_(false);
+  memory_begin_();
+  MsgRefresh * msg_refresh = new MsgRefresh;
+  memory_end_();
+  msg_refresh->is_pooled_ = true;
+  return msg_refresh;
+}
+
+//----------------------------------------------------------------------
+
+void DataMsgPool::delete_msg_refresh (MsgRefresh * msg_refresh)
+{
+  if (msg_refresh == nullptr) return;
+  if (msg_refresh->is_pooled_ &&
+      (int)msg_refresh_list_.size() < max_size_) {
+    // reinitialize in place; the destructor returns the DataMsg to
+    // the pool, and the Charm++ message memory is kept for reuse
+    msg_refresh->~MsgRefresh();
+    new ((void*)msg_refresh) MsgRefresh;
+    msg_refresh->is_pooled_ = true;
+    msg_refresh_list_.push_back(msg_refresh);
+  } else {
+    delete msg_refresh;
+  }
+}
+
+//----------------------------------------------------------------------
+
+DataMsg * DataMsgPool::new_data_msg()
+{
+  DataMsg * data_msg;
+  if (data_msg_list_.size() > 0) {
+    data_msg = data_msg_list_.back();
+    data_msg_list_.pop_back();
+    count_(true);
+    new ((void*)data_msg) DataMsg;
+  } else {
+    count_(false);
+    memory_begin_();
+    data_msg = new DataMsg;
+    memory_end_();
+  }
+  data_msg->set_pooled(true);
+  return data_msg;
+}
+
+//----------------------------------------------------------------------
+
+void DataMsgPool::delete_data_msg (DataMsg * data_msg)
+{
+  if (data_msg == nullptr) return;
+  if (data_msg->is_pooled() &&
+      (int)data_msg_list_.size() < max_size_) {
+    // destroy in place, returning owned objects to the pool, and keep
+    // the memory for the next new_data_msg()
+    data_msg->~DataMsg();
+    data_msg_list_.push_back(data_msg);
+  } else {
+    delete data_msg;
+  }
+}
+
+//----------------------------------------------------------------------
+
+FieldFace * DataMsgPool::new_field_face()
+{
+  if (field_face_list_.size() > 0) {
+    FieldFace * field_face = field_face_list_.back();
+    field_face_list_.pop_back();
+    count_(true);
+    return field_face;
+  }
+  count_(false);
+  memory_begin_();
+  FieldFace * field_face = new FieldFace(cello::rank());
+  memory_end_();
+  return field_face;
+}
+
+//----------------------------------------------------------------------
+
+void DataMsgPool::delete_field_face (FieldFace * field_face)
+{
+  if (field_face == nullptr) return;
+  if ((int)field_face_list_.size() < max_size_) {
+    field_face_list_.push_back(field_face);
+  } else {
+    delete field_face;
+  }
+}
+
+//----------------------------------------------------------------------
+
+ParticleData * DataMsgPool::new_particle_data()
+{
+  if (particle_data_list_.size() > 0) {
+    ParticleData * particle_data = particle_data_list_.back();
+    particle_data_list_.pop_back();
+    count_(true);
+    return particle_data;
+  }
+  count_(false);
+  memory_begin_();
+  ParticleData * particle_data = new ParticleData;
+  memory_end_();
+  return particle_data;
+}
+
+//----------------------------------------------------------------------
+
+void DataMsgPool::delete_particle_data (ParticleData * particle_data)
+{
+  if (particle_data == nullptr) return;
+  if ((int)particle_data_list_.size() < max_size_) {
+    particle_data_list_.push_back(particle_data);
+  } else {
+    delete particle_data;
+  }
+}
+
+//----------------------------------------------------------------------
+
+FaceFluxes * DataMsgPool::new_face_fluxes()
+{
+  if (face_fluxes_list_.size() > 0) {
+    FaceFluxes * face_fluxes = face_fluxes_list_.back();
+    face_fluxes_list_.pop_back();
+    count_(true);
+    return face_fluxes;
+  }
+  count_(false);
+  memory_begin_();
+  FaceFluxes * face_fluxes = new FaceFluxes;
+  memory_end_();
+  return face_fluxes;
+}
+
+//----------------------------------------------------------------------
+
+void DataMsgPool::delete_face_fluxes (FaceFluxes * face_fluxes)
+{
+  if (face_fluxes == nullptr) return;
+  if ((int)face_fluxes_list_.size() < max_size_) {
+    face_fluxes_list_.push_back(face_fluxes);
+  } else {
+    delete face_fluxes;
+  }
+}
+
+//----------------------------------------------------------------------
+
+void DataMsgPool::clear()
+{
+  for (size_t i=0; i<msg_refresh_list_.size(); i++)
+    delete msg_refresh_list_[i];
+  // cached DataMsg objects are already destroyed, so only free memory
+  for (size_t i=0; i<data_msg_list_.size(); i++)
+    ::operator delete ((void*)data_msg_list_[i]);
+  for (size_t i=0; i<field_face_list_.size(); i++)
+    delete field_face_list_[i];
+  for (size_t i=0; i<particle_data_list_.size(); i++)
+    delete particle_data_list_[i];
+  for (size_t i=0; i<face_fluxes_list_.size(); i++)
+    delete face_fluxes_list_[i];
+  msg_refresh_list_.clear();
+  data_msg_list_.clear();
+  field_face_list_.clear();
+  particle_data_list_.clear();
+  face_fluxes_list_.clear();
+}
+
+//----------------------------------------------------------------------
+
+void DataMsgPool::memory_begin_()
+{
+  Memory * memory = Memory::instance();
+  if (memory) {
+    memory_group_ = memory->group();
+    memory->set_group("pool");
+  }
+}
+
+//----------------------------------------------------------------------
+
+void DataMsgPool::memory_end_()
+{
+  Memory * memory = Memory::instance();
+  if (memory) {
+    memory->set_group(memory_group_);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void DataMsgPool::count_ (bool reused)
+{
+  if (reused) {
+    ++num_reused_;
+  } else {
+    ++num_created_;
+  }
+  Simulation * simulation = cello::simulation();
+  if (simulation) {
+    simulation->performance()->increment_counter
+      (reused ? perf_index_pool_reused : perf_index_pool_created, 1);
+  }
+}
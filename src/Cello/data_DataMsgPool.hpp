@@ -0,0 +1,150 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     data_DataMsgPool.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    [\ref Data] Declaration of the DataMsgPool class
+
+#ifndef DATA_DATA_MSG_POOL_HPP
+#define DATA_DATA_MSG_POOL_HPP
+
+class DataMsg;
+class FaceFluxes;
+class FieldFace;
+class MsgRefresh;
+class ParticleData;
+
+class DataMsgPool {
+
+  /// @class    DataMsgPool
+  /// @ingroup  Data
+  /// @brief [\ref Data] Per-process free lists of the MsgRefresh,
+  /// DataMsg, FieldFace, ParticleData, and FaceFluxes objects created
+  /// when sending field faces and when unpacking DataMsg data.
+  /// Recycled objects keep their internal arrays, so sending or
+  /// unpacking faces with the same geometry and field list does not
+  /// allocate.  Objects created by the pool are allocated in the
+  /// Memory group "pool", and reuse is reported in the "pool-reused"
+  /// and "pool-created" performance counters.
+
+public: // interface
+
+  /// Return the DataMsgPool object for this process
+  static DataMsgPool * instance()
+  { return & instance_[cello::index_static()]; }
+
+  /// Create an empty pool
+  DataMsgPool()
+    : msg_refresh_list_(),
+      data_msg_list_(),
+      field_face_list_(),
+      particle_data_list_(),
+      face_fluxes_list_(),
+      max_size_(256),
+      num_reused_(0),
+      num_created_(0)
+  { }
+
+  /// Cached objects are not deleted here, since the pool is a static
+  /// object destroyed after Charm++ exits; call clear() to free them
+  ~DataMsgPool()
+  { }
+
+  /// Return a MsgRefresh message, reusing a cached one if available
+  MsgRefresh * new_msg_refresh();
+
+  /// Return a MsgRefresh message and its DataMsg to the pool, or
+  /// delete it if it was not created by the pool
+  void delete_msg_refresh (MsgRefresh * msg_refresh);
+
+  /// Return a DataMsg object, reusing a cached one if available.
+  /// Objects it owns are returned to the pool when it is deleted
+  DataMsg * new_data_msg();
+
+  /// Return a DataMsg object to the pool, or delete it if it was not
+  /// created by the pool
+  void delete_data_msg (DataMsg * data_msg);
+
+  /// Return a FieldFace object, reusing a cached one if available
+  FieldFace * new_field_face();
+
+  /// Return a FieldFace object to the pool
+  void delete_field_face (FieldFace * field_face);
+
+  /// Return a ParticleData object, reusing a cached one if available
+  ParticleData * new_particle_data();
+
+  /// Return a ParticleData object to the pool
+  void delete_particle_data (ParticleData * particle_data);
+
+  /// Return a FaceFluxes object, reusing a cached one if available
+  FaceFluxes * new_face_fluxes();
+
+  /// Return a FaceFluxes object to the pool
+  void delete_face_fluxes (FaceFluxes * face_fluxes);
+
+  /// Delete all cached objects
+  void clear();
+
+  /// Set the maximum number of cached objects of each type
+  void set_max_size (int max_size)
+  { max_size_ = max_size; }
+
+  /// Return the maximum number of cached objects of each type
+  int max_size () const
+  { return max_size_; }
+
+  /// Return the number of new_*() calls satisfied by a cached object
+  long long num_reused () const
+  { return num_reused_; }
+
+  /// Return the number of new_*() calls that created a new object
+  long long num_created () const
+  { return num_created_; }
+
+  /// Return the number of objects currently cached
+  int num_cached () const
+  {
+    return (msg_refresh_list_.size() +
+            data_msg_list_.size() +
+            field_face_list_.size() +
+            particle_data_list_.size() +
+            face_fluxes_list_.size());
+  }
+
+private: // functions
+
+  /// Switch to the Memory group for pool allocations, saving the
+  /// current group
+  void memory_begin_();
+
+  /// Restore the Memory group saved by memory_begin_()
+  void memory_end_();
+
+  /// Count a new_*() call that reused or created an object
+  void count_ (bool reused);
+
+private: // attributes
+
+  /// Per-process pool objects
+  static DataMsgPool instance_[CONFIG_NODE_SIZE];
+
+  /// Cached objects available for reuse
+  std::vector<MsgRefresh *>   msg_refresh_list_;
+  std::vector<DataMsg *>      data_msg_list_;
+  std::vector<FieldFace *>    field_face_list_;
+  std::vector<ParticleData *> particle_data_list_;
+  std::vector<FaceFluxes *>   face_fluxes_list_;
+
+  /// Maximum number of cached objects of each type
+  int max_size_;
+
+  /// Statistics
+  long long num_reused_;
+  long long num_created_;
+
+  /// Memory group active before memory_begin_()
+  std::string memory_group_;
+};
+
+#endif /* DATA_DATA_MSG_POOL_HPP */
@@ -361,7 +361,10 @@ char * FaceFluxes::load_data (char * buffer)
   pc = (char *) buffer;
 
   pc = face_.load_data(pc);
-  
+
+  // keep previous array size to reuse fluxes_ if recycled by DataMsgPool
+  const int size_old = (fluxes_ && delete_fluxes_) ? get_size() : 0;
+
   LOAD_SCALAR_TYPE(pc,int,index_field_);
   LOAD_SCALAR_TYPE(pc,int,nx_);
   LOAD_SCALAR_TYPE(pc,int,ny_);
@@ -370,8 +373,11 @@ char * FaceFluxes::load_data (char * buffer)
   LOAD_SCALAR_TYPE(pc,int,cy_);
   LOAD_SCALAR_TYPE(pc,int,cz_);
   LOAD_SCALAR_TYPE(pc,int,delete_fluxes_);
+  if (size_old == 0 || size_old != get_size()) {
+    if (size_old > 0) delete [] fluxes_;
+    fluxes_ = new cello_float [get_size()];
+  }
   delete_fluxes_ = true;
-  fluxes_ = new cello_float [get_size()];
   LOAD_ARRAY_TYPE(pc,cello_float,fluxes_,get_size());
   ASSERT2("FaceFluxes::load_data()",
 	  "Buffer has size %ld but expecting size %d",
@@ -20,6 +20,63 @@
 
 //----------------------------------------------------------------------
 
+namespace {
+
+  /// Consecutive fields with the same array sizes and offsets, to be
+  /// prolonged together by Prolong::apply_fields()
+  struct ProlongBatch {
+
+    /// Add a field, first prolonging the current batch if the field's
+    /// arrays do not match it
+    void add (Prolong * prolong, precision_type precision,
+              void * values_f, int m3_f[3], int o3_f[3], int n3_f[3],
+              const void * values_c, int m3_c[3], int o3_c[3], int n3_c[3],
+              bool accumulate)
+    {
+      bool match = (values_f_.size() > 0) &&
+        (precision == precision_) && (accumulate == accumulate_);
+      for (int i=0; i<3; i++) {
+        match = match &&
+          m3_f[i] == m3_f_[i] && o3_f[i] == o3_f_[i] && n3_f[i] == n3_f_[i] &&
+          m3_c[i] == m3_c_[i] && o3_c[i] == o3_c_[i] && n3_c[i] == n3_c_[i];
+      }
+      if (! match) {
+        apply (prolong);
+        precision_ = precision;
+        accumulate_ = accumulate;
+        for (int i=0; i<3; i++) {
+          m3_f_[i] = m3_f[i]; o3_f_[i] = o3_f[i]; n3_f_[i] = n3_f[i];
+          m3_c_[i] = m3_c[i]; o3_c_[i] = o3_c[i]; n3_c_[i] = n3_c[i];
+        }
+      }
+      values_f_.push_back(values_f);
+      values_c_.push_back(values_c);
+    }
+
+    /// Prolong all fields in the batch and clear it
+    void apply (Prolong * prolong)
+    {
+      if (values_f_.size() == 0) return;
+      prolong->apply_fields
+        (precision_, values_f_.size(),
+         values_f_.data(),m3_f_,o3_f_,n3_f_,
+         values_c_.data(),m3_c_,o3_c_,n3_c_,
+         accumulate_);
+      values_f_.clear();
+      values_c_.clear();
+    }
+
+    precision_type precision_;
+    bool accumulate_;
+    int m3_f_[3], o3_f_[3], n3_f_[3];
+    int m3_c_[3], o3_c_[3], n3_c_[3];
+    std::vector<void *> values_f_;
+    std::vector<const void *> values_c_;
+  };
+}
+
+//----------------------------------------------------------------------
+
 #define CONFIG_SMP_MODE
 static CmiNodeLock field_face_node_lock;
 void mutex_init_field_face()
@@ -328,6 +385,8 @@ void FieldFace::array_to_face (char * array, Field field) throw()
   auto field_list_src = refresh_->field_list_src();
   auto field_list_dst = refresh_->field_list_dst();
 
+  ProlongBatch batch;
+
   for (size_t i_f=0; i_f < field_list_dst.size(); i_f++) {
 
     size_t index_field = field_list_dst[i_f];
@@ -393,11 +452,22 @@ void FieldFace::array_to_face (char * array, Field field) throw()
 
       // adjust for full-block interpolation to child
       TRACE_PROLONG("array_to_face",prolong(),m3,i3,n3,mc3,ic3,nc3);
-      prolong()->apply
-        (precision,
-         field_ghost,m3, i3,  n3,
-         array_ghost,mc3,ic3, nc3,
-         accumulate);
+      if (is_scaled_by_density_(field,index_field)) {
+        // prolong batched fields (including density) before
+        // div_by_density_()
+        batch.apply(prolong());
+        prolong()->apply
+          (precision,
+           field_ghost,m3, i3,  n3,
+           array_ghost,mc3,ic3, nc3,
+           accumulate);
+      } else {
+        batch.add
+          (prolong(),precision,
+           field_ghost,m3, i3,  n3,
+           array_ghost,mc3,ic3, nc3,
+           accumulate);
+      }
 
 #ifdef DEBUG_ARRAY            
       CkPrintf ("field %lu\n",  i_f);
@@ -433,6 +503,8 @@ void FieldFace::array_to_face (char * array, Field field) throw()
     div_by_density_(field,index_field,i3,n3,m3);
 
   }
+
+  if (refresh_type_ == refresh_fine) batch.apply(prolong());
 }
 
 //----------------------------------------------------------------------
@@ -445,7 +517,9 @@ void FieldFace::face_to_face (Field field_src, Field field_dst)
 #ifdef CONFIG_SMP_MODE
   CmiLock(field_face_node_lock);
 #endif  
-    
+
+  ProlongBatch batch;
+
   for (size_t i_f=0; i_f < field_list_src.size(); i_f++) {
 
     size_t index_src = field_list_src[i_f];
@@ -511,10 +585,21 @@ void FieldFace::face_to_face (Field field_src, Field field_dst)
 
       // adjust for full-block interpolation to child
       TRACE_PROLONG("face_to_face",prolong(),m3,id3,nd3,m3,is3,ns3);
-      prolong()->apply (precision,
-                        values_dst,m3,id3, nd3,
-                        values_src,m3,is3, ns3,
-                        accumulate);
+      if (is_scaled_by_density_(field_src,index_src) ||
+          is_scaled_by_density_(field_dst,index_dst)) {
+        // prolong batched fields (including density) before
+        // div_by_density_()
+        batch.apply(prolong());
+        prolong()->apply (precision,
+                          values_dst,m3,id3, nd3,
+                          values_src,m3,is3, ns3,
+                          accumulate);
+      } else {
+        batch.add (prolong(),precision,
+                   values_dst,m3,id3, nd3,
+                   values_src,m3,is3, ns3,
+                   accumulate);
+      }
 
 #ifdef DEBUG_ARRAY            
       CkPrintf ("field %lu\n",  i_f);
@@ -557,6 +642,9 @@ void FieldFace::face_to_face (Field field_src, Field field_dst)
     div_by_density_(field_src,index_src,is3,ns3,m3);
     div_by_density_(field_dst,index_dst,id3,nd3,m3);
   }
+
+  if (refresh_type_ == refresh_fine) batch.apply(prolong());
+
 #ifdef CONFIG_SMP_MODE
   CmiUnlock(field_face_node_lock);
 #endif  
@@ -673,8 +761,10 @@ char * FieldFace::load_data (char * buffer)
 
   memcpy(&refresh_type_,p,n=sizeof(int));   p+=n;
 
-  Refresh * refresh = new Refresh;
-  set_refresh(refresh,true);
+  // reuse the Refresh object if owned, e.g. when recycled by DataMsgPool
+  if (! (new_refresh_ && refresh_ != NULL)) {
+    set_refresh(new Refresh,true);
+  }
 
   p = refresh_->load_data(p);
 
@@ -860,6 +950,16 @@ void FieldFace::set_field_list(std::vector<int> field_list)
 
 //----------------------------------------------------------------------
 
+bool FieldFace::is_scaled_by_density_ (Field field, int index_field)
+{
+  return (! field.is_temporary(index_field)) &&
+    (refresh_type_ != refresh_same) &&
+    cello::field_groups()->is_in
+    (field.field_name(index_field),"make_field_conservative");
+}
+
+//----------------------------------------------------------------------
+
 void FieldFace::mul_by_density_
 (Field field, int index_field,
  const int i3[3], const int n3[3], const int m3[3])
@@ -102,6 +102,17 @@ public: // interface
     new_refresh_ = new_refresh;
   }
 
+  /// Set the Refresh object to a copy of refresh, reusing the owned
+  /// Refresh object if any, e.g. when recycled by DataMsgPool
+  void set_refresh_copy (const Refresh & refresh)
+  {
+    if (new_refresh_ && refresh_ != nullptr) {
+      *refresh_ = refresh;
+    } else {
+      set_refresh(new Refresh(refresh),true);
+    }
+  }
+
   /// Return the Refresh object
   Refresh * refresh () const
   { return refresh_; }
@@ -172,6 +183,10 @@ private: // functions
 	      const T * vs, int ms3[3], int ns3[3], int is3[3],
 	      bool accumulate) throw();
 
+  /// Whether the field is scaled by density to convert to conservative
+  /// form when refreshed
+  bool is_scaled_by_density_ (Field field, int index_field);
+
   /// Multiply the given field by density to convert to conservative
   /// form if needed
   void mul_by_density_
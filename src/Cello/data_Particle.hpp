@@ -350,6 +350,21 @@ public: // interface
   void compress (int it)
   { particle_data_->compress(particle_descr_,it); }
 
+  /// Reorder particles of the given type by the integer key
+  /// key[i] in [0,num_keys) using a stable counting sort, where
+  /// particles are numbered consecutively across batches.  Typically
+  /// used to order particles by the cell containing them.  Return
+  /// whether any particles were moved
+
+  bool sort (int it, const int * key, int num_keys)
+  { return particle_data_->sort(particle_descr_,it,key,num_keys); }
+
+  /// Return offsets of the first particle with each key from the last
+  /// call to sort(), or NULL if particles were since inserted or deleted
+
+  const std::vector<int> * sort_offset (int it) const
+  { return particle_data_->sort_offset(it); }
+
   /// Return the storage "efficiency" for particles of the given type
   /// and in the given batch, or average if batch or type not specified.
   /// 1.0 means no wasted storage, 0.5 means twice as much storage
@@ -18,7 +18,8 @@ int64_t ParticleData::id_counter[CONFIG_NODE_SIZE] = {0};
 ParticleData::ParticleData()
   : attribute_array_(),
     attribute_align_(),
-    particle_count_()
+    particle_count_(),
+    sort_offset_()
 {
   ++counter[cello::index_static()];
 }
@@ -40,6 +41,7 @@ void ParticleData::pup (PUP::er &p)
   p | attribute_array_;
   p | attribute_align_;
   p | particle_count_;
+  if (p.isUnpacking()) sort_offset_.clear();
 }
 
 //----------------------------------------------------------------------
@@ -286,6 +288,23 @@ int ParticleData::delete_particles
 
 //----------------------------------------------------------------------
 
+namespace {
+
+  /// Scratch arrays reused across calls to ParticleData::scatter()
+  struct ScatterScratch {
+    /// Distinct non-NULL destination ParticleData objects
+    std::vector<ParticleData *> dest;
+    /// Index into dest of each slot in particle_array, or -1 if NULL
+    std::vector<int> slot_dest;
+    /// Number of particles, then index of next particle, per destination
+    std::vector<int> next;
+    /// Byte offset, byte stride, and size of each attribute
+    std::vector<int> attr;
+  };
+
+  ScatterScratch scatter_scratch[CONFIG_NODE_SIZE];
+}
+
 void ParticleData::scatter
 (ParticleDescr * particle_descr,
  int it, int ib,
@@ -293,143 +312,113 @@ void ParticleData::scatter
  int n, ParticleData * particle_array[],
  const bool copy)
 {
-  // count number of particles in each particle_array element
-
-  std::vector<int> np_array(n,0);
+  ASSERT("ParticleData::scatter",
+	 "This function was called with null mask and copy = true."
+	 "This is not allowed.",
+	 (mask != NULL) || !copy);
 
-  if (mask == NULL) {
+  if (np == 0) return;
 
-    ASSERT("ParticleData::scatter",
-	   "This function was called with null mask and copy = true."
-	   "This is not allowed.",!copy);
-    for (int ip=0; ip<np; ip++) {
-      ++np_array[index[ip]];
-    }
-  } else {
-    if (copy){
-      for (int ip=0; ip<np; ip++) {
-        if (mask[ip]) {
-          for(int k = 0; k < n; k++){
-
-	    // Null pointers correspond to the original block,
-	    // we don't want to copy in this case.
-            if (particle_array[k] != NULL) ++np_array[k];
-          }
-        }
-      }
-    } else {
-      for (int ip=0; ip<np; ip++) {
-        if (mask[ip]) ++np_array[index[ip]];
-      }
-    }
-  }
+  ScatterScratch & scratch = scatter_scratch[cello::index_static()];
 
+  // map each slot to a distinct destination, since several slots
+  // (e.g. neighbor faces, edges, and corners) may share the same
+  // ParticleData object.  NULL slots correspond to the original
+  // block and receive no particles
 
-  std::map<ParticleData *, int>  i_array;
-  std::map<ParticleData *, bool> is_first;
-  std::map<ParticleData *, bool> been_copied;
+  std::vector<ParticleData *> & dest = scratch.dest;
+  std::vector<int> & slot_dest = scratch.slot_dest;
+  dest.clear();
+  slot_dest.assign(n,-1);
   for (int k=0; k<n; k++) {
     ParticleData * pd = particle_array[k];
-    is_first[pd] = true;
-    i_array[pd] = 0;
+    if (pd == NULL) continue;
+    int j = 0;
+    while (j < (int)dest.size() && dest[j] != pd) ++j;
+    if (j == (int)dest.size()) dest.push_back(pd);
+    slot_dest[k] = j;
   }
+  const int nd = dest.size();
 
-  // insert uninitialized particles
-  for (int k=0; k<n; k++) {
-    ParticleData * pd = particle_array[k];
-    if (np_array[k]>0 && pd) {
-      if (copy){
-	if (is_first[pd]){
-	  int i0 = pd->insert_particles (particle_descr,it,np_array[k]);
-	  i_array[pd] = i0;
-	  is_first[pd] = false;
-	}
-      }
-      else{
-	int i0 = pd->insert_particles (particle_descr,it,np_array[k]);
-	if (is_first[pd]) i_array[pd] = i0;
-	is_first[pd] = false;
+  // first pass: count particles per destination
+
+  std::vector<int> & next = scratch.next;
+  next.assign(nd,0);
+  if (copy) {
+    // copies go to every destination
+    int npm = 0;
+    for (int ip=0; ip<np; ip++) if (mask[ip]) ++npm;
+    for (int j=0; j<nd; j++) next[j] = npm;
+  } else {
+    // moved particles must have a destination, else they would be lost
+    for (int ip=0; ip<np; ip++) {
+      if ((mask == NULL) || mask[ip]) {
+	const int j = slot_dest[index[ip]];
+	ASSERT2("ParticleData::scatter",
+		"Particle %d is moved to slot %d, which has no ParticleData",
+		ip,index[ip],
+		(j >= 0));
+	++next[j];
       }
     }
   }
+
+  // insert uninitialized particles with one insert per destination,
+  // replacing counts with the index of the first inserted particle
+
+  for (int j=0; j<nd; j++) {
+    next[j] = (next[j] > 0) ?
+      dest[j]->insert_particles (particle_descr,it,next[j]) : 0;
+  }
+
+  // precompute attribute offsets, strides, and sizes in bytes
+
   const bool interleaved = particle_descr->interleaved(it);
   const int na = particle_descr->num_attributes(it);
-  int mp = particle_descr->particle_bytes(it);
-  const int ib_src = ib;
-  int ia_copy = -1;
-  int d_copy   = -1;
-  if (particle_descr->has_attribute(it, "is_copy")) ia_copy = particle_descr->attribute_index(it,"is_copy");
-  if (ia_copy >= 0) d_copy = particle_descr->stride(it, ia_copy);
-  int64_t *is_copy=NULL;
-  
-  for (int ip_src=0; ip_src<np; ip_src++) {
-
-    if (copy){
-      for (int k = 0; k < n; k++) been_copied[particle_array[k]] = false;
-    }
-    
-    if ((mask == NULL) || mask[ip_src]) {
-      
-      if (copy){
-	
-	for (int k = 0; k < n; k++){
-	  ParticleData * pd = particle_array[k];
-
-	  // Null pointer corresponds to the original block. Don't want to copy
-	  // in this case.
-	  if (pd == NULL) continue;
-	  
-	  if (!been_copied[pd]){
-	    int i_dst = i_array[pd]++;
-	    int ib_dst,ip_dst;
-	    particle_descr->index(i_dst,&ib_dst,&ip_dst);
-	    is_copy = (int64_t *) pd->attribute_array(particle_descr,it,
-						    ia_copy,ib_dst);
-	  
-	    for (int ia=0; ia<na; ia++) {
-	      if (!interleaved)
-		mp = particle_descr->attribute_bytes(it,ia);
-	      int ny = particle_descr->attribute_bytes(it,ia);
-	      char * a_src = attribute_array
-		(particle_descr,it,ia,ib_src);
-	      char * a_dst = pd->attribute_array
-		(particle_descr,it,ia,ib_dst);
-	      for (int iy=0; iy<ny; iy++) {
-		a_dst [iy + mp*ip_dst] = a_src [iy + mp*ip_src];
-	      }
-	    }
-	    
-	    // This marks the newly created particle as a copy
-	    is_copy[ip_dst*d_copy] = true;
-
-	    // Ensures we don't copy particles to the same block more than once
-	    been_copied[pd] = true;
-	    
-	  } // if (!been_copied[pd])
-
-	  
-	} // Loop over particle array
-	
+  const int mp = particle_descr->particle_bytes(it);
+  std::vector<int> & attr = scratch.attr;
+  attr.resize(3*na);
+  for (int ia=0; ia<na; ia++) {
+    const int ny = particle_descr->attribute_bytes(it,ia);
+    attr[3*ia+0] = particle_descr->attribute_offset(it,ia);
+    attr[3*ia+1] = interleaved ? mp : ny;
+    attr[3*ia+2] = ny;
+  }
+
+  const int ia_copy = (copy && particle_descr->has_attribute(it,"is_copy")) ?
+    particle_descr->attribute_index(it,"is_copy") : -1;
+
+  // second pass: copy particles directly into destination batches
+
+  const char * base_src = &attribute_array_[it][ib][0] + attribute_align_[it][ib];
+
+  auto copy_particle = [&] (int j, int ip_src)
+    {
+      ParticleData * pd = dest[j];
+      int ib_dst,ip_dst;
+      particle_descr->index(next[j]++,&ib_dst,&ip_dst);
+      char * base_dst = &pd->attribute_array_[it][ib_dst][0]
+	+ pd->attribute_align_[it][ib_dst];
+      for (int ia=0; ia<na; ia++) {
+	const int offset = attr[3*ia+0];
+	const int dp     = attr[3*ia+1];
+	memcpy (base_dst + offset + dp*ip_dst,
+		base_src + offset + dp*ip_src, attr[3*ia+2]);
+      }
+      if (ia_copy >= 0) {
+	// This marks the newly created particle as a copy
+	int64_t * is_copy = (int64_t *)
+	  (base_dst + attr[3*ia_copy+0] + attr[3*ia_copy+1]*ip_dst);
+	*is_copy = true;
+      }
+    };
+
+  for (int ip=0; ip<np; ip++) {
+    if ((mask == NULL) || mask[ip]) {
+      if (copy) {
+	for (int j=0; j<nd; j++) copy_particle(j,ip);
       } else {
-	
-	int k = index[ip_src];
-	ParticleData * pd = particle_array[k];
-	int i_dst = i_array[pd]++;
-	int ib_dst,ip_dst;
-	particle_descr->index(i_dst,&ib_dst,&ip_dst);
-	
-	for (int ia=0; ia<na; ia++) {
-	  if (!interleaved)
-	    mp = particle_descr->attribute_bytes(it,ia);
-	  int ny = particle_descr->attribute_bytes(it,ia);
-	  char * a_src = attribute_array
-	    (particle_descr,it,ia,ib_src);
-	  char * a_dst = pd->attribute_array
-	    (particle_descr,it,ia,ib_dst);
-	  for (int iy=0; iy<ny; iy++) {
-	    a_dst [iy + mp*ip_dst] = a_src [iy + mp*ip_src];
-	  }
-	}
+	copy_particle(slot_dest[index[ip]],ip);
       }
     }
   }
@@ -585,6 +574,93 @@ void ParticleData::compress (ParticleDescr * particle_descr, int it)
 }
 
 
+//----------------------------------------------------------------------
+
+bool ParticleData::sort
+(ParticleDescr * particle_descr, int it, const int * key, int num_keys)
+{
+  check_arrays_(particle_descr,__FILE__,__LINE__);
+
+  const int nb = num_batches(it);
+  const int mb = particle_descr->batch_size();
+  const int na = particle_descr->num_attributes(it);
+  const bool interleaved = particle_descr->interleaved(it);
+
+  // count particles per key and check whether already sorted
+
+  std::vector<int> offset (num_keys+1,0);
+  const int np = num_particles(particle_descr,it);
+  bool is_sorted = true;
+  for (int ib=0; ib<nb; ib++) {
+    const int npb = num_particles(particle_descr,it,ib);
+    // batches must also be full except possibly the last
+    if (ib < nb-1 && npb < mb) is_sorted = false;
+  }
+  for (int i=0; i<np; i++) {
+    ASSERT3("ParticleData::sort()",
+	    "particle %d key %d out of range [0,%d)",
+	    i,key[i],num_keys,
+	    (0 <= key[i] && key[i] < num_keys));
+    ++offset[key[i]+1];
+    if (i > 0 && key[i] < key[i-1]) is_sorted = false;
+  }
+  for (int k=0; k<num_keys; k++) offset[k+1] += offset[k];
+
+  if (! is_sorted) {
+
+    // destination index of each particle
+
+    std::vector<int> index (np);
+    std::vector<int> next (offset.begin(),offset.end()-1);
+    for (int i=0; i<np; i++) index[i] = next[key[i]]++;
+
+    // allocate new batches
+
+    const int nb_new = (np + mb - 1) / mb;
+    const int mp = particle_descr->particle_bytes(it);
+
+    std::vector< std::vector<char> > array_new (nb_new);
+    std::vector< char > align_new (nb_new);
+    std::vector< int > count_new (nb_new);
+    for (int ib=0; ib<nb_new; ib++) {
+      count_new[ib] = std::min(mb,np - ib*mb);
+      const int npa = interleaved ? count_new[ib] : mb;
+      array_new[ib].resize(mp*npa + (PARTICLE_ALIGN - 1));
+      uintptr_t iarray = (uintptr_t) &array_new[ib][0];
+      int defect = (iarray % PARTICLE_ALIGN);
+      align_new[ib] = (defect == 0) ? 0 : PARTICLE_ALIGN-defect;
+    }
+
+    // copy particle attributes to their sorted locations
+
+    for (int ia=0; ia<na; ia++) {
+      const int ny = particle_descr->attribute_bytes(it,ia);
+      const int dp = interleaved ? mp : ny;
+      const int offset_ia = particle_descr->attribute_offset(it,ia);
+      int i = 0;
+      for (int ib=0; ib<nb; ib++) {
+	const char * a_src = attribute_array(particle_descr,it,ia,ib);
+	const int npb = num_particles(particle_descr,it,ib);
+	for (int ip=0; ip<npb; ip++,i++) {
+	  const int jb = index[i] / mb;
+	  const int jp = index[i] % mb;
+	  char * a_dst = &array_new[jb][0] + (offset_ia + align_new[jb]);
+	  memcpy (a_dst + dp*jp, a_src + dp*ip, ny);
+	}
+      }
+    }
+
+    attribute_array_[it].swap(array_new);
+    attribute_align_[it].swap(align_new);
+    particle_count_[it].swap(count_new);
+  }
+
+  if ((int)sort_offset_.size() <= it) sort_offset_.resize(it+1);
+  sort_offset_[it].swap(offset);
+
+  return ! is_sorted;
+}
+
 //----------------------------------------------------------------------
 
 float ParticleData::efficiency (ParticleDescr * particle_descr)
@@ -790,12 +866,26 @@ void ParticleData::update_attribute_float_
   const int dx = particle_descr->stride(it,ia);
   char * array = attribute_array(particle_descr,it,ia,ib);
   const int np = num_particles(particle_descr,it,ib);
+  // convert the shift to double first so that float and double
+  // attributes are not updated using long double arithmetic, which
+  // prevents vectorization
+  const double da_d = da;
   if (type == type_float) {
     float * array_f = (float *) array;
-    for (int ip=0; ip<np; ip++) array_f[ip*dx] += da;
+    if (dx == 1) {
+#pragma omp simd
+      for (int ip=0; ip<np; ip++) array_f[ip] += da_d;
+    } else {
+      for (int ip=0; ip<np; ip++) array_f[ip*dx] += da_d;
+    }
   } else if (type == type_double) {
     double * array_d = (double *) array;
-    for (int ip=0; ip<np; ip++) array_d[ip*dx] += da;
+    if (dx == 1) {
+#pragma omp simd
+      for (int ip=0; ip<np; ip++) array_d[ip] += da_d;
+    } else {
+      for (int ip=0; ip<np; ip++) array_d[ip*dx] += da_d;
+    }
   } else if (type == type_quadruple) {
     long double * array_q = (long double *) array;
     for (int ip=0; ip<np; ip++) array_q[ip*dx] += da;
@@ -1169,6 +1259,9 @@ void ParticleData::resize_attribute_array_
   // store number of particles allocated
   particle_count_[it][ib] = np;
 
+  // any previous sort index is no longer valid
+  if (it < (int)sort_offset_.size()) sort_offset_[it].clear();
+
   const int mp = particle_descr->particle_bytes(it);
 
   if (!particle_descr->interleaved(it)) {
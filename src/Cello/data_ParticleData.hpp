@@ -38,6 +38,7 @@ public: // interface
     attribute_array_ = particle_data.attribute_array_;
     attribute_align_ = particle_data.attribute_align_;
     particle_count_  = particle_data.particle_count_;
+    sort_offset_     = particle_data.sort_offset_;
 
     ParticleDescr * particle_descr = cello::particle_descr();
     id_counter[cello::index_static()] = num_particles(particle_descr);
@@ -87,6 +88,10 @@ public: // interface
   /// Typically used for preparing to send particles that have gone
   /// out of the block to neighboring blocks.  Particles are not deleted,
   /// so must be done so manually, e.g. using delete_particles.
+  /// Particle ip is sent to particle_array[index[ip]], which must not
+  /// be NULL, or to every distinct non-NULL element if copy is true.
+  /// Elements may repeat, and particles are appended to each distinct
+  /// destination with a single insert_particles() call.
 
   void scatter (ParticleDescr *, int it, int ib,
 		int np, const bool * mask, const int * index,
@@ -106,6 +111,25 @@ public: // interface
   void compress (ParticleDescr *);
   void compress (ParticleDescr *, int it);
 
+  /// Reorder particles of the given type using a stable counting sort
+  /// on the integer key key[i] in [0,num_keys) of each particle, where
+  /// particles are numbered consecutively across batches.  Batches are
+  /// rebuilt so that all but possibly the last have batch_size()
+  /// particles.  Particles with key k are then numbered
+  /// sort_offset(it)[k] <= i < sort_offset(it)[k+1].  Return whether
+  /// any particles were moved.
+  bool sort (ParticleDescr *, int it, const int * key, int num_keys);
+
+  /// Return the offsets of the first particle with each key, as
+  /// computed by the last call to sort(), or NULL if particles have
+  /// since been inserted or deleted.  Offsets are not updated if
+  /// particle positions are changed after sorting.
+  const std::vector<int> * sort_offset (int it) const
+  {
+    return (0 <= it && it < (int)sort_offset_.size() &&
+	    ! sort_offset_[it].empty()) ? &sort_offset_[it] : nullptr;
+  }
+
   /// Return the storage "efficiency" for particles of the given type
   /// and in the given batch, or average if batch or type not specified.
   /// 1.0 means no wasted storage, 0.5 means twice as much storage
@@ -237,6 +261,11 @@ private: /// attributes
   /// Number of particles in the batch particle_count_[it][ib];
   std::vector < std::vector < int > > particle_count_;
 
+  /// Index of first particle for each key after sort(), per type;
+  /// cleared whenever the type's particles are resized.  Not
+  /// checkpointed
+  std::vector < std::vector < int > > sort_offset_;
+
 };
 
 #endif /* DATA_PARTICLE_DATA_HPP */
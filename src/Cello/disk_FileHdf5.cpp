@@ -14,6 +14,13 @@
 #define MAX_DATA_RANK 4
 #define MAX_ATTR_RANK 4
 
+/// Target size in bytes of chunks in filtered datasets
+#define CHUNK_BYTES (1024*1024)
+
+/// Registered HDF5 filter identifiers for the lz4 and zstd plugins
+#define FILTER_LZ4  32004
+#define FILTER_ZSTD 32015
+
 //----------------------------------------------------------------------
 
 std::map<const std::string,FileHdf5 *> FileHdf5::file_list;
@@ -37,7 +44,10 @@ FileHdf5::FileHdf5 (std::string path, std::string name) throw()
     data_rank_(0),
     data_prop_(H5P_DEFAULT),
     is_data_open_(false),
-    compress_level_(0)
+    compress_level_(0),
+    compress_filter_("none"),
+    shuffle_(true),
+    quantize_digits_(-1)
 {
   for (int i=0; i<MAX_DATA_RANK; i++) {
     data_dims_[i] = 0;
@@ -228,6 +238,32 @@ void FileHdf5::data_slice
 
 //----------------------------------------------------------------------
 
+void FileHdf5::data_slice_rows (const std::vector<int> & rows) throw()
+{
+  ASSERT1("FileHdf5::data_slice_rows()",
+          "Dataset %s must have rank 2",
+          data_name_.c_str(),
+          (H5Sget_simple_extent_ndims(data_space_id_) == 2));
+
+  hsize_t dims[2];
+  H5Sget_simple_extent_dims (data_space_id_,dims,0);
+
+  H5Sselect_none (data_space_id_);
+
+  const int n = rows.size();
+  for (int i=0; i<n; ) {
+    // extend run of consecutive rows starting at rows[i]
+    int j = i + 1;
+    while (j < n && rows[j] == rows[j-1] + 1) ++j;
+    hsize_t start[2] = {hsize_t(rows[i]), 0};
+    hsize_t count[2] = {hsize_t(j - i), dims[1]};
+    H5Sselect_hyperslab (data_space_id_,H5S_SELECT_OR,start,0,count,0);
+    i = j;
+  }
+}
+
+//----------------------------------------------------------------------
+
 void FileHdf5::mem_create
 ( int mx, int my, int mz,
   int nx, int ny, int nz,
@@ -267,13 +303,17 @@ void FileHdf5::data_create
 
   // Create the new dataset
 
+  hid_t data_prop = data_prop_create_(type);
+
   data_id_ = H5Dcreate( group,
 			name.c_str(),
 			scalar_to_hdf5_(type),
 			data_space_id_,
 			H5P_DEFAULT,
-			data_prop_,
+			data_prop,
 			H5P_DEFAULT);
+
+  if (data_prop != data_prop_) H5Pclose (data_prop);
 #ifdef TRACE_DISK  
   CkPrintf ("%d %Ld :%d TRACE_DISK H5Dcreate(%d)\n",CkMyPe(),file_id_, __LINE__,data_id_);
   fflush(stdout);
@@ -795,17 +835,93 @@ void FileHdf5::group_read_meta
 
 void FileHdf5::set_compress (int level) throw ()
 {
-  compress_level_ = level; 
-  if (compress_level_ != 0) {
-    WARNING("FileHdf5::set_compress",
-	    "Hard-coded for 2D data with chunk size [10,10]");
-    int rank = 2;
-    hsize_t chunk_size[MAX_DATA_RANK];
-    chunk_size[0]=10;
-    chunk_size[1]=10;
-    H5Pset_chunk(data_prop_,rank,chunk_size);
-    H5Pset_deflate(data_prop_,compress_level_);
+  set_filter ((level != 0) ? "gzip" : "none", level);
+}
+
+//----------------------------------------------------------------------
+
+void FileHdf5::set_filter (std::string filter, int level) throw ()
+{
+  ASSERT1("FileHdf5::set_filter",
+          "Unknown compression filter \"%s\"",
+          filter.c_str(),
+          (filter == "none" || filter == "gzip" ||
+           filter == "lz4"  || filter == "zstd"));
+
+  if ((filter == "lz4"  && H5Zfilter_avail(FILTER_LZ4)  <= 0) ||
+      (filter == "zstd" && H5Zfilter_avail(FILTER_ZSTD) <= 0)) {
+    static bool warned = false;
+    if (! warned) {
+      WARNING1("FileHdf5::set_filter",
+               "HDF5 filter plugin for %s not available: using gzip",
+               filter.c_str());
+      warned = true;
+    }
+    filter = "gzip";
+    level = 1;
+  }
+  compress_filter_ = filter;
+  compress_level_  = level;
+}
+
+//----------------------------------------------------------------------
+
+hid_t FileHdf5::data_prop_create_ (int type) throw()
+{
+  const bool is_float = (type == type_single || type == type_double);
+  const bool is_quantized = (is_float && quantize_digits_ >= 0);
+  const bool is_compressed = (compress_filter_ != "none");
+
+  if (! is_quantized && ! is_compressed) return data_prop_;
+
+  // Filters require chunking
+
+  hsize_t dims[MAX_DATA_RANK];
+  const int rank = H5Sget_simple_extent_dims (data_space_id_,dims,NULL);
+  hsize_t chunk[MAX_DATA_RANK];
+  long long bytes = H5Tget_size (scalar_to_hdf5_(type));
+  for (int i=0; i<rank; i++) {
+    // HDF5 does not allow chunking empty datasets
+    if (dims[i] == 0) return data_prop_;
+    chunk[i] = dims[i];
+    bytes *= dims[i];
+  }
+
+  // halve the longest chunk axis until chunks are at most CHUNK_BYTES
+
+  while (bytes > CHUNK_BYTES) {
+    int i_max = 0;
+    for (int i=1; i<rank; i++) if (chunk[i] > chunk[i_max]) i_max = i;
+    if (chunk[i_max] == 1) break;
+    bytes = bytes / chunk[i_max];
+    chunk[i_max] = (chunk[i_max] + 1) / 2;
+    bytes = bytes * chunk[i_max];
+  }
+
+  hid_t data_prop = H5Pcopy (data_prop_);
+  H5Pset_chunk (data_prop,rank,chunk);
+
+  // Lossy quantization is applied before the lossless filters
+
+  if (is_quantized) {
+    // D-scaling truncates, with error up to 10^-digits, so keep one
+    // more digit to bound the error by 0.5*10^-digits
+    H5Pset_scaleoffset (data_prop,H5Z_SO_FLOAT_DSCALE,quantize_digits_ + 1);
+  }
+  if (is_compressed && shuffle_) {
+    H5Pset_shuffle (data_prop);
+  }
+  if (compress_filter_ == "gzip") {
+    H5Pset_deflate (data_prop,(compress_level_ > 0) ? compress_level_ : 1);
+  } else if (compress_filter_ == "lz4") {
+    // lz4 parameter is the block size in bytes (0 for default)
+    const unsigned int cd_values[1] = {0};
+    H5Pset_filter (data_prop,FILTER_LZ4,H5Z_FLAG_OPTIONAL,1,cd_values);
+  } else if (compress_filter_ == "zstd") {
+    const unsigned int cd_values[1] = {(unsigned int)compress_level_};
+    H5Pset_filter (data_prop,FILTER_ZSTD,H5Z_FLAG_OPTIONAL,1,cd_values);
   }
+  return data_prop;
 }
 
 //======================================================================
@@ -50,6 +50,9 @@ public: // interface
     p | data_prop_;
     p | is_data_open_;
     p | compress_level_;
+    p | compress_filter_;
+    p | shuffle_;
+    p | quantize_digits_;
   }
 
 public: // virtual functions
@@ -100,6 +103,11 @@ public: // virtual functions
     int n1, int n2, int n3, int n4,
     int o1, int o2, int o3, int o4) throw();
 
+  /// Select the given rows of the opened rank-2 dataset as a union of
+  /// hyperslabs, one per run of consecutive rows.  Rows must be
+  /// sorted, and are read in that order
+  void data_slice_rows (const std::vector<int> & rows) throw();
+
   /// Return the size of the disk dataset
   virtual int data_size (int * m4) throw();
   
@@ -166,12 +174,28 @@ public: // virtual functions
 
 public: // functions
 
-  /// Set the compression level
+  /// Set the gzip compression level of new datasets
   void set_compress (int level) throw ();
 
   /// Return the compression level
   int compress () throw () {return compress_level_; }
 
+  /// Set the compression filter of new datasets: "none", "gzip",
+  /// "lz4", or "zstd", with the given level (0 for the filter's
+  /// default).  lz4 and zstd require the corresponding HDF5 filter
+  /// plugin, and fall back to gzip if it is not available
+  void set_filter (std::string filter, int level) throw ();
+
+  /// Set whether to byte-shuffle new compressed datasets
+  void set_shuffle (bool shuffle) throw ()
+  { shuffle_ = shuffle; }
+
+  /// Set the number of decimal digits kept in new floating-point
+  /// datasets, for lossy compression with absolute error at most
+  /// 0.5*10^-digits; -1 for lossless
+  void set_quantize (int digits) throw ()
+  { quantize_digits_ = digits; }
+
   /// Allocate a buffer for reading in a dataset of the given
   /// length and type
   char * allocate_buffer (int n, int type_data)
@@ -252,6 +276,11 @@ private: // functions
   /// Close the dataset
   void close_dataset_ () throw();
 
+  /// Return the dataset creation property list for a new dataset of
+  /// the given type in data_space_id_, with chunking and filters if
+  /// any are enabled
+  hid_t data_prop_create_ (int type) throw();
+
 public: // static attributes
 
   /// Nodal list of files opened
@@ -313,6 +342,15 @@ private: // attributes
   /// Compression level
   int compress_level_;
 
+  /// Compression filter: "none", "gzip", "lz4", or "zstd"
+  std::string compress_filter_;
+
+  /// Whether to byte-shuffle compressed datasets
+  bool shuffle_;
+
+  /// Decimal digits kept in floating-point datasets, or -1 if lossless
+  int quantize_digits_;
+
 };
 
 #endif /* DISK_FILE_HDF5_HPP */
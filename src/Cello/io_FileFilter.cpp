@@ -0,0 +1,62 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     io_FileFilter.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    Implementation of the FileFilter class
+
+#include "io.hpp"
+
+//----------------------------------------------------------------------
+
+FileFilter::FileFilter
+(std::string compress, int level, bool shuffle,
+ std::vector<std::string> quantize_fields,
+ std::vector<int> quantize_digits) throw()
+  : compress_(compress),
+    level_(level),
+    shuffle_(shuffle),
+    quantize_fields_(quantize_fields),
+    quantize_digits_(quantize_digits)
+{
+  ASSERT2("FileFilter::FileFilter()",
+          "Number of quantized fields %lu and digits %lu differ",
+          quantize_fields_.size(),quantize_digits_.size(),
+          (quantize_fields_.size() == quantize_digits_.size()));
+}
+
+//----------------------------------------------------------------------
+
+void FileFilter::apply (FileHdf5 * file) const
+{
+  file->set_filter (compress_,level_);
+  file->set_shuffle (shuffle_);
+  file->set_quantize (-1);
+}
+
+//----------------------------------------------------------------------
+
+void FileFilter::apply_field
+(FileHdf5 * file, std::string field_name,
+ const Grouping * field_groups) const
+{
+  apply (file);
+  file->set_quantize (quantize_digits(field_name,field_groups));
+}
+
+//----------------------------------------------------------------------
+
+int FileFilter::quantize_digits
+(std::string field_name, const Grouping * field_groups) const
+{
+  if (field_groups == nullptr && ! quantize_fields_.empty()) {
+    field_groups = cello::field_groups();
+  }
+  for (size_t i=0; i<quantize_fields_.size(); i++) {
+    const std::string & name = quantize_fields_[i];
+    if (name == field_name || field_groups->is_in(field_name,name)) {
+      return quantize_digits_[i];
+    }
+  }
+  return -1;
+}
@@ -0,0 +1,87 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     io_FileFilter.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    [\ref Io] Declaration of the FileFilter class
+
+#ifndef IO_FILE_FILTER_HPP
+#define IO_FILE_FILTER_HPP
+
+class FileHdf5;
+
+class FileFilter {
+
+  /// @class    FileFilter
+  /// @ingroup  Io
+  /// @brief    [\ref Io] Compression policy for datasets written to
+  ///           FileHdf5 files
+  ///
+  /// All datasets use the same lossless compression filter, while
+  /// floating-point fields may additionally be quantized to a given
+  /// number of decimal digits.  Quantized fields are listed by field
+  /// name or field group, paired with the digits kept.
+
+public: // interface
+
+  /// Create a FileFilter with no compression
+  FileFilter() throw()
+    : compress_("none"),
+      level_(0),
+      shuffle_(true),
+      quantize_fields_(),
+      quantize_digits_()
+  { }
+
+  /// Create a FileFilter
+  FileFilter(std::string compress, int level, bool shuffle,
+             std::vector<std::string> quantize_fields,
+             std::vector<int> quantize_digits) throw();
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p)
+  {
+    TRACEPUP;
+    // NOTE: change this function whenever attributes change
+    p | compress_;
+    p | level_;
+    p | shuffle_;
+    p | quantize_fields_;
+    p | quantize_digits_;
+  }
+
+  /// Set the file's filters for datasets that are not fields,
+  /// such as particle attributes
+  void apply (FileHdf5 * file) const;
+
+  /// Set the file's filters for the given field's dataset.  Field
+  /// groups default to those of the simulation's FieldDescr
+  void apply_field (FileHdf5 * file, std::string field_name,
+                    const Grouping * field_groups = nullptr) const;
+
+  /// Return the number of decimal digits kept for the field, or -1
+  /// if it is not quantized
+  int quantize_digits (std::string field_name,
+                       const Grouping * field_groups = nullptr) const;
+
+private: // attributes
+
+  // NOTE: change pup() function whenever attributes change
+
+  /// Lossless compression filter: "none", "gzip", "lz4", or "zstd"
+  std::string compress_;
+
+  /// Compression level, or 0 for the filter's default
+  int level_;
+
+  /// Whether to byte-shuffle data before compressing
+  bool shuffle_;
+
+  /// Fields or field groups that are quantized
+  std::vector<std::string> quantize_fields_;
+
+  /// Decimal digits kept for the corresponding quantize_fields_
+  std::vector<int> quantize_digits_;
+};
+
+#endif /* IO_FILE_FILTER_HPP */
@@ -57,6 +57,11 @@ void Main::p_exit(int count)
   unit_finalize();
   if (count_exit_ >= count) {
     count_exit_ = 0;
+#ifdef CHARM_ENZO
+    // Asynchronous checkpoint writes call p_exit() again when done
+    EnzoSimulation * simulation = enzo::simulation();
+    if (simulation && simulation->check_defer_exit()) return;
+#endif
     exit_();
   }
 }
@@ -0,0 +1,57 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     memory_ScratchArena.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    [\ref Memory] Implementation of the ScratchArena class
+
+#include "cello.hpp"
+
+#include "memory.hpp"
+
+ScratchArena ScratchArena::instance_[CONFIG_NODE_SIZE];
+
+//----------------------------------------------------------------------
+
+void ScratchArena::reserve (std::size_t bytes)
+{
+  if (bytes > capacity_) {
+
+    clear();
+
+    Memory * memory = Memory::instance();
+    std::string memory_group;
+    if (memory) {
+      memory_group = memory->group();
+      memory->set_group("scratch");
+    }
+
+    // over-allocate so the start of the buffer can be aligned
+    buffer_ = new char [bytes + ALIGNMENT];
+
+    if (memory) {
+      memory->set_group(memory_group);
+    }
+
+    const std::size_t offset = (std::size_t)(buffer_) % ALIGNMENT;
+    begin_ = buffer_ + (offset ? (ALIGNMENT - offset) : 0);
+    capacity_ = bytes;
+    ++num_resized_;
+  }
+
+  bytes_reserved_ = bytes;
+  bytes_used_ = 0;
+  bytes_highest_ = std::max(bytes_highest_,bytes);
+}
+
+//----------------------------------------------------------------------
+
+void ScratchArena::clear()
+{
+  delete [] buffer_;
+  buffer_ = nullptr;
+  begin_ = nullptr;
+  capacity_ = 0;
+  bytes_reserved_ = 0;
+  bytes_used_ = 0;
+}
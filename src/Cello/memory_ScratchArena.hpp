@@ -0,0 +1,124 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     memory_ScratchArena.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    [\ref Memory] Declaration of the ScratchArena class
+
+#ifndef MEMORY_SCRATCH_ARENA_HPP
+#define MEMORY_SCRATCH_ARENA_HPP
+
+class ScratchArena {
+
+  /// @class    ScratchArena
+  /// @ingroup  Memory
+  /// @brief [\ref Memory] Per-process scratch space reused across
+  /// blocks and cycles.  A caller reserves the total number of bytes
+  /// it needs, then carves arrays out of the reserved space with
+  /// allocate().  The buffer is only reallocated when a larger size is
+  /// reserved, so repeated calls with the same block shape do not
+  /// allocate.  The buffer is allocated in the Memory group "scratch".
+  ///
+  /// Arrays from allocate() are only valid until the next call to
+  /// reserve(), so the arena must not be used by more than one caller
+  /// at a time.
+
+public: // interface
+
+  /// Alignment in bytes of arrays returned by allocate()
+  enum { ALIGNMENT = 64 };
+
+  /// Return the ScratchArena object for this process
+  static ScratchArena * instance()
+  { return & instance_[cello::index_static()]; }
+
+  /// Create an empty arena
+  ScratchArena()
+    : buffer_(nullptr),
+      begin_(nullptr),
+      capacity_(0),
+      bytes_reserved_(0),
+      bytes_used_(0),
+      bytes_highest_(0),
+      num_resized_(0)
+  { }
+
+  /// The buffer is not deleted here, since the arena is a static
+  /// object destroyed after Charm++ exits; call clear() to free it
+  ~ScratchArena()
+  { }
+
+  /// Return the number of bytes allocate() uses for n values of type T
+  template <class T>
+  static std::size_t bytes (int n)
+  { return align_(n*sizeof(T)); }
+
+  /// Start a new set of allocations using at most the given number of
+  /// bytes, as computed by bytes(), growing the buffer if needed.
+  /// Arrays from earlier allocate() calls are no longer valid.
+  void reserve (std::size_t bytes);
+
+  /// Return an uninitialized array of n values of type T from the
+  /// reserved space
+  template <class T>
+  T * allocate (int n)
+  {
+    const std::size_t size = bytes<T>(n);
+    ASSERT2 ("ScratchArena::allocate()",
+             "Allocating %ld bytes would exceed the %ld bytes reserved",
+             long(bytes_used_ + size), long(bytes_reserved_),
+             (size <= bytes_available()));
+    T * array = (T *)(begin_ + bytes_used_);
+    bytes_used_ += size;
+    return array;
+  }
+
+  /// Free the buffer
+  void clear();
+
+  /// Return the number of reserved bytes not yet returned by allocate()
+  std::size_t bytes_available () const
+  { return bytes_reserved_ - bytes_used_; }
+
+  /// Return the current size of the buffer in bytes
+  std::size_t capacity () const
+  { return capacity_; }
+
+  /// Return the largest number of bytes reserved at once
+  std::size_t bytes_highest () const
+  { return bytes_highest_; }
+
+  /// Return the number of times the buffer was reallocated
+  long long num_resized () const
+  { return num_resized_; }
+
+private: // functions
+
+  /// Round bytes up to a multiple of ALIGNMENT
+  static std::size_t align_ (std::size_t bytes)
+  { return (bytes + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT; }
+
+private: // attributes
+
+  /// Per-process arena objects
+  static ScratchArena instance_[CONFIG_NODE_SIZE];
+
+  /// Allocated buffer, and its first ALIGNMENT-aligned address
+  char * buffer_;
+  char * begin_;
+
+  /// Usable size of the buffer starting at begin_
+  std::size_t capacity_;
+
+  /// Bytes reserved by the last call to reserve()
+  std::size_t bytes_reserved_;
+
+  /// Bytes returned by allocate() since the last call to reserve()
+  std::size_t bytes_used_;
+
+  /// Statistics
+  std::size_t bytes_highest_;
+  long long num_resized_;
+};
+
+#endif /* MEMORY_SCRATCH_ARENA_HPP */
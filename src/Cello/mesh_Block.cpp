@@ -62,6 +62,8 @@ Block::Block ( process_type ip_source, MsgType msg_type )
     adapt_ready_(false),
     adapt_balanced_(false),
     adapt_changed_(0),
+    adapt_phase_step_(0),
+    adapt_created_(true),
     coarsened_(false),
     is_leaf_((thisIndex.level() >= 0)),
     age_(0),
@@ -150,6 +152,8 @@ Block::Block ( MsgRefine * msg )
     adapt_ready_(false),
     adapt_balanced_(false),
     adapt_changed_(0),
+    adapt_phase_step_(0),
+    adapt_created_(true),
     coarsened_(false),
     is_leaf_((thisIndex.level() >= 0)),
     age_(0),
@@ -388,6 +392,8 @@ void Block::pup(PUP::er &p)
   p | adapt_ready_;
   p | adapt_balanced_;
   p | adapt_changed_;
+  p | adapt_phase_step_;
+  p | adapt_created_;
   // std::vector < MsgAdapt * > adapt_msg_list_;
   p | coarsened_;
   p | is_leaf_;
@@ -516,6 +522,8 @@ void Block::print (FILE * fp_in) const
   fprintf (fp,"%d %s PRINT_BLOCK adapt_ready_ = %s\n",CkMyPe(),name_.c_str(),adapt_ready_?"true":"false");
   fprintf (fp,"%d %s PRINT_BLOCK adapt_balanced_ = %s\n",CkMyPe(),name_.c_str(),adapt_balanced_?"true":"false");
   fprintf (fp,"%d %s PRINT_BLOCK adapt_changed_ = %d\n",CkMyPe(),name_.c_str(),adapt_changed_);
+  fprintf (fp,"%d %s PRINT_BLOCK adapt_phase_step_ = %d\n",CkMyPe(),name_.c_str(),adapt_phase_step_);
+  fprintf (fp,"%d %s PRINT_BLOCK adapt_created_ = %d\n",CkMyPe(),name_.c_str(),adapt_created_);
   fprintf (fp,"%d %s PRINT_BLOCK adapt_msg_list_.size() = %lu\n",CkMyPe(),name_.c_str(),adapt_msg_list_.size());
 
   fprintf (fp,"%d %s PRINT_BLOCK coarsened_ = %d\n",CkMyPe(),name_.c_str(),coarsened_);
@@ -721,6 +729,8 @@ Block::Block ()
     adapt_ready_(false),
     adapt_balanced_(false),
     adapt_changed_(0),
+    adapt_phase_step_(0),
+    adapt_created_(true),
     coarsened_(false),
     is_leaf_((thisIndex.level() >= 0)),
     age_(0),
@@ -1128,6 +1138,8 @@ void Block::copy_(const Block & block) throw()
   adapt_ready_ = block.adapt_ready_;
   adapt_balanced_ = block.adapt_balanced_;
   adapt_changed_ = block.adapt_changed_;
+  adapt_phase_step_ = block.adapt_phase_step_;
+  adapt_created_ = block.adapt_created_;
   coarsened_  = block.coarsened_;
 }
 
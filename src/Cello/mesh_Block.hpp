@@ -414,6 +414,8 @@ public:
   {
     performance_start_(perf_adapt_apply);
     delete msg;
+    adapt_phase_step_ = 0;
+    adapt_created_ = false;
     adapt_enter_();
     performance_stop_(perf_adapt_apply);
     performance_start_(perf_adapt_apply_sync);
@@ -493,6 +495,7 @@ protected:
   void adapt_refine_();
   void adapt_called_();
   int adapt_compute_desired_level_(int level_maximum);
+  int adapt_apply_refine_();
   void adapt_delete_child_(Index index_child);
 public:
 
@@ -569,8 +572,19 @@ public:
   /// Send flux data to neighbors
   int refresh_load_flux_faces_ (Refresh & refresh);
 
+  /// Send field face data to the neighbor, or if aggregate is true
+  /// and the neighbor is on a remote process, add it to the faces
+  /// Simulation aggregates for that process
   void refresh_load_field_face_
-  (Refresh & refresh, int refresh_type, Index index, int if3[3], int ic3[3]);
+  (Refresh & refresh, int refresh_type, Index index, int if3[3], int ic3[3],
+   bool aggregate = false);
+
+  /// Copy field face data directly into the ghost zones of a
+  /// neighbor on the same process if it is waiting for the refresh;
+  /// returns false if the face must be sent in a message instead
+  bool refresh_local_field_face_
+  (Refresh & refresh, Index index_neighbor, FieldFace * field_face);
+
   /// Send particles in list to corresponding indices
   void particle_send_(Refresh & refresh, int nl,Index index_list[],
                       ParticleData * particle_list[]);
@@ -593,6 +607,9 @@ public:
 
   void p_method_output_next (MsgOutput * msg);
   void p_method_output_write (MsgOutput * msg);
+  void p_method_output_request (Index index_send);
+  void p_method_output_send ();
+  void p_method_output_written ();
   void r_method_output_continue(CkReductionMsg * msg);
   void r_method_output_done(CkReductionMsg * msg);
 
@@ -982,6 +999,13 @@ protected: // attributes
   /// Number of blocks that have refined or coarsened in this phase
   int adapt_changed_;
 
+  /// Number of adapt steps completed in the current adapt phase
+  int adapt_phase_step_;
+
+  /// Whether the Block was created or coarsened in the current adapt
+  /// phase (reset in r_adapt_enter())
+  bool adapt_created_;
+
   /// Buffer for incoming MsgAdapt objects
   std::vector < MsgAdapt * > adapt_msg_list_;
 
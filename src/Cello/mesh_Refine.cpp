@@ -25,6 +25,45 @@ void Refine::pup (PUP::er &p)
 
 //----------------------------------------------------------------------
 
+int Refine::apply (Block * block) throw ()
+{
+  const int num_rows = tile_begin(block);
+
+  ASSERT1 ("Refine::apply",
+	   "Refine type %s must implement apply() or tile_begin()",
+	   name().c_str(),
+	   num_rows > 0);
+
+  tile_apply (0,num_rows);
+
+  return tile_end();
+}
+
+//----------------------------------------------------------------------
+
+int Refine::tile_end () const throw ()
+{
+  int adapt_result = tile_any_refine_ ?
+    adapt_refine : (tile_all_coarsen_ ? adapt_coarsen : adapt_same);
+
+  // Don't refine if already at maximum level
+  adjust_for_level_ (&adapt_result,tile_level_);
+
+  return adapt_result;
+}
+
+//----------------------------------------------------------------------
+
+void Refine::tile_initialize_ (Block * block, void * output) throw ()
+{
+  tile_level_       = block->level();
+  tile_output_      = (output != nullptr);
+  tile_any_refine_  = false;
+  tile_all_coarsen_ = true;
+}
+
+//----------------------------------------------------------------------
+
 void Refine::set_schedule (Schedule * schedule) throw()
 { 
   if (schedule_) delete schedule_;
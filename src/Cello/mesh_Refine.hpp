@@ -29,7 +29,11 @@ public: // interface
       max_level_(max_level),
       include_ghosts_(include_ghosts),
       output_(output),
-      schedule_(NULL)
+      schedule_(NULL),
+      tile_level_(0),
+      tile_output_(false),
+      tile_any_refine_(false),
+      tile_all_coarsen_(true)
   {};
 
   /// CHARM++ PUP::able declaration
@@ -44,19 +48,50 @@ public: // interface
       max_level_(0),
       include_ghosts_(false),
       output_(""),
-      schedule_(NULL)
+      schedule_(NULL),
+      tile_level_(0),
+      tile_output_(false),
+      tile_any_refine_(false),
+      tile_all_coarsen_(true)
   {}
 
   /// CHARM++ Pack / Unpack function
   void pup (PUP::er &p);
   
-  /// Evaluate the refinement criteria, updating the refinement field
-  virtual int apply (Block * block) throw ()
+  /// Evaluate the refinement criteria, updating the refinement field.
+  /// The default evaluates all rows of criteria that implement
+  /// tile_begin() and tile_apply()
+  virtual int apply (Block * block) throw ();
+
+  /// Prepare to evaluate the criteria on the Block a range of rows at
+  /// a time, returning the number of rows, or 0 if tiled evaluation
+  /// is not supported.  Rows are ordered by increasing y then z.
+  virtual int tile_begin (Block * block) throw ()
+  { return 0; }
+
+  /// Evaluate rows ir_begin <= ir < ir_end, returning early if
+  /// tile_decided() becomes true
+  virtual void tile_apply (int ir_begin, int ir_end) throw ()
+  { }
+
+  /// Return the result of rows evaluated since tile_begin()
+  int tile_end () const throw ();
+
+  /// Return whether evaluating more rows cannot change the result of
+  /// tile_end(), which requires that there be no output field
+  bool tile_decided () const throw ()
   {
-    ERROR("Refine::apply",
-	 "'Abstract' virtual function Refine::apply() should not be called");
-    return 0;
-  };
+    return (! tile_output_) &&
+      (tile_any_refine_ || ((! tile_all_coarsen_) && tile_level_ >= max_level_));
+  }
+
+  /// Return whether tile_end() will return adapt_refine
+  bool tile_refine () const throw ()
+  { return tile_any_refine_ && tile_level_ < max_level_; }
+
+  /// Return whether the criteria writes to an output field
+  bool has_output () const throw ()
+  { return output_ != ""; }
 
   /// Return the name of the refinement criteria
   virtual std::string name () const { return "unknown"; }
@@ -73,6 +108,9 @@ public: // interface
 
 protected: // functions
 
+  /// Reset the result of tiled evaluation for the Block
+  void tile_initialize_ (Block * block, void * output) throw ();
+
   /// Don't refine if already at max_level_
   void adjust_for_level_ (int * adapt_result, int level) const throw ()
   {
@@ -102,6 +140,18 @@ protected:
   /// Schedule for refinement; NULL if none
   Schedule * schedule_;
 
+  /// Level of the Block being evaluated by tile_apply() (not pupped)
+  int tile_level_;
+
+  /// Whether tile_apply() writes an output field (not pupped)
+  bool tile_output_;
+
+  /// Whether any row evaluated so far satisfies the refine condition
+  bool tile_any_refine_;
+
+  /// Whether all rows evaluated so far satisfy the coarsen condition
+  bool tile_all_coarsen_;
+
 };
 
 #endif /* MESH_REFINE_HPP */
@@ -16,7 +16,9 @@ RefineDensity::RefineDensity
  int max_level,
  bool include_ghosts,
  std::string output) throw ()
-  : Refine(min_refine,max_coarsen,max_level,include_ghosts,output)
+  : Refine(min_refine,max_coarsen,max_level,include_ghosts,output),
+    tile_values_(nullptr),
+    tile_precision_(precision_unknown)
 {
   TRACE("RefineDensity::RefineDensity");
   WARNING ("RefineDensity::RefineDensity()",
@@ -26,76 +28,75 @@ RefineDensity::RefineDensity
 
 //----------------------------------------------------------------------
 
-int RefineDensity::apply ( Block * block ) throw ()
+int RefineDensity::tile_begin ( Block * block ) throw ()
 {
-
   Field field = block->data()->field();
 
   int id = field.field_id ("density");
-  int precision = field.precision(id);
+  tile_precision_ = field.precision(id);
+  tile_values_    = field.values(id);
 
-  int mx,my,mz;
-  field.dimensions(id,&mx,&my,&mz);
-  int gx,gy,gz;
+  field.dimensions(id,&tile_m3_[0],&tile_m3_[1],&tile_m3_[2]);
   if (include_ghosts_) {
-    gx = gy = gz = 0;
+    tile_g3_[0] = tile_g3_[1] = tile_g3_[2] = 0;
   } else {
-    field.ghost_depth(id, &gx,&gy,&gz);
+    field.ghost_depth(id, &tile_g3_[0],&tile_g3_[1],&tile_g3_[2]);
   }
-  char * array = field.values(id);
 
-  int adapt_result;
+  tile_initialize_ (block,nullptr);
+
+  return (tile_m3_[1]-2*tile_g3_[1])*(tile_m3_[2]-2*tile_g3_[2]);
+}
+
+//----------------------------------------------------------------------
 
-  if (precision == precision_single) {
+void RefineDensity::tile_apply ( int ir_begin, int ir_end ) throw ()
+{
+  if (tile_precision_ == precision_single) {
 
-    adapt_result = apply_ ((const float*)      array,mx,my,mz,gx,gy,gz);
+    apply_ ((const float*)      tile_values_,ir_begin,ir_end);
 
-  } else if (precision == precision_double) {
+  } else if (tile_precision_ == precision_double) {
 
-    adapt_result = apply_ ((const double*)     array,mx,my,mz,gx,gy,gz);
+    apply_ ((const double*)     tile_values_,ir_begin,ir_end);
 
-  } else if (precision == precision_quadruple) {
+  } else if (tile_precision_ == precision_quadruple) {
 
-    adapt_result = apply_ ((const long double*)array,mx,my,mz,gx,gy,gz);
+    apply_ ((const long double*)tile_values_,ir_begin,ir_end);
 
   } else {
-    ERROR1 ("RefineDensity::apply()",
+    ERROR1 ("RefineDensity::tile_apply()",
 	   "Unrecognized precision %d\n",
-	    precision);
-    adapt_result = adapt_unknown;
+	    tile_precision_);
   }
-
-  // Don't refine if already at maximum level
-  adjust_for_level_( &adapt_result, block->level() );
-    
-  return adapt_result;
 }
 
-//----------------------------------------------------------------------s    
+//----------------------------------------------------------------------
 template <class T>
-int RefineDensity::apply_
-( const T * array,
-  int mx, int my, int mz,
-  int gx, int gy, int gz ) const throw ()
+void RefineDensity::apply_ ( const T * array, int ir_begin, int ir_end ) throw ()
 {
-
-  bool any_refine  = false;
-  bool all_coarsen = true;
-  for (int iz=gz; iz<mz-gz; iz++) {
-    for (int iy=gy; iy<my-gy; iy++) {
-      for (int ix=gx; ix<mx-gx; ix++) {
-	int i = ix + mx*(iy + my*iz);
-	if (array[i] > min_refine_)  any_refine  = true;
-	if (array[i] > max_coarsen_) all_coarsen = false;
-      }
+  const int mx = tile_m3_[0];
+  const int my = tile_m3_[1];
+  const int gx = tile_g3_[0];
+  const int gy = tile_g3_[1];
+  const int gz = tile_g3_[2];
+  const int ny = my - 2*gy;
+
+  for (int ir=ir_begin; ir<ir_end; ir++) {
+    const int iy = gy + ir % ny;
+    const int iz = gz + ir / ny;
+    const T * row = array + mx*(iy + my*iz);
+    T row_max = row[gx];
+    #pragma omp simd reduction(max:row_max)
+    for (int ix=gx; ix<mx-gx; ix++) {
+      row_max = std::max(row_max,row[ix]);
     }
-  }
-  return 
-    any_refine ?  adapt_refine :
-    (all_coarsen ? adapt_coarsen : adapt_same) ;
+    if (row_max > min_refine_)  tile_any_refine_  = true;
+    if (row_max > max_coarsen_) tile_all_coarsen_ = false;
 
+    if (tile_decided()) return;
+  }
 }
 
 
 //======================================================================
-
@@ -30,7 +30,11 @@ public: // interface
 
   PUPable_decl(RefineDensity);
 
-  RefineDensity(CkMigrateMessage *m) : Refine (m) {}
+  RefineDensity(CkMigrateMessage *m)
+    : Refine (m),
+      tile_values_(nullptr),
+      tile_precision_(precision_unknown)
+  {}
 
   /// CHARM++ Pack / Unpack function
   inline void pup (PUP::er &p)
@@ -40,17 +44,32 @@ public: // interface
     Refine::pup(p);
   }
 
-  /// Evaluate the refinement criteria, updating the refinement field
-  virtual int apply (Block * block) throw();
+  /// Prepare to evaluate the density field on the Block
+  virtual int tile_begin (Block * block) throw();
+
+  /// Compare density values in the given rows with the thresholds
+  virtual void tile_apply (int ir_begin, int ir_end) throw();
 
   virtual std::string name () const { return "density"; };
 
 private: // functions
 
   template <class T>
-  int apply_ (const T * array,
-	      int mx, int my, int mz,
-	      int gx, int gy, int gz) const throw ();
+  void apply_ (const T * array, int ir_begin, int ir_end) throw ();
+
+private: // attributes
+
+  // Block being evaluated by tile_apply() (not pupped)
+
+  /// Density field values
+  void * tile_values_;
+
+  /// Density field precision
+  int tile_precision_;
+
+  /// Density field dimensions and loop bounds
+  int tile_m3_[3];
+  int tile_g3_[3];
 
 };
 
@@ -7,8 +7,6 @@
 
 #include "mesh.hpp"
 
-// #define TRACE_REFINE_SHEAR
-
 //----------------------------------------------------------------------
 
 RefineShear::RefineShear(double min_refine,
@@ -16,105 +14,101 @@ RefineShear::RefineShear(double min_refine,
 			 int    max_level,
 			 bool   include_ghosts,
 			 std::string output) throw ()
-  : Refine (min_refine, max_coarsen, max_level, include_ghosts, output)
+  : Refine (min_refine, max_coarsen, max_level, include_ghosts, output),
+    tile_rank_(0),
+    tile_precision_(precision_unknown),
+    tile_output_values_(nullptr)
 {
 }
 
 //----------------------------------------------------------------------
 
-int RefineShear::apply ( Block * block ) throw ()
+int RefineShear::tile_begin ( Block * block ) throw ()
 {
-
   Field field = block->data()->field();
 
-  bool all_coarsen = true;
-  bool any_refine = false;
-
   int nx,ny,nz;
   field.size(&nx,&ny,&nz);
 
   int rank = nz > 1 ? 3 : (ny > 1 ? 2 : 1);
-
-  Data * data = block->data();
-  double xm[3],xp[3];
-  data->lower(&xm[0],&xm[1],&xm[2]);
-  data->upper(&xp[0],&xp[1],&xp[2]);
+  tile_rank_ = rank;
 
   int id_velocity = field.field_id("velocity_x");
 
-  void * velocity_x = 0;
-  void * velocity_y = 0;
-  void * velocity_z = 0;
+  tile_v3_[0] = (rank >= 1) ? field.values("velocity_x") : nullptr;
+  tile_v3_[1] = (rank >= 2) ? field.values("velocity_y") : nullptr;
+  tile_v3_[2] = (rank >= 3) ? field.values("velocity_z") : nullptr;
 
-  if (rank >= 1) velocity_x = field.values("velocity_x");
-  if (rank >= 2) velocity_y = field.values("velocity_y");
-  if (rank >= 3) velocity_z = field.values("velocity_z");
-   
   int gx,gy,gz;
   field.ghost_depth(id_velocity, &gx,&gy,&gz);
 
-  int nxd = nx + 2*gx;
-  int nyd = ny + 2*gy;
-  int nzd = nz + 2*gz;
+  tile_m3_[0] = nx + 2*gx;
+  tile_m3_[1] = ny + 2*gy;
+  tile_m3_[2] = nz + 2*gz;
 
   if (rank < 2) gy = 0;
   if (rank < 3) gz = 0;
 
-  void * output = initialize_output_(field.field_data());
+  tile_n3_[0] = nx;
+  tile_n3_[1] = ny;
+  tile_n3_[2] = nz;
+  tile_g3_[0] = gx;
+  tile_g3_[1] = gy;
+  tile_g3_[2] = gz;
+
+  tile_output_values_ = initialize_output_(field.field_data());
+  tile_initialize_ (block,tile_output_values_);
 
-  precision_type precision = field.precision(id_velocity);
+  tile_precision_ = field.precision(id_velocity);
+
+  return ny*nz;
+}
+
+//----------------------------------------------------------------------
 
-  switch (precision) {
+void RefineShear::tile_apply ( int ir_begin, int ir_end ) throw ()
+{
+  switch (tile_precision_) {
   case precision_single:
-    evaluate_block_((const float*)velocity_x,
-		    (const float*)velocity_y,
-		    (const float*)velocity_z,
-		    (float*)output,
-		    nxd,nyd,nzd,nx,ny,nz,gx,gy,gz,
-		    &any_refine,&all_coarsen, rank);
+    evaluate_rows_((const float*)tile_v3_[0],
+		   (const float*)tile_v3_[1],
+		   (const float*)tile_v3_[2],
+		   (float*)tile_output_values_,
+		   ir_begin,ir_end);
     break;
   case precision_double:
-    evaluate_block_((const double*)velocity_x,
-		    (const double*)velocity_y,
-		    (const double*)velocity_z,
-		    (double*)output,
-		    nxd,nyd,nzd,nx,ny,nz,gx,gy,gz,
-		    &any_refine,&all_coarsen, rank);
+    evaluate_rows_((const double*)tile_v3_[0],
+		   (const double*)tile_v3_[1],
+		   (const double*)tile_v3_[2],
+		   (double*)tile_output_values_,
+		   ir_begin,ir_end);
     break;
   default:
-    ERROR1("RefineShear::apply",
+    ERROR1("RefineShear::tile_apply",
 	   "Unknown precision %d for velocity_x field",
-	   precision);
+	   tile_precision_);
     break;
   }
-
-  int adapt_result =  
-    any_refine ? adapt_refine : (all_coarsen ? adapt_coarsen : adapt_same);
-
-  // Don't refine if already at maximum level
-  adjust_for_level_( &adapt_result, block->level() );
-
-  return adapt_result;
-
 }
 
 //----------------------------------------------------------------------
 
 template <class T>
-void RefineShear::evaluate_block_(const T * u,
-				  const T * v,
-				  const T * w,
-				  T * output,
-				  int ndx, int ndy, int ndz,
-				  int nx, int ny, int nz,
-				  int gx, int gy, int gz,
-				  bool *any_refine,
-				  bool * all_coarsen, 
-				  int rank)
+void RefineShear::evaluate_rows_(const T * u,
+				 const T * v,
+				 const T * w,
+				 T * output,
+				 int ir_begin, int ir_end)
 {
-  T shear;
-  T uy = 0, vz = 0, wx = 0;
-  T uz = 0, vx = 0, wy = 0;
+  const int rank = tile_rank_;
+  const int ndx = tile_m3_[0];
+  const int ndy = tile_m3_[1];
+  const int nx = tile_n3_[0];
+  const int ny = tile_n3_[1];
+  const int gx = tile_g3_[0];
+  const int gy = tile_g3_[1];
+  const int gz = tile_g3_[2];
+
   const int kx = 1;
   const int ky = (rank >= 2) ? ndx : 0;
   const int kz = (rank >= 3) ? ndx*ndy : 0;
@@ -122,43 +116,36 @@ void RefineShear::evaluate_block_(const T * u,
   // Compute inner-product of shear vector.  Note works for
   // rank = 1, 2, 3 since 
 
-#ifdef TRACE_REFINE_SHEAR
-  T min_shear = std::numeric_limits<T>::max();
-  T max_shear = -std::numeric_limits<T>::max();
-#endif
-  for (int iz=gz; iz<nz+gz; iz++) {
-    for (int iy=gy; iy<ny+gy; iy++) {
-      for (int ix=gx; ix<nx+gx; ix++) {
-	int i = ix + ndx*(iy + ndy*iz);
-	if (rank >= 2) {
-	  uy = u[i+ky] - u[i-ky]; uy *= uy;
-	  vx = v[i+kx] - v[i-kx]; vx *= vx;
-	} 
-	if (rank >= 3) {
-	  uz = u[i+kz] - u[i-kz]; uz *= uz;
-	  vz = v[i+kz] - v[i-kz]; vz *= vz;
-	  wx = w[i+kx] - w[i-kx]; wx *= wx;
-	  wy = w[i+ky] - w[i-ky]; wy *= wy;
-	}
-	shear = uy + uz + vx + vz + wx + wy;
-#ifdef TRACE_REFINE_SHEAR
-	min_shear = std::min(min_shear,shear);
-	max_shear = std::max(max_shear,shear);
-#endif
-	if (shear > min_refine_)  *any_refine  = true;
-	if (shear > max_coarsen_) *all_coarsen = false;
-	if (output) {
-	  if (shear > max_coarsen_) output[i] =  0;
-	  if (shear > min_refine_)  output[i] = +1;
-	}
+  for (int ir=ir_begin; ir<ir_end; ir++) {
+    const int iy = gy + ir % ny;
+    const int iz = gz + ir / ny;
+    const int i0 = ndx*(iy + ndy*iz);
+    T shear_max = 0.0;
+    for (int ix=gx; ix<nx+gx; ix++) {
+      int i = i0 + ix;
+      T uy = 0, vz = 0, wx = 0;
+      T uz = 0, vx = 0, wy = 0;
+      if (rank >= 2) {
+	uy = u[i+ky] - u[i-ky]; uy *= uy;
+	vx = v[i+kx] - v[i-kx]; vx *= vx;
+      } 
+      if (rank >= 3) {
+	uz = u[i+kz] - u[i-kz]; uz *= uz;
+	vz = v[i+kz] - v[i-kz]; vz *= vz;
+	wx = w[i+kx] - w[i-kx]; wx *= wx;
+	wy = w[i+ky] - w[i-ky]; wy *= wy;
+      }
+      const T shear = uy + uz + vx + vz + wx + wy;
+      shear_max = std::max(shear_max,shear);
+      if (output) {
+	if (shear > max_coarsen_) output[i] =  0;
+	if (shear > min_refine_)  output[i] = +1;
       }
     }
+    if (shear_max > min_refine_)  tile_any_refine_  = true;
+    if (shear_max > max_coarsen_) tile_all_coarsen_ = false;
+
+    if (tile_decided()) return;
   }
-#ifdef TRACE_REFINE_SHEAR
-  CkPrintf ("%s:%d TRACE_REFINE_SHEAR %s %f %f (%f %f)\n",
-    __FILE__,__LINE__,block_temp_->name().c_str(),min_shear,max_shear,
-    max_coarsen_, min_refine_);
-#endif  
 }
 //======================================================================
-
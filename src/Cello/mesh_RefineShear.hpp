@@ -29,7 +29,12 @@ public: // interface
 
   PUPable_decl(RefineShear);
 
-  RefineShear(CkMigrateMessage *m) : Refine (m) {}
+  RefineShear(CkMigrateMessage *m)
+    : Refine (m),
+      tile_rank_(0),
+      tile_precision_(precision_unknown),
+      tile_output_values_(nullptr)
+  {}
 
   /// CHARM++ Pack / Unpack function
   inline void pup (PUP::er &p)
@@ -39,24 +44,43 @@ public: // interface
     Refine::pup(p);
   }
 
-  /// Evaluate the refinement criteria, updating the refinement field
-  virtual int apply (Block * block) throw();
+  /// Prepare to evaluate the velocity shear on the Block
+  virtual int tile_begin (Block * block) throw();
+
+  /// Evaluate the velocity shear in the given rows
+  virtual void tile_apply (int ir_begin, int ir_end) throw();
 
   virtual std::string name () const { return "shear"; };
 
 private: // functions
 
   template <class T>
-  void evaluate_block_(const T * u,
-		       const T * v,
-		       const T * w,
-		       T * output,
-		       int ndx, int ndy, int ndz,
-		       int nx, int ny, int nz,
-		       int gx, int gy, int gz,
-		       bool *any_refine,
-		       bool * all_coarsen, 
-		       int rank);
+  void evaluate_rows_(const T * u,
+		      const T * v,
+		      const T * w,
+		      T * output,
+		      int ir_begin, int ir_end);
+
+private: // attributes
+
+  // Block being evaluated by tile_apply() (not pupped)
+
+  /// Rank of the Block
+  int tile_rank_;
+
+  /// Velocity field precision
+  int tile_precision_;
+
+  /// Velocity field values
+  void * tile_v3_[3];
+
+  /// Output field values if any
+  void * tile_output_values_;
+
+  /// Field dimensions, active size, and loop offsets
+  int tile_m3_[3];
+  int tile_n3_[3];
+  int tile_g3_[3];
 };
 
 #endif /* MESH_REFINE_SHEAR_HPP */
@@ -15,7 +15,11 @@ RefineSlope::RefineSlope(double min_refine,
 			 int max_level,
 			 bool include_ghosts,
 			 std::string output) throw ()
-  : Refine (min_refine, max_coarsen, max_level, include_ghosts, output)
+  : Refine (min_refine, max_coarsen, max_level, include_ghosts, output),
+    field_id_list_(),
+    tile_num_rows_(0),
+    tile_rank_(0),
+    tile_output_values_(nullptr)
 {
   FieldDescr * field_descr = cello::field_descr();
   if (field_name_list.size() != 0) {
@@ -33,119 +37,156 @@ RefineSlope::RefineSlope(double min_refine,
 
 //----------------------------------------------------------------------
 
-int RefineSlope::apply ( Block * block ) throw ()
+int RefineSlope::tile_begin ( Block * block ) throw ()
 {
-
   Field field = block->data()->field();
 
-  bool all_coarsen = true;
-  bool any_refine = false;
-
-  int rank = cello::rank();
+  tile_rank_ = cello::rank();
 
-  double h3[3];
   Data * data = block->data();
   double xm[3],xp[3];
   data->lower(&xm[0],&xm[1],&xm[2]);
   data->upper(&xp[0],&xp[1],&xp[2]);
-  field.cell_width(xm[0],xp[0],&h3[0]);
-  field.cell_width(xm[1],xp[1],&h3[1]);
-  field.cell_width(xm[2],xp[2],&h3[2]);
+  field.cell_width(xm[0],xp[0],&tile_h3_[0]);
+  field.cell_width(xm[1],xp[1],&tile_h3_[1]);
+  field.cell_width(xm[2],xp[2],&tile_h3_[2]);
 
-  void * output = initialize_output_(field.field_data());
+  tile_output_values_ = initialize_output_(field.field_data());
+  tile_initialize_ (block,tile_output_values_);
 
-  for (size_t k=0; k<field_id_list_.size(); k++) {
+  const int nf = field_id_list_.size();
+  tile_values_.resize(nf);
+  tile_precision_.resize(nf);
+  tile_m3_.resize(3*nf);
+  tile_g3_.resize(3*nf);
+
+  tile_num_rows_ = 0;
+  for (int k=0; k<nf; k++) {
 
     int id_field = field_id_list_[k];
 
-    int gx,gy,gz;
+    int * m3 = &tile_m3_[3*k];
+    int * g3 = &tile_g3_[3*k];
     if (include_ghosts_) {
-      gx = (rank >= 1) ? 1 : 0;
-      gy = (rank >= 2) ? 1 : 0;
-      gz = (rank >= 3) ? 1 : 0;
+      g3[0] = (tile_rank_ >= 1) ? 1 : 0;
+      g3[1] = (tile_rank_ >= 2) ? 1 : 0;
+      g3[2] = (tile_rank_ >= 3) ? 1 : 0;
     } else {
-      field.ghost_depth(id_field, &gx,&gy,&gz);
+      field.ghost_depth(id_field, &g3[0],&g3[1],&g3[2]);
     }
+    field.dimensions(id_field,&m3[0],&m3[1],&m3[2]);
+
+    tile_values_[k]    = field.values(id_field);
+    tile_precision_[k] = field.precision(id_field);
+
+    const int num_rows = (m3[1]-2*g3[1])*(m3[2]-2*g3[2]);
+    tile_num_rows_ = std::max(tile_num_rows_,num_rows);
+  }
 
-    int mx,my,mz;
-    field.dimensions(id_field,&mx,&my,&mz);
+  return tile_num_rows_;
+}
+
+//----------------------------------------------------------------------
+
+void RefineSlope::tile_apply ( int ir_begin, int ir_end ) throw ()
+{
+  for (size_t k=0; k<field_id_list_.size(); k++) {
 
-    precision_type precision = field.precision(id_field);
+    // rows of this field corresponding to the requested rows
 
-    void * array = field.values(id_field);
-   
-    // count number of times slope refine and coarsen conditions are satisified
-    switch (precision) {
+    const int * m3 = &tile_m3_[3*k];
+    const int * g3 = &tile_g3_[3*k];
+    const long long num_rows = (m3[1]-2*g3[1])*(m3[2]-2*g3[2]);
+    const int jr_begin = (num_rows*ir_begin) / tile_num_rows_;
+    const int jr_end   = (num_rows*ir_end)   / tile_num_rows_;
+
+    void * array = tile_values_[k];
+    void * output = tile_output_values_;
+
+    switch (tile_precision_[k]) {
     case precision_single:
-      evaluate_block_((float*) array,
-		      (float*) output, 
-		      mx,my,mz,gx,gy,gz,
-		      &any_refine,&all_coarsen, rank,h3);
+      evaluate_rows_((const float*) array, (float*) output, k,
+		     jr_begin,jr_end);
       break;
     case precision_double:
-      evaluate_block_((double*) array,
-		      (double*) output,
-		      mx,my,mz,gx,gy,gz,
-		      &any_refine,&all_coarsen, rank,h3);
+      evaluate_rows_((const double*) array, (double*) output, k,
+		     jr_begin,jr_end);
       break;
     case precision_quadruple:
-      evaluate_block_((long double*) array,
-		      (long double*) output,
-		      mx,my,mz,gx,gy,gz,
-		      &any_refine,&all_coarsen, rank,h3);
+      evaluate_rows_((const long double*) array, (long double*) output, k,
+		     jr_begin,jr_end);
       break;
     default:
-      ERROR2("RefineSlope::apply",
+      ERROR2("RefineSlope::tile_apply",
 	     "Unknown precision %d for field %d",
-	     precision,0);
+	     tile_precision_[k],field_id_list_[k]);
       break;
     }
+    if (tile_decided()) return;
   }
-
-  int adapt_result =
-    any_refine ? adapt_refine : (all_coarsen ? adapt_coarsen : adapt_same);
-
-  // Don't refine if already at maximum level
-  adjust_for_level_ (&adapt_result,block->level());
-
-  return adapt_result;
-
 }
 
 //----------------------------------------------------------------------
 
 template <class T>
-void RefineSlope::evaluate_block_(T * array, T * output ,
-				  int mx, int my, int mz,
-				  int gx, int gy, int gz,
-				  bool *any_refine,
-				  bool * all_coarsen, 
-				  int rank, 
-				  double * h3 )
+void RefineSlope::evaluate_rows_(const T * array, T * output, int k,
+				 int ir_begin, int ir_end)
 {
-  T slope;
+  const int mx = tile_m3_[3*k+0];
+  const int my = tile_m3_[3*k+1];
+  const int gx = tile_g3_[3*k+0];
+  const int gy = tile_g3_[3*k+1];
+  const int gz = tile_g3_[3*k+2];
+  const int ny = my - 2*gy;
+
+  const int rank = tile_rank_;
   const int d3[3] = {1,mx,mx*my};
-  T tiny = 1e-10;
-  int count=0;
-  for (int axis=0; axis<rank; axis++) {
-    int id = d3[axis];
-    for (int iz=gz; iz<mz-gz; iz++) {
-      for (int iy=gy; iy<my-gy; iy++) {
-	for (int ix=gx; ix<mx-gx; ix++) {
-	  int i = ix + mx*(iy + my*iz);
-	  T a = std::max(T(2.0*h3[axis]*fabs(array[i])),tiny);
-	  slope = fabs( (array[i+id] - array[i-id]) / a);
-	  count++;
-	  if (slope > min_refine_)  *any_refine  = true;
-	  if (slope > max_coarsen_) *all_coarsen = false;
-	  if (output) {
-	    if (slope > max_coarsen_) output[i] =  0;
-	    if (slope > min_refine_)  output[i] = +1;
-	  }
+  const T tiny = 1e-10;
+  const T h2[3] = {T(2.0*tile_h3_[0]), T(2.0*tile_h3_[1]), T(2.0*tile_h3_[2])};
+
+  for (int ir=ir_begin; ir<ir_end; ir++) {
+
+    const int iy = gy + ir % ny;
+    const int iz = gz + ir / ny;
+    const int i0 = mx*(iy + my*iz);
+
+    // maximum slope of any cell along any axis in the row
+    T slope_max = 0.0;
+
+    if (output == nullptr) {
+      #pragma omp simd reduction(max:slope_max)
+      for (int ix=gx; ix<mx-gx; ix++) {
+	const int i = i0 + ix;
+	const T a = array[i];
+	for (int axis=0; axis<rank; axis++) {
+	  const int id = d3[axis];
+	  const T slope = fabs((array[i+id] - array[i-id]) /
+			       std::max(T(h2[axis]*fabs(a)),tiny));
+	  slope_max = std::max(slope_max,slope);
 	}
       }
+    } else {
+      for (int ix=gx; ix<mx-gx; ix++) {
+	const int i = i0 + ix;
+	const T a = array[i];
+	T slope_cell = 0.0;
+	for (int axis=0; axis<rank; axis++) {
+	  const int id = d3[axis];
+	  const T slope = fabs((array[i+id] - array[i-id]) /
+			       std::max(T(h2[axis]*fabs(a)),tiny));
+	  slope_cell = std::max(slope_cell,slope);
+	}
+	// output is the maximum over all axes and fields
+	if (slope_cell > max_coarsen_) output[i] = std::max(output[i],T(0));
+	if (slope_cell > min_refine_)  output[i] = +1;
+	slope_max = std::max(slope_max,slope_cell);
+      }
     }
+
+    if (slope_max > min_refine_)  tile_any_refine_  = true;
+    if (slope_max > max_coarsen_) tile_all_coarsen_ = false;
+
+    if (tile_decided()) return;
   }
 }
 //======================================================================
-
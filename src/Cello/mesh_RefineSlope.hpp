@@ -30,7 +30,13 @@ public: // interface
 
   PUPable_decl(RefineSlope);
 
-  RefineSlope(CkMigrateMessage *m) : Refine (m) {}
+  RefineSlope(CkMigrateMessage *m)
+    : Refine (m),
+      field_id_list_(),
+      tile_num_rows_(0),
+      tile_rank_(0),
+      tile_output_values_(nullptr)
+  {}
 
   /// CHARM++ Pack / Unpack function
   inline void pup (PUP::er &p)
@@ -41,27 +47,51 @@ public: // interface
     p | field_id_list_;
   }
 
-  /// Evaluate the refinement criteria, updating the refinement field
-  virtual int apply (Block * block) throw();
+  /// Prepare to evaluate the slopes of all fields on the Block
+  virtual int tile_begin (Block * block) throw();
+
+  /// Evaluate the slopes along all axes of all fields in the given rows
+  virtual void tile_apply (int ir_begin, int ir_end) throw();
 
   virtual std::string name () const { return "slope"; };
 
 private: // functions
 
+  /// Evaluate rows ir_begin <= ir < ir_end of the field with index k
+  /// in field_id_list_, with all axes evaluated in a single sweep
   template <class T>
-  void evaluate_block_(T * array,  T * output,
-		       int ndx, int ndy, int ndz,
-		       int gx, int gy, int gz,
-		       bool * any_refine,
-		       bool * all_coarsen, 
-		       int rank, 
-		       double * h3);
+  void evaluate_rows_(const T * array,  T * output, int k,
+		      int ir_begin, int ir_end);
 
 private: // attributes
 
   /// List of field id's
   std::vector <int> field_id_list_;
 
+  //--------------------------------------------------
+  // Block being evaluated by tile_apply() (not pupped)
+  //--------------------------------------------------
+
+  /// Maximum number of rows over all fields
+  int tile_num_rows_;
+
+  /// Rank of the Block
+  int tile_rank_;
+
+  /// Cell widths of the Block
+  double tile_h3_[3];
+
+  /// Output field values if any
+  void * tile_output_values_;
+
+  /// Field values and precision for each field in field_id_list_
+  std::vector<void *> tile_values_;
+  std::vector<int> tile_precision_;
+
+  /// Field dimensions and loop bounds for each field in field_id_list_
+  std::vector<int> tile_m3_;
+  std::vector<int> tile_g3_;
+
   
 };
 
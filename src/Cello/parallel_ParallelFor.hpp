@@ -0,0 +1,93 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     parallel_ParallelFor.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    [\ref Parallel] Declaration and implementation of ParallelFor
+///
+/// ParallelFor splits a loop over a range of indices (typically the
+/// z-slabs of a Block) into contiguous chunks that are evaluated
+/// concurrently by worker threads within the same process.  When
+/// Charm++ is built in SMP mode chunks are scheduled using the CkLoop
+/// library, which borrows otherwise idle PEs on the node; otherwise,
+/// or when only one thread per Block is requested, the loop is
+/// evaluated serially by the calling PE.
+///
+/// The number of threads used per Block is set from the
+/// "Performance:threads_per_block" parameter.
+
+#ifndef PARALLEL_PARALLEL_FOR_HPP
+#define PARALLEL_PARALLEL_FOR_HPP
+
+#ifdef CONFIG_SMP_MODE
+#  include "CkLoopAPI.h"
+#endif
+
+class ParallelFor {
+
+  /// @class    ParallelFor
+  /// @ingroup  Parallel
+  /// @brief    [\ref Parallel] Evaluate loops over z-slabs concurrently
+
+public: // interface
+
+  /// Return the number of threads used to evaluate a loop
+  static int num_threads()
+  { return num_threads_(); }
+
+  /// Set the number of threads used to evaluate a loop.  Values greater
+  /// than one are ignored unless Charm++ is built in SMP mode.
+  static void set_num_threads (int num_threads)
+  {
+#ifdef CONFIG_SMP_MODE
+    num_threads_() = std::max(num_threads,1);
+#else
+    num_threads_() = 1;
+#endif
+  }
+
+  /// Evaluate f(i_start,i_stop) over disjoint subranges [i_start,i_stop)
+  /// that together cover [start,stop).  Returns after all subranges have
+  /// been evaluated.  `f` must be safe to call concurrently on disjoint
+  /// subranges.
+  template <class F>
+  static void apply (int start, int stop, const F & f)
+  {
+    const int n = stop - start;
+    if (n <= 0) return;
+    const int num_chunks = std::min(num_threads(), n);
+    if (num_chunks <= 1) {
+      f(start,stop);
+    } else {
+#ifdef CONFIG_SMP_MODE
+      // CkLoop index ranges are inclusive
+      CkLoop_Parallelize (apply_chunk_<F>, 1, (void*) &f,
+                          num_chunks, start, stop - 1);
+#else
+      f(start,stop);
+#endif
+    }
+  }
+
+private: // functions
+
+  /// Storage for the number of threads, shared by all PEs in the process
+  static int & num_threads_()
+  {
+    static int num_threads = 1;
+    return num_threads;
+  }
+
+  /// CkLoop helper function: evaluate the function object for the
+  /// inclusive chunk [first,last]
+  template <class F>
+  static void apply_chunk_ (int first, int last, void * result,
+                            int num_param, void * param)
+  {
+    const F & f = *((const F *) param);
+    f(first,last + 1);
+  }
+
+};
+
+#endif /* PARALLEL_PARALLEL_FOR_HPP */
@@ -30,6 +30,7 @@ void Config::pup (PUP::er &p)
   p | adapt_list;
   p | adapt_interval;
   p | adapt_min_face_rank;
+  p | adapt_max_steps;
   p | adapt_type;
   p | adapt_field_list;
   p | adapt_min_refine;
@@ -133,11 +134,19 @@ void Config::pup (PUP::er &p)
   p | method_particle_list;
   PUParray (p,method_output_blocking,3);
   p | method_output_all_blocks;
+  p | method_output_concurrent;
+  p | method_output_window;
+  p | method_compress;
+  p | method_compress_level;
+  p | method_compress_shuffle;
+  p | method_quantize_fields;
+  p | method_quantize_digits;
   p | method_prolong;
   p | method_ghost_depth;
   p | method_min_face_rank;
   p | method_all_fields;
   p | method_all_particles;
+  p | method_refresh_aggregate;
 
   p | method_timestep;
   p | method_trace_name;
@@ -211,6 +220,7 @@ void Config::pup (PUP::er &p)
   p | performance_papi_counters;
   p | performance_projections_on_at_start;
   p | performance_warnings;
+  p | performance_threads_per_block;
   p | performance_on_schedule_index;
   p | performance_off_schedule_index;
 
@@ -308,6 +318,11 @@ void Config::read_adapt_ (Parameters * p) throw()
   adapt_schedule_index .resize(num_adapt);
 
   adapt_min_face_rank = p->value_integer("Adapt:min_face_rank",0);
+  adapt_max_steps = p->value_integer("Adapt:max_steps",1);
+
+  ASSERT1 ("Config::read_adapt_()",
+	   "Adapt:max_steps = %d must be at least 1",
+	   adapt_max_steps, adapt_max_steps >= 1);
 
   for (int ia=0; ia<num_adapt; ia++) {
 
@@ -808,11 +823,19 @@ void Config::read_method_ (Parameters * p) throw()
   method_output_blocking[1].resize(num_method);
   method_output_blocking[2].resize(num_method);
   method_output_all_blocks.resize(num_method);
+  method_output_concurrent.resize(num_method);
+  method_output_window.resize(num_method);
+  method_compress.resize(num_method);
+  method_compress_level.resize(num_method);
+  method_compress_shuffle.resize(num_method);
+  method_quantize_fields.resize(num_method);
+  method_quantize_digits.resize(num_method);
   method_prolong.resize(num_method);
   method_ghost_depth.resize(num_method);
   method_min_face_rank.resize(num_method);
   method_all_fields.resize(num_method);
   method_all_particles.resize(num_method);
+  method_refresh_aggregate.resize(num_method);
   method_timestep.resize(num_method);
   method_schedule_index.resize(num_method);
   method_close_files_seconds_stagger.resize(num_method);
@@ -944,6 +967,36 @@ void Config::read_method_ (Parameters * p) throw()
     }
     method_output_all_blocks[index_method] =
       p->value_logical(full_name+":all_blocks",true);
+    method_output_concurrent[index_method] =
+      p->value_logical(full_name+":concurrent",false);
+    method_output_window[index_method] =
+      p->value_integer(full_name+":window",8);
+
+    // Read compression filters (MethodOutput and EnzoMethodCheck)
+    method_compress[index_method] =
+      p->value_string(full_name+":compress","none");
+    method_compress_level[index_method] =
+      p->value_integer(full_name+":compress_level",0);
+    method_compress_shuffle[index_method] =
+      p->value_logical(full_name+":compress_shuffle",true);
+
+    // load pairs of fields (or field groups) and decimal digits kept
+    std::string quantize_name = full_name + ":quantize";
+    if (p->type(quantize_name) == parameter_list) {
+      int list_length = p->list_length(quantize_name);
+      ASSERT1("Config::read",
+              "The list assigned to %s must have an even length",
+              quantize_name.c_str(),
+              (list_length % 2 == 0));
+      for (int i=0; i<list_length; i+=2) {
+        method_quantize_fields[index_method].push_back
+          (p->list_value_string(i, quantize_name));
+        method_quantize_digits[index_method].push_back
+          (p->list_value_integer(i+1, quantize_name, -1));
+      }
+    } else if (p->param(quantize_name) != nullptr) {
+      ERROR1("Config::read", "%s has an invalid type", quantize_name.c_str());
+    }
 
     method_prolong[index_method] =
       p->value_string(full_name+":prolong","linear");
@@ -957,6 +1010,8 @@ void Config::read_method_ (Parameters * p) throw()
       p->value_logical(full_name+":all_fields",false);
     method_all_particles[index_method] =
       p->value_logical(full_name+":all_particles",false);
+    method_refresh_aggregate[index_method] =
+      p->value_logical(full_name+":refresh_aggregate",false);
 
     // Read specified timestep, if any (for MethodTrace)
     method_timestep[index_method] = p->value_float
@@ -1447,6 +1502,14 @@ void Config::read_performance_ (Parameters * p) throw()
 
   performance_warnings = p->value_logical("Performance:warnings",false);
 
+  performance_threads_per_block = p->value_integer
+    ("Performance:threads_per_block",1);
+
+  ASSERT1("Config::read_performance_()",
+          "Performance:threads_per_block = %d must be at least 1",
+          performance_threads_per_block,
+          performance_threads_per_block >= 1);
+
 #ifdef CONFIG_USE_PROJECTIONS
   
   int i_on = -1;
@@ -27,6 +27,7 @@ public: // interface
     adapt_list(),
     adapt_interval(0),
     adapt_min_face_rank(0),
+    adapt_max_steps(1),
     adapt_type(),
     adapt_field_list(),
     adapt_min_refine(),
@@ -98,11 +99,19 @@ public: // interface
     method_particle_list(),
     method_output_blocking(),
     method_output_all_blocks(),
+    method_output_concurrent(),
+    method_output_window(),
+    method_compress(),
+    method_compress_level(),
+    method_compress_shuffle(),
+    method_quantize_fields(),
+    method_quantize_digits(),
     method_prolong(),
     method_ghost_depth(),
     method_min_face_rank(),
     method_all_fields(),
     method_all_particles(),
+    method_refresh_aggregate(),
     method_timestep(),
     method_trace_name(),
     method_type(),
@@ -160,6 +169,7 @@ public: // interface
     performance_papi_counters(),
     performance_projections_on_at_start(true),
     performance_warnings(false),
+    performance_threads_per_block(1),
     performance_on_schedule_index(-1),
     performance_off_schedule_index(-1),
     num_physics(0),
@@ -203,6 +213,7 @@ public: // interface
       adapt_list(),
       adapt_interval(0),
       adapt_min_face_rank(0),
+      adapt_max_steps(1),
       adapt_type(),
       adapt_field_list(),
       adapt_min_refine(),
@@ -274,11 +285,19 @@ public: // interface
       method_particle_list(),
       method_output_blocking(),
       method_output_all_blocks(),
+      method_output_concurrent(),
+      method_output_window(),
+      method_compress(),
+      method_compress_level(),
+      method_compress_shuffle(),
+      method_quantize_fields(),
+      method_quantize_digits(),
       method_prolong(),
       method_ghost_depth(),
       method_min_face_rank(),
       method_all_fields(),
       method_all_particles(),
+      method_refresh_aggregate(),
       method_timestep(),
       method_trace_name(),
       method_type(),
@@ -335,6 +354,7 @@ public: // interface
       performance_papi_counters(),
       performance_projections_on_at_start(true),
       performance_warnings(false),
+      performance_threads_per_block(1),
       performance_on_schedule_index(-1),
       performance_off_schedule_index(-1),
       num_physics(0),
@@ -392,6 +412,7 @@ public: // attributes
   std::vector <std::string>  adapt_list;
   int                        adapt_interval;
   int                        adapt_min_face_rank;
+  int                        adapt_max_steps;
   std::vector <std::string>  adapt_type;
   std::vector 
   < std::vector<std::string> > adapt_field_list;
@@ -504,11 +525,19 @@ public: // attributes
   std::vector< std::vector< std::string > > method_particle_list;
   std::vector< int >         method_output_blocking[3];
   std::vector< bool >        method_output_all_blocks;
+  std::vector< bool >        method_output_concurrent;
+  std::vector< int >         method_output_window;
+  std::vector<std::string>   method_compress;
+  std::vector<int>           method_compress_level;
+  std::vector<bool>          method_compress_shuffle;
+  std::vector<std::vector<std::string>> method_quantize_fields;
+  std::vector<std::vector<int>>         method_quantize_digits;
   std::vector<std::string>   method_prolong;
   std::vector<int>           method_ghost_depth;
   std::vector<int>           method_min_face_rank;
   std::vector<int>           method_all_fields;
   std::vector<int>           method_all_particles;
+  std::vector<int>           method_refresh_aggregate;
 
   std::vector<double>        method_timestep;
   std::vector<std::string>   method_trace_name;
@@ -586,6 +615,7 @@ public: // attributes
   std::vector<std::string>   performance_papi_counters;
   bool                       performance_projections_on_at_start;
   bool                       performance_warnings;
+  int                        performance_threads_per_block;
   int                        performance_on_schedule_index;
   int                        performance_off_schedule_index;
 
@@ -92,8 +92,10 @@ void Param::pup (PUP::er &p)
     }
   } else if (type_ == parameter_logical_expr) {
     pup_expr_(p,&value_expr_);
+    if (up) compile_expr_();
   } else if (type_ == parameter_float_expr) {
     pup_expr_(p,&value_expr_);
+    if (up) compile_expr_();
   } else if (type_ == parameter_unknown) {
     WARNING("Param::pup","parameter type is unknown");
   }
@@ -217,6 +219,8 @@ void Param::dealloc_()
   case parameter_logical_expr:
   case parameter_float_expr:
     dealloc_node_expr_(value_expr_);
+    delete code_;
+    code_ = nullptr;
     break;
   case parameter_unknown:
   case parameter_integer:
@@ -331,6 +335,13 @@ void Param::evaluate_float
 /// @param z Array of Z spatial values
 /// @param t time value
 {
+  if (node == 0 && code_ != nullptr) {
+    // evaluate the whole expression using its compiled form
+    value_accessed_ = true;
+    code_->evaluate_float(n,result,x,y,z,t);
+    return;
+  }
+
   if (node == 0) node = value_expr_;
 
   double * left  = NULL;
@@ -434,6 +445,13 @@ void Param::evaluate_logical
 /// @param z Array of Z spatial values
 /// @param t Array of time values
 {
+  if (node == 0 && code_ != nullptr) {
+    // evaluate the whole expression using its compiled form
+    value_accessed_ = true;
+    code_->evaluate_logical(n,result,x,y,z,t);
+    return;
+  }
+
   if (node == 0) node = value_expr_;
 
   double * left_float  = NULL;
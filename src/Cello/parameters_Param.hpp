@@ -58,7 +58,8 @@ public: // interface
   /// Initialize a Param object
   Param () 
     : type_(parameter_unknown),
-      value_accessed_(false)
+      value_accessed_(false),
+      code_(nullptr)
   {};
 
   /// Delete a Param object
@@ -68,7 +69,8 @@ public: // interface
   /// Copy constructor
   Param(const Param & param) throw()
     : type_(parameter_unknown),
-      value_accessed_(false)
+      value_accessed_(false),
+      code_(nullptr)
   { INCOMPLETE("Param::Param"); };
 
   /// Assignment operator
@@ -194,6 +196,7 @@ private: // functions
   { 
     type_ = parameter_float_expr;
     value_expr_     = value; 
+    compile_expr_();
   };
 
   /// Set a logical expression parameter
@@ -201,8 +204,21 @@ private: // functions
   { 
     type_ = parameter_logical_expr;
     value_expr_     = value; 
+    compile_expr_();
   };
 
+  /// Compile value_expr_ into code_ for evaluate_float() and
+  /// evaluate_logical()
+  void compile_expr_ ()
+  {
+    delete code_;
+    code_ = new ParamCode (value_expr_, type_ == parameter_logical_expr);
+    if (! code_->is_valid()) {
+      delete code_;
+      code_ = nullptr;
+    }
+  }
+
   /// Deallocate the parameter
   void dealloc_();
 
@@ -241,6 +257,9 @@ private: // attributes
     struct node_expr * value_expr_;
   };
 
+  /// Compiled form of value_expr_ for expression parameters
+  ParamCode * code_;
+
 };
 
 //----------------------------------------------------------------------
@@ -0,0 +1,320 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     parameters_ParamCode.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    Implementation of the ParamCode class
+
+#include "cello.hpp"
+
+#include "parameters.hpp"
+
+/// Instruction op for applying a function to operand a
+#define OP_FUNCTION -1
+
+/// Number of operands reserved for the x,y,z arrays
+#define NUM_ARRAYS 3
+
+//----------------------------------------------------------------------
+
+namespace {
+
+  bool is_logical_op_ (int op)
+  {
+    return (op == enum_op_le || op == enum_op_lt ||
+            op == enum_op_ge || op == enum_op_gt ||
+            op == enum_op_eq || op == enum_op_ne ||
+            op == enum_op_and || op == enum_op_or);
+  }
+
+  /// Apply f elementwise, where each of the operands is either an
+  /// array (a or b non-null) or a scalar (sa or sb)
+  template <class F>
+  inline void apply_ (int n, double * d,
+                      const double * a, double sa,
+                      const double * b, double sb, F f)
+  {
+    if (a && b) {
+      for (int i=0; i<n; i++) d[i] = f(a[i],b[i]);
+    } else if (a) {
+      for (int i=0; i<n; i++) d[i] = f(a[i],sb);
+    } else {
+      for (int i=0; i<n; i++) d[i] = f(sa,b[i]);
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+ParamCode::ParamCode (struct node_expr * node, bool is_logical)
+  : code_scalar_(),
+    code_vector_(),
+    scalar_init_(),
+    scalar_is_const_(),
+    register_used_(),
+    num_registers_(0),
+    result_(0),
+    is_valid_(true)
+{
+  // scalar 0 is t
+  scalar_init_.push_back(0.0);
+  scalar_is_const_.push_back(false);
+
+  result_ = compile_(node,is_logical);
+}
+
+//----------------------------------------------------------------------
+
+void ParamCode::evaluate_float
+( int n, double * result,
+  const double * x, const double * y, const double * z, double t) const
+{
+  evaluate_(n,result,x,y,z,t);
+}
+
+//----------------------------------------------------------------------
+
+void ParamCode::evaluate_logical
+( int n, bool * result,
+  const double * x, const double * y, const double * z, double t) const
+{
+  evaluate_(n,result,x,y,z,t);
+}
+
+//======================================================================
+
+int ParamCode::compile_ (struct node_expr * node, bool is_logical)
+{
+  // logical values are only produced by operations
+  if (node == NULL || (is_logical && node->type != enum_node_operation)) {
+    is_valid_ = false;
+    return 0;
+  }
+
+  switch (node->type) {
+
+  case enum_node_float:
+    return new_constant_(node->float_value);
+
+  case enum_node_integer:
+    return new_constant_(double(node->integer_value));
+
+  case enum_node_variable:
+    switch (node->var_value) {
+    case 'x': return 0;
+    case 'y': return 1;
+    case 'z': return 2;
+    case 't': return -1;
+    }
+    break;
+
+  case enum_node_function:
+  case enum_node_operation:
+    {
+      Instruction code;
+      const bool is_function = (node->type == enum_node_function);
+      code.op  = is_function ? OP_FUNCTION : node->op_value;
+      code.fun = is_function ? node->fun_value : nullptr;
+
+      const bool is_logical_op = (! is_function) && is_logical_op_(code.op);
+      if ((is_logical != is_logical_op) || node->left == NULL ||
+          (! is_function && node->right == NULL)) {
+        break;
+      }
+
+      // operands of && and || are logical; all others are floating-point
+      const bool is_logical_arg =
+        (code.op == enum_op_and || code.op == enum_op_or);
+      code.a = compile_(node->left,is_logical_arg);
+      code.b = is_function ? code.a : compile_(node->right,is_logical_arg);
+      if (! is_valid_) return 0;
+
+      const bool is_scalar = (code.a < 0 && code.b < 0);
+
+      if (is_scalar) {
+        const int ka = -1-code.a;
+        const int kb = -1-code.b;
+        if (scalar_is_const_[ka] && scalar_is_const_[kb]) {
+          // fold constant subexpression
+          return new_constant_
+            (apply_scalar_(code,scalar_init_[ka],scalar_init_[kb]));
+        }
+        // evaluate once per call
+        code.dst = new_constant_(0.0);
+        scalar_is_const_[-1-code.dst] = false;
+        code_scalar_.push_back(code);
+        return code.dst;
+      }
+
+      // reuse operand registers for the result
+      free_register_(code.a);
+      free_register_(code.b);
+      code.dst = new_register_();
+      code_vector_.push_back(code);
+      return code.dst;
+    }
+
+  case enum_node_unknown:
+  default:
+    break;
+  }
+
+  // not supported: left to Param's tree evaluation to report
+  is_valid_ = false;
+  return 0;
+}
+
+//----------------------------------------------------------------------
+
+int ParamCode::new_constant_ (double value)
+{
+  scalar_init_.push_back(value);
+  scalar_is_const_.push_back(true);
+  return -int(scalar_init_.size());
+}
+
+//----------------------------------------------------------------------
+
+int ParamCode::new_register_ ()
+{
+  int k = 0;
+  while (k < num_registers_ && register_used_[k]) k++;
+  if (k == num_registers_) {
+    register_used_.push_back(false);
+    ++num_registers_;
+  }
+  register_used_[k] = true;
+  return NUM_ARRAYS + k;
+}
+
+//----------------------------------------------------------------------
+
+void ParamCode::free_register_ (int operand)
+{
+  if (operand >= NUM_ARRAYS) register_used_[operand-NUM_ARRAYS] = false;
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void ParamCode::evaluate_
+(int n, T * value,
+ const double * x, const double * y, const double * z,
+ double t) const
+{
+  // Evaluate scalar instructions
+
+  std::vector<double> scalar (scalar_init_);
+  scalar[0] = t;
+  for (const Instruction & code : code_scalar_) {
+    scalar[-1-code.dst] = apply_scalar_
+      (code,scalar[-1-code.a],scalar[-1-code.b]);
+  }
+
+  if (result_ < 0) {
+    std::fill_n(value,n,T(scalar[-1-result_]));
+    return;
+  }
+
+  // Evaluate vector instructions one chunk at a time
+
+  std::vector<double> buffer ((num_registers_+1)*CHUNK_SIZE);
+  double * zero = &buffer[num_registers_*CHUNK_SIZE];
+  const double * xyz[NUM_ARRAYS] = {x,y,z};
+  std::vector<double *> reg (NUM_ARRAYS + num_registers_);
+  for (int k=0; k<num_registers_; k++) {
+    reg[NUM_ARRAYS+k] = &buffer[k*CHUNK_SIZE];
+  }
+
+  for (int i0=0; i0<n; i0+=CHUNK_SIZE) {
+
+    const int nc = std::min(int(CHUNK_SIZE),n-i0);
+
+    // missing arrays evaluate as 0.0
+    for (int k=0; k<NUM_ARRAYS; k++) {
+      reg[k] = xyz[k] ? (double *)(xyz[k]+i0) : zero;
+    }
+
+    for (const Instruction & code : code_vector_) {
+
+      double * d = reg[code.dst];
+      const double * a  = (code.a >= 0) ? reg[code.a] : nullptr;
+      const double * b  = (code.b >= 0) ? reg[code.b] : nullptr;
+      const double   sa = (code.a <  0) ? scalar[-1-code.a] : 0.0;
+      const double   sb = (code.b <  0) ? scalar[-1-code.b] : 0.0;
+
+      switch (code.op) {
+      case OP_FUNCTION:
+        for (int i=0; i<nc; i++) d[i] = (*code.fun)(a[i]);
+        break;
+      case enum_op_add:
+        apply_(nc,d,a,sa,b,sb,[](double p, double q) { return p + q; });
+        break;
+      case enum_op_sub:
+        apply_(nc,d,a,sa,b,sb,[](double p, double q) { return p - q; });
+        break;
+      case enum_op_mul:
+        apply_(nc,d,a,sa,b,sb,[](double p, double q) { return p * q; });
+        break;
+      case enum_op_div:
+        apply_(nc,d,a,sa,b,sb,[](double p, double q) { return p / q; });
+        break;
+      case enum_op_pow:
+        apply_(nc,d,a,sa,b,sb,[](double p, double q) { return pow(p,q); });
+        break;
+      case enum_op_le:
+        apply_(nc,d,a,sa,b,sb,[](double p, double q) { return double(p <= q); });
+        break;
+      case enum_op_lt:
+        apply_(nc,d,a,sa,b,sb,[](double p, double q) { return double(p <  q); });
+        break;
+      case enum_op_ge:
+        apply_(nc,d,a,sa,b,sb,[](double p, double q) { return double(p >= q); });
+        break;
+      case enum_op_gt:
+        apply_(nc,d,a,sa,b,sb,[](double p, double q) { return double(p >  q); });
+        break;
+      case enum_op_eq:
+        apply_(nc,d,a,sa,b,sb,[](double p, double q) { return double(p == q); });
+        break;
+      case enum_op_ne:
+        apply_(nc,d,a,sa,b,sb,[](double p, double q) { return double(p != q); });
+        break;
+      case enum_op_and:
+        apply_(nc,d,a,sa,b,sb,
+               [](double p, double q) { return double(p != 0.0 && q != 0.0); });
+        break;
+      case enum_op_or:
+        apply_(nc,d,a,sa,b,sb,
+               [](double p, double q) { return double(p != 0.0 || q != 0.0); });
+        break;
+      }
+    }
+
+    const double * r = reg[result_];
+    for (int i=0; i<nc; i++) value[i0+i] = T(r[i]);
+  }
+}
+
+//----------------------------------------------------------------------
+
+double ParamCode::apply_scalar_ (const Instruction & code, double a, double b)
+{
+  switch (code.op) {
+  case OP_FUNCTION: return (*code.fun)(a);
+  case enum_op_add: return a + b;
+  case enum_op_sub: return a - b;
+  case enum_op_mul: return a * b;
+  case enum_op_div: return a / b;
+  case enum_op_pow: return pow(a,b);
+  case enum_op_le:  return double(a <= b);
+  case enum_op_lt:  return double(a <  b);
+  case enum_op_ge:  return double(a >= b);
+  case enum_op_gt:  return double(a >  b);
+  case enum_op_eq:  return double(a == b);
+  case enum_op_ne:  return double(a != b);
+  case enum_op_and: return double(a != 0.0 && b != 0.0);
+  case enum_op_or:  return double(a != 0.0 || b != 0.0);
+  }
+  return 0.0;
+}
@@ -0,0 +1,120 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     parameters_ParamCode.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    [\ref Parameters] Declaration of the ParamCode class
+
+#ifndef PARAMETERS_PARAM_CODE_HPP
+#define PARAMETERS_PARAM_CODE_HPP
+
+class ParamCode {
+
+  /// @class    ParamCode
+  /// @ingroup  Parameters
+  /// @brief    [\ref Parameters] Compiled form of a floating-point or
+  /// logical expression tree
+  ///
+  /// The expression tree is flattened into a list of instructions on
+  /// numbered registers.  Subexpressions of constants are folded when
+  /// compiled, and subexpressions of constants and t are evaluated
+  /// once per call.  The remaining instructions are applied to the
+  /// x,y,z arrays in chunks of CHUNK_SIZE values, so that registers
+  /// stay in cache.  Logical values are held as 0.0 or 1.0.
+
+public: // interface
+
+  /// Number of values evaluated together by each instruction
+  enum { CHUNK_SIZE = 256 };
+
+  /// Compile the given expression tree
+  ParamCode (struct node_expr * node, bool is_logical);
+
+  /// Whether the expression was compiled successfully.  Invalid
+  /// expressions must be evaluated from their tree instead
+  bool is_valid () const
+  { return is_valid_; }
+
+  /// Evaluate a floating-point expression given vectors x,y,z and time t
+  void evaluate_float
+  ( int n, double * result,
+    const double * x, const double * y, const double * z, double t) const;
+
+  /// Evaluate a logical expression given vectors x,y,z and time t
+  void evaluate_logical
+  ( int n, bool * result,
+    const double * x, const double * y, const double * z, double t) const;
+
+  /// Number of instructions applied to each chunk
+  int num_instructions () const
+  { return code_vector_.size(); }
+
+  /// Number of chunk-sized scratch registers
+  int num_registers () const
+  { return num_registers_; }
+
+private: // types
+
+  /// An instruction dst = op(a,b).  Operands 0,1,2 are x,y,z, operands
+  /// >= 3 are scratch registers, and negative operands are scalars
+  /// -1-k, where scalar 0 is t
+  struct Instruction {
+    int op;
+    int dst;
+    int a;
+    int b;
+    double (*fun) (double);
+  };
+
+private: // functions
+
+  /// Recursively compile node, returning its result operand
+  int compile_ (struct node_expr * node, bool is_logical);
+
+  /// Return a new constant scalar operand
+  int new_constant_ (double value);
+
+  /// Return a free scratch register operand
+  int new_register_ ();
+
+  /// Free a scratch register operand
+  void free_register_ (int operand);
+
+  /// Evaluate the expression into the first n values of value,
+  /// where T is double or bool
+  template <class T>
+  void evaluate_ (int n, T * value,
+                  const double * x, const double * y, const double * z,
+                  double t) const;
+
+  /// Apply instruction to scalars
+  static double apply_scalar_ (const Instruction & code, double a, double b);
+
+private: // attributes
+
+  /// Instructions applied once per call to scalars
+  std::vector<Instruction> code_scalar_;
+
+  /// Instructions applied to each chunk of values
+  std::vector<Instruction> code_vector_;
+
+  /// Initial scalar values: t (set per call) followed by constants
+  std::vector<double> scalar_init_;
+
+  /// Whether each scalar is known at compile time
+  std::vector<bool> scalar_is_const_;
+
+  /// Scratch register usage while compiling
+  std::vector<bool> register_used_;
+
+  /// Number of scratch registers
+  int num_registers_;
+
+  /// Operand holding the expression's value
+  int result_;
+
+  /// Whether the expression was compiled successfully
+  bool is_valid_;
+};
+
+#endif /* PARAMETERS_PARAM_CODE_HPP */
@@ -47,6 +47,13 @@ Performance::Performance (Config * config)
   new_counter(counter_type_abs,"bytes-high");
   new_counter(counter_type_abs,"bytes-highest");
   new_counter(counter_type_abs,"bytes-available");
+  new_counter(counter_type_abs,"bytes-scratch-highest");
+  // REFRESH AGGREGATION
+  new_counter(counter_type_user,"refresh-msg-saved");
+  new_counter(counter_type_user,"refresh-bytes-saved");
+  // DATA MESSAGE POOL
+  new_counter(counter_type_user,"pool-reused");
+  new_counter(counter_type_user,"pool-created");
 
 #ifdef CONFIG_USE_PAPI  
   papi_.init();
@@ -140,6 +147,8 @@ Performance::refresh_counters_() throw()
   counter_values_[perf_index_bytes_high]    = memory->bytes_high();
   counter_values_[perf_index_bytes_highest] = memory->bytes_highest();
   counter_values_[perf_index_bytes_available] = memory->bytes_available();
+  counter_values_[perf_index_bytes_scratch_highest] =
+    ScratchArena::instance()->bytes_highest();
 
 }
 
@@ -27,12 +27,20 @@ enum index_enum {
   perf_index_bytes_high,
   perf_index_bytes_highest,
   perf_index_bytes_available,
+  perf_index_bytes_scratch_highest,
+  perf_index_refresh_msg_saved,
+  perf_index_refresh_bytes_saved,
+  perf_index_pool_reused,
+  perf_index_pool_created,
   perf_index_last,
   num_perf_index = perf_index_last
 };
   
 /// @enum    perf_region
 /// @brief   region ID's for the Simulation performance object
+///
+/// Regions num_perf_region + i, one for each mesh refinement
+/// criterion i, are created by Simulation::initialize_performance_()
 enum perf_region {
   perf_unknown,
   perf_simulation,
@@ -60,6 +68,9 @@ enum perf_region {
   perf_exit,
 #ifdef CONFIG_USE_GRACKLE
   perf_grackle,
+  perf_grackle_gather,
+  perf_grackle_solve,
+  perf_grackle_scatter,
 #endif
   num_perf_region
 };
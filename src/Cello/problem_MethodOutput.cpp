@@ -12,6 +12,35 @@
 // #define TRACE_OUTPUT
 
 // #define BYPASS_BLOCK_TRACE
+
+//----------------------------------------------------------------------
+
+/// [concurrent] State of a writer block while blocks are sending data
+struct WriterState {
+  /// Output file, or nullptr until opened by compute_continue()
+  FileHdf5 * file;
+  /// Number of granted requests whose data has not been written
+  int num_in_flight;
+  /// Requests in arrival order, and the first one not yet granted
+  std::vector<Index> request_list;
+  size_t request_next;
+};
+
+/// Return the writer block's WriterState, creating it if needed
+static WriterState * writer_state_ (Block * block, int is_writer_state)
+{
+  ScalarData<void *> * scalar_void = block->data()->scalar_data_void();
+  WriterState ** state = (WriterState **)
+    scalar_void->value(cello::scalar_descr_void(),is_writer_state);
+  if (*state == nullptr) {
+    *state = new WriterState;
+    (*state)->file = nullptr;
+    (*state)->num_in_flight = 0;
+    (*state)->request_next = 0;
+  }
+  return *state;
+}
+
 //----------------------------------------------------------------------
 
 MethodOutput::MethodOutput
@@ -27,7 +56,10 @@ MethodOutput::MethodOutput
    bool all_blocks,
    int blocking_x,
    int blocking_y,
-   int blocking_z)
+   int blocking_z,
+   FileFilter file_filter,
+   bool concurrent,
+   int window)
     : Method(),
       file_name_(file_name),
       path_name_(path_name),
@@ -41,7 +73,11 @@ MethodOutput::MethodOutput
       is_count_(-1),
       is_block_list_(-1),
       factory_(factory),
-      all_blocks_(all_blocks)
+      all_blocks_(all_blocks),
+      file_filter_(file_filter),
+      concurrent_(concurrent),
+      window_(window),
+      is_writer_state_(-1)
 {
   if (field_list.size() > 0) {
     field_list_.resize(field_list.size());
@@ -117,6 +153,11 @@ MethodOutput::MethodOutput
 
   ScalarDescr * sdp = cello::scalar_descr_void();
   is_block_list_ = sdp->new_value("method_output:block_list");
+  is_writer_state_ = sdp->new_value("method_output:writer_state");
+
+  ASSERT1("MethodOutput()",
+          "Output window %d must be positive",
+          window_, (window_ > 0));
 }
 
 //----------------------------------------------------------------------
@@ -144,6 +185,10 @@ void MethodOutput::pup (PUP::er &p)
   p | is_block_list_;
   p | factory_nonconst_;
   p | all_blocks_;
+  p | file_filter_;
+  p | concurrent_;
+  p | window_;
+  p | is_writer_state_;
 }
 
 //----------------------------------------------------------------------
@@ -191,6 +236,16 @@ void MethodOutput::compute_continue(Block * block)
   }
   // non-writers wait until called later...
   if (! is_writer_(block->index()) ) {
+    if (concurrent_) {
+      // ...or ask their writer for permission to send their data
+      if (all_blocks_ || block->is_leaf()) {
+        Index index_writer = index_writer_(block->index());
+        cello::block_array()[index_writer].p_method_output_request
+          (block->index());
+      } else {
+        compute_done(block);
+      }
+    }
     return;
   }
 
@@ -252,6 +307,18 @@ void MethodOutput::compute_continue(Block * block)
 
   }
 
+  if (concurrent_) {
+    // Let blocks send their data, starting with any early requests.
+    // The file is closed in writer_close() once all blocks have
+    // contributed to r_method_output_done()
+    delete msg_output;
+    WriterState * state = writer_state_(block,is_writer_state_);
+    state->file = file;
+    grant_requests_(block);
+    compute_done(block);
+    return;
+  }
+
   // Check if any non-writer blocks
   if ( ! block_trace->next(block->is_leaf())) {
     Index index_next = block_trace->top();
@@ -346,6 +413,19 @@ void MethodOutput::write(Block * block, MsgOutput * msg_output_in )
 // and continues to the next block in the distributed octree forest
 // traversal (if any)
 {
+  if (concurrent_) {
+    // Write the block data in arrival order, then notify the sender
+    // and let the next waiting block send its data
+    WriterState * state = writer_state_(block,is_writer_state_);
+    file_write_block_(state->file,block,msg_output_in);
+    Index index_send = msg_output_in->index_send();
+    delete msg_output_in;
+    --state->num_in_flight;
+    cello::block_array()[index_send].p_method_output_written();
+    grant_requests_(block);
+    return;
+  }
+
   // Write the block data
   FileHdf5 * file = msg_output_in->file();
   file_write_block_(file,block,msg_output_in);
@@ -384,6 +464,97 @@ void MethodOutput::write(Block * block, MsgOutput * msg_output_in )
 
 //----------------------------------------------------------------------
 
+void Block::p_method_output_request (Index index_send)
+{
+  MethodOutput * method_output =
+    static_cast<MethodOutput*>(cello::problem()->method(index_method_));
+  method_output -> request(this,index_send);
+}
+
+//----------------------------------------------------------------------
+
+void Block::p_method_output_send ()
+{
+  MethodOutput * method_output =
+    static_cast<MethodOutput*>(cello::problem()->method(index_method_));
+  method_output -> send(this);
+}
+
+//----------------------------------------------------------------------
+
+void Block::p_method_output_written ()
+{
+  MethodOutput * method_output =
+    static_cast<MethodOutput*>(cello::problem()->method(index_method_));
+  method_output -> compute_done(this);
+}
+
+//----------------------------------------------------------------------
+
+void MethodOutput::request (Block * block, Index index_send)
+// [concurrent] Called on the writer block; may be called before the
+// writer itself reaches compute_continue()
+{
+  WriterState * state = writer_state_(block,is_writer_state_);
+  state->request_list.push_back(index_send);
+  grant_requests_(block);
+}
+
+//----------------------------------------------------------------------
+
+void MethodOutput::send (Block * block)
+// [concurrent] Called on a non-writer block when its writer has room
+// for its data
+{
+  MsgOutput * msg_output = new MsgOutput;
+  msg_output->set_index_send (block->index());
+  msg_output->set_data_msg(create_data_msg_(block));
+  msg_output->set_block(block,factory_);
+  Index index_writer = index_writer_(block->index());
+  cello::block_array()[index_writer].p_method_output_write(msg_output);
+}
+
+//----------------------------------------------------------------------
+
+void MethodOutput::grant_requests_ (Block * block)
+{
+  WriterState * state = writer_state_(block,is_writer_state_);
+  if (state->file == nullptr) return;
+  const size_t n = state->request_list.size();
+  while (state->num_in_flight < window_ && state->request_next < n) {
+    Index index_send = state->request_list[state->request_next++];
+    ++state->num_in_flight;
+    cello::block_array()[index_send].p_method_output_send();
+  }
+}
+
+//----------------------------------------------------------------------
+
+void MethodOutput::writer_close (Block * block)
+{
+  if (! (concurrent_ && block->level() >= 0 &&
+         is_writer_(block->index()))) return;
+
+  ScalarData<void *> * scalar_void = block->data()->scalar_data_void();
+  WriterState ** state = (WriterState **)
+    scalar_void->value(cello::scalar_descr_void(),is_writer_state_);
+
+  // Close file
+  FileHdf5 * file = (*state)->file;
+  file->file_close();
+  delete file;
+  delete *state;
+  *state = nullptr;
+
+  // Close *.block_list file
+  FILE ** fp_block_list = (FILE **)
+    scalar_void->value(cello::scalar_descr_void(),is_block_list_);
+  fclose(*fp_block_list);
+  *fp_block_list = nullptr;
+}
+
+//----------------------------------------------------------------------
+
 void MethodOutput::compute_done (Block * block)
 {
   CkCallback callback(CkIndex_Block::r_method_output_done(nullptr), 
@@ -397,6 +568,7 @@ void Block::r_method_output_done(CkReductionMsg *msg)
 {
   delete msg;
   MethodOutput * method = static_cast<MethodOutput*> (this->method());
+  method->writer_close(this);
   this->compute_done();
 }
 
@@ -414,6 +586,18 @@ int MethodOutput::is_writer_ (Index index)
 }
 
 //----------------------------------------------------------------------
+
+Index MethodOutput::index_writer_ (Index index)
+{
+  int a3[3];
+  index.array(a3,a3+1,a3+2);
+  return Index (a3[0] - a3[0] % blocking_[0],
+                a3[1] - a3[1] % blocking_[1],
+                a3[2] - a3[2] % blocking_[2]);
+}
+
+//----------------------------------------------------------------------
+
 FileHdf5 * MethodOutput::file_open_(Block * block, int a3[3])
 {
   // Generate file path
@@ -555,6 +739,9 @@ void MethodOutput::file_write_block_
     io_field_data->field_array
       (&buffer, &name, &type, &mx,&my,&mz, &nx,&ny,&nz);
 
+    file_filter_.apply_field
+      (file,cello::field_descr()->field_name(index_field));
+
     file->mem_create(nx,ny,nz,nx,ny,nz,0,0,0);
     if (mz > 1) {
       file->data_create(name.c_str(),type,mz,my,mx,1,nz,ny,nx,1);
@@ -573,6 +760,8 @@ void MethodOutput::file_write_block_
 
   Particle particle = data->particle();
 
+  file_filter_.apply(file);
+
   for (int i_p=0; i_p<particle_list_.size(); i_p++) {
 
     // Get particle type for it'th element of the particle output list
@@ -39,7 +39,10 @@ public: // interface
    bool all_blocks,
    int blocking_x,
    int blocking_y,
-   int blocking_z);
+   int blocking_z,
+   FileFilter file_filter,
+   bool concurrent,
+   int window);
 
   /// Destructor
   virtual ~MethodOutput() throw();
@@ -63,6 +66,17 @@ public: // interface
   /// Write the block's data
   void write (Block * block, MsgOutput *);
 
+  /// [concurrent] Queue a request from a block to send its data to
+  /// this writer block
+  void request (Block * block, Index index_send);
+
+  /// [concurrent] Send the block's data to its writer
+  void send (Block * block);
+
+  /// [concurrent] Close the writer block's file after all blocks are
+  /// written
+  void writer_close (Block * block);
+
   const Factory * factory () const
   { return factory_; }
 
@@ -84,6 +98,12 @@ protected: // functions
 
   int is_writer_ (Index index);
 
+  /// Return the Index of the writer for the given Block
+  Index index_writer_ (Index index);
+
+  /// [concurrent] Grant queued requests while the window is not full
+  void grant_requests_ (Block * block);
+
   FileHdf5 * file_open_(Block * block, int a3[3]);
   void file_write_hierarchy_(FileHdf5 * file);
   void file_write_block_(FileHdf5 * , Block * , MsgOutput *);
@@ -137,5 +157,19 @@ protected: // attributes
 
   /// Whether to output all blocks or just leaf-blocks
   bool all_blocks_;
+
+  /// Compression filters for field and particle datasets
+  FileFilter file_filter_;
+
+  /// Whether all blocks send data to their writer concurrently rather
+  /// than one at a time along a depth-first traversal
+  bool concurrent_;
+
+  /// [concurrent] Maximum number of block data messages in flight to
+  /// each writer
+  int window_;
+
+  /// [concurrent] Block Scalar pointer to the writer's WriterState
+  int is_writer_state_;
 };
 #endif /* PROBLEM_METHOD_OUTPUT_HPP */
@@ -478,7 +478,11 @@ void Problem::initialize_method
 
     if (method) {
 
-      method_list_.push_back(method); 
+      method_list_.push_back(method);
+
+      if (config->method_refresh_aggregate[index_method]) {
+        cello::refresh(method->refresh_id_post())->set_aggregate(true);
+      }
 
       int index_schedule = config->method_schedule_index[index_method];
 
@@ -937,7 +941,14 @@ Method * Problem::create_method_
         config->method_output_all_blocks[index_method],
         config->method_output_blocking[0][index_method],
         config->method_output_blocking[1][index_method],
-        config->method_output_blocking[2][index_method]);
+        config->method_output_blocking[2][index_method],
+        FileFilter(config->method_compress[index_method],
+                   config->method_compress_level[index_method],
+                   config->method_compress_shuffle[index_method],
+                   config->method_quantize_fields[index_method],
+                   config->method_quantize_digits[index_method]),
+        config->method_output_concurrent[index_method],
+        config->method_output_window[index_method]);
 
   } else if (name == "order_morton") {
 
@@ -47,6 +47,15 @@ public: // virtual methods
     const void * values_c, int nd3_c[3], int im3_c[3], int n3_c[3],
     bool accumulate = false) = 0;
 
+  /// Prolong num_fields fields whose arrays have the same sizes and
+  /// offsets.  values_f[i] and values_c[i] are the fine and coarse
+  /// arrays of the ith field.  The default calls apply() for each field
+  virtual void apply_fields
+  ( precision_type precision, int num_fields,
+    void * const * values_f, int nd3_f[3], int im3_f[3], int n3_f[3],
+    const void * const * values_c, int nd3_c[3], int im3_c[3], int n3_c[3],
+    bool accumulate = false);
+
   /// Return the name identifying the prolongation operator
   virtual std::string name () const = 0;
 
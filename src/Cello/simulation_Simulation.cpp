@@ -61,12 +61,16 @@ Simulation::Simulation
   sync_restart_created_(),
   sync_restart_next_(),
   refresh_list_(),
+  refresh_aggregate_(),
+  refresh_aggregate_flush_(false),
   index_output_(-1),
   num_solver_iter_(),
   max_solver_iter_(),
   restart_directory_(),
   restart_num_files_(),
   restart_stream_file_list_(),
+  restart_time_begin_(0.0),
+  restart_time_phase_(0.0),
   num_blocks_level_()
   
 {
@@ -133,12 +137,16 @@ Simulation::Simulation()
   sync_restart_created_(),
   sync_restart_next_(),
   refresh_list_(),
+  refresh_aggregate_(),
+  refresh_aggregate_flush_(false),
   index_output_(-1),
   num_solver_iter_(),
   max_solver_iter_(),
   restart_directory_(),
   restart_num_files_(),
   restart_stream_file_list_(),
+  restart_time_begin_(0.0),
+  restart_time_phase_(0.0),
   num_blocks_level_()
 {
   for (int i=0; i<256; i++) dir_checkpoint_[i] = '\0';
@@ -192,12 +200,16 @@ Simulation::Simulation (CkMigrateMessage *m)
     sync_restart_created_(),
     sync_restart_next_(),
     refresh_list_(),
+    refresh_aggregate_(),
+    refresh_aggregate_flush_(false),
     index_output_(-1),
     num_solver_iter_(),
     max_solver_iter_(),
     restart_directory_(),
     restart_num_files_(),
     restart_stream_file_list_(),
+    restart_time_begin_(0.0),
+    restart_time_phase_(0.0),
     num_blocks_level_()
 {
   for (int i=0; i<256; i++) dir_checkpoint_[i] = '\0';
@@ -318,6 +330,8 @@ void Simulation::pup (PUP::er &p)
   p | max_solver_iter_;
   p | restart_directory_;
   p | restart_num_files_;
+  p | restart_time_begin_;
+  p | restart_time_phase_;
   p | num_blocks_level_;
 }
 
@@ -418,6 +432,10 @@ void Simulation::initialize_memory_() throw()
     memory->set_active(config_->memory_active);
     memory->set_warning_mb (config_->memory_warning_mb);
     memory->set_limit_gb (config_->memory_limit_gb);
+    // group for objects recycled by DataMsgPool
+    memory->new_group ("pool");
+    // group for per-process solver scratch space (ScratchArena)
+    memory->new_group ("scratch");
   }
   
 }
@@ -456,10 +474,31 @@ void Simulation::initialize_performance_() throw()
   p->new_region(perf_exit,               "exit");
 #ifdef CONFIG_USE_GRACKLE
   p->new_region(perf_grackle,            "grackle");
+  p->new_region(perf_grackle_gather,     "grackle_gather");
+  p->new_region(perf_grackle_solve,      "grackle_solve");
+  p->new_region(perf_grackle_scatter,    "grackle_scatter");
 #endif
+  // time spent evaluating each mesh refinement criterion
+  for (int i=0; i<config_->num_adapt; i++) {
+    p->new_region(num_perf_region + i, "refine_" + config_->adapt_list[i]);
+  }
 
   timer_.start();
 
+  // number of worker threads used by ParallelFor loops within a Block
+  // (the value is shared by all PEs in a process)
+  if (CkMyRank() == 0) {
+    ParallelFor::set_num_threads(config_->performance_threads_per_block);
+  }
+#ifndef CONFIG_SMP_MODE
+  if (CkMyPe() == 0 && config_->performance_threads_per_block > 1) {
+    WARNING1 ("Simulation::initialize_performance_()",
+              "Performance:threads_per_block = %d ignored: "
+              "Charm++ is not in SMP mode",
+              config_->performance_threads_per_block);
+  }
+#endif
+
 #ifdef CONFIG_USE_PAPI  
   for (size_t i=0; i<config_->performance_papi_counters.size(); i++) {
     p->new_counter(counter_type_papi, 
@@ -285,6 +285,25 @@ public: // virtual functions
 
   void compute ();
 
+  //--------------------------------------------------
+  // Refresh
+  //--------------------------------------------------
+
+  /// Append a field face for a Block on another process to that
+  /// process's aggregated buffer.  The first face added schedules
+  /// p_refresh_flush_aggregate(), which runs after the entry methods
+  /// of other Blocks on this process already queued for the refresh
+  /// phase, so faces from all of them are sent together
+  void refresh_aggregate_face
+  (int ip, Index index, MsgRefresh * msg_refresh);
+
+  /// Send the aggregated field faces, one message per process
+  void p_refresh_flush_aggregate ();
+
+  /// Receive field faces aggregated on another process, and deliver
+  /// them to the destination Blocks on this process
+  void p_refresh_recv_aggregate (MsgRefreshAggregate * msg);
+
   //--------------------------------------------------
   // Restart
   //--------------------------------------------------
@@ -462,6 +481,10 @@ protected: // functions
                                bool & already_exists);
   std::ifstream file_open_file_list_(std::string name_dir);
 
+  /// Print the time since the previous restart phase ended, and start
+  /// the next phase.  The level is omitted if negative
+  void restart_monitor_phase_(std::string phase, int level);
+
 protected: // attributes
 
 #if defined(CELLO_DEBUG) || defined(CELLO_VERBOSE)
@@ -563,6 +586,11 @@ protected: // attributes
   std::vector < Refresh >     refresh_list_;
   std::vector < std::string > refresh_name_;
 
+  /// Field faces from Blocks on this process packed by destination
+  /// process, and whether p_refresh_flush_aggregate() is scheduled
+  std::map<int, std::vector<char> > refresh_aggregate_;
+  bool refresh_aggregate_flush_;
+
   /// Saved latest checkpoint directory for creating symlink
   char dir_checkpoint_[256];
 
@@ -582,6 +610,10 @@ protected: // attributes
   std::string restart_directory_;
   int         restart_num_files_;
   std::ifstream restart_stream_file_list_;
+  /// Simulation timer values when restart began and when the current
+  /// restart phase began
+  float       restart_time_begin_;
+  float       restart_time_phase_;
 
   std::vector<int> num_blocks_level_;
 };
@@ -387,6 +387,126 @@ PARALLEL_MAIN_BEGIN
   unit_func("face_to_array / array_to_face");
   unit_assert(test_fields(field_descr,field_data.data(),nbx,nby,nbz,mx,my,mz));
 
+  //----------------------------------------------------------------------
+  // Prolong conservative fields
+  //----------------------------------------------------------------------
+
+  // Prolong fields from a parent block to a child, with all fields
+  // in one FieldFace, which prolongs consecutive fields together, and
+  // with one FieldFace per field.  Fields in "make_field_conservative"
+  // are divided by the child's density after they are prolonged, so
+  // density must be prolonged first in both cases
+
+  {
+    const int NF = 5;
+    const char * name_list[NF] =
+      { "density", "field_a", "velocity_x", "field_b", "velocity_y" };
+    const int n = 8;
+    const int g = 2;
+    const int m = n + 2*g;
+    const int mm = m*m*m;
+
+    cello::field_groups()->add("velocity_x","make_field_conservative");
+    cello::field_groups()->add("velocity_y","make_field_conservative");
+
+    FieldDescr * fd = new FieldDescr;
+    std::vector<int> field_list;
+    for (int i_f=0; i_f<NF; i_f++) {
+      fd->insert_permanent(name_list[i_f]);
+      fd->set_precision(i_f,precision_double);
+      fd->set_ghost_depth(i_f,g,g,g);
+      field_list.push_back(i_f);
+    }
+
+    // parent values are positive and not linear, children are zero
+
+    auto new_data = [&] (bool is_parent)
+      {
+        FieldData * data = new FieldData (fd,n,n,n);
+        data->allocate_permanent(fd,true);
+        for (int i_f=0; i_f<NF; i_f++) {
+          double * v = (double *) data->values(fd,i_f);
+          for (int iz=0; iz<m; iz++) {
+            for (int iy=0; iy<m; iy++) {
+              for (int ix=0; ix<m; ix++) {
+                int i = ix + m*(iy + m*iz);
+                v[i] = is_parent ?
+                  (1.0 + 0.5*i_f + 0.125*ix + 0.0625*(i_f+1)*iy + 0.25*iz*iz/m)
+                  : 0.0;
+              }
+            }
+          }
+        }
+        return data;
+      };
+
+    auto prolong_fields = [&]
+      (FieldData * data_parent, FieldData * data_child,
+       std::vector<int> list, bool use_array)
+      {
+        Field field_parent (fd,data_parent);
+        Field field_child (fd,data_child);
+        Refresh refresh;
+        refresh.set_field_list(list);
+        FieldFace face (3);
+        face.set_refresh_type(refresh_fine);
+        face.set_face(0,0,0);
+        face.set_child(1,0,1);
+        face.set_ghost(g,g,g);
+        face.set_refresh(&refresh,false);
+        if (use_array) {
+          int na;
+          char * array;
+          face.face_to_array (field_parent,&na,&array);
+          face.array_to_face (array,field_child);
+          delete [] array;
+        } else {
+          face.face_to_face (field_parent,field_child);
+        }
+      };
+
+    for (int use_array=0; use_array<2; use_array++) {
+
+      unit_func(use_array ?
+                "array_to_face() conservative fields" :
+                "face_to_face() conservative fields");
+
+      FieldData * parent_batch = new_data(true);
+      FieldData * parent_field = new_data(true);
+      FieldData * child_batch = new_data(false);
+      FieldData * child_field = new_data(false);
+
+      prolong_fields (parent_batch,child_batch,field_list,use_array);
+      for (int i_f=0; i_f<NF; i_f++) {
+        prolong_fields (parent_field,child_field,
+                        std::vector<int>(1,field_list[i_f]),use_array);
+      }
+
+      bool match = true;
+      bool finite = true;
+      int count = 0;
+      for (int i_f=0; i_f<NF; i_f++) {
+        double * v_batch = (double *) child_batch->values(fd,i_f);
+        double * v_field = (double *) child_field->values(fd,i_f);
+        for (int i=0; i<mm; i++) {
+          match  = match && (v_batch[i] == v_field[i]);
+          finite = finite && std::isfinite(v_batch[i]);
+          if (v_batch[i] != 0.0) ++count;
+        }
+      }
+      unit_assert (finite);
+      unit_assert (match);
+      unit_assert (count > 0);
+
+      delete parent_batch;
+      delete parent_field;
+      delete child_batch;
+      delete child_field;
+    }
+
+    delete fd;
+  }
+
   //----------------------------------------------------------------------	
   // clean up
   //----------------------------------------------------------------------	
@@ -8,6 +8,7 @@
 #include "main.hpp" 
 #include "test.hpp"
 #include "disk.hpp"
+#include "io.hpp"
 
 PARALLEL_MAIN_BEGIN
 {
@@ -566,6 +567,224 @@ PARALLEL_MAIN_BEGIN
 
   hdf5_b.file_close();
 
+  //==================================================
+  // Filters
+  //==================================================
+
+  // field data larger than the 1 MB chunk size
+
+  const int fx = 64;
+  const int fy = 64;
+  const int fz = 64;
+  const int nf = fx*fy*fz;
+
+  double * a_field = new double [nf];
+  double * b_field = new double [nf];
+
+  for (int iz=0; iz<fz; iz++) {
+    for (int iy=0; iy<fy; iy++) {
+      for (int ix=0; ix<fx; ix++) {
+        int i = ix + fx*(iy + fy*iz);
+        a_field[i] = sin(0.1*ix) * cos(0.2*iy) + 0.01*iz + 1.0/(i+1);
+      }
+    }
+  }
+
+  const std::string filter_list[] = { "gzip", "lz4", "zstd" };
+  const int filter_id[] = { H5Z_FILTER_DEFLATE, 32004, 32015 };
+
+  Grouping field_groups;
+  field_groups.add("density","quantized");
+  const int digits = 3;
+
+  FileHdf5 hdf5_f("./","test_filter.h5");
+  hdf5_f.file_create();
+
+  for (int i_filter=0; i_filter<3; i_filter++) {
+    FileFilter file_filter
+      (filter_list[i_filter],6,true,
+       std::vector<std::string>(1,"quantized"),std::vector<int>(1,digits));
+    hdf5_f.group_chdir ("/" + filter_list[i_filter]);
+    hdf5_f.group_create ();
+    hdf5_f.mem_create(fx,fy,fz,fx,fy,fz,0,0,0);
+    file_filter.apply_field(&hdf5_f,"velocity_x",&field_groups);
+    hdf5_f.data_create ("velocity_x",type_double, fx,fy,fz,1);
+    hdf5_f.data_write (a_field);
+    hdf5_f.data_close ();
+    file_filter.apply_field(&hdf5_f,"density",&field_groups);
+    hdf5_f.data_create ("density",type_double, fx,fy,fz,1);
+    hdf5_f.data_write (a_field);
+    hdf5_f.data_close ();
+    hdf5_f.mem_close();
+    hdf5_f.group_close ();
+  }
+
+  // small dataset fits in a single chunk
+
+  FileFilter("gzip",1,false,
+             std::vector<std::string>(),std::vector<int>()).apply(&hdf5_f);
+  hdf5_f.group_chdir ("/small");
+  hdf5_f.group_create ();
+  hdf5_f.mem_create(nx,ny,1,nx,ny,1,0,0,0);
+  hdf5_f.data_create ("double",type_double, nx,ny,1,1);
+  hdf5_f.data_write (a_double);
+  hdf5_f.data_close ();
+  hdf5_f.mem_close();
+  hdf5_f.group_close ();
+
+  hdf5_f.file_close();
+
+  //----------------------------------------------------------------------
+  unit_func("FileFilter::quantize_digits()");
+  //----------------------------------------------------------------------
+
+  FileFilter file_filter
+    ("none",0,false,
+     std::vector<std::string>(1,"quantized"),std::vector<int>(1,digits));
+
+  unit_assert (file_filter.quantize_digits("density",&field_groups) == digits);
+  unit_assert (file_filter.quantize_digits("velocity_x",&field_groups) == -1);
+
+  // Return the chunk size and the number of filters of the given
+  // dataset, and whether it uses the given filter
+
+  auto data_filters = [] (hid_t file_id, std::string name, int filter,
+                          hsize_t * chunk, int * rank, int * num_filters)
+    {
+      hid_t data_id = H5Dopen (file_id,name.c_str(),H5P_DEFAULT);
+      hid_t data_prop = H5Dget_create_plist (data_id);
+      *rank = H5Pget_chunk (data_prop,4,chunk);
+      *num_filters = H5Pget_nfilters (data_prop);
+      unsigned int flags;
+      size_t cd_nelmts = 0;
+      unsigned int filter_config;
+      bool found = (H5Pget_filter_by_id
+                    (data_prop,filter,&flags,&cd_nelmts,NULL,
+                     0,NULL,&filter_config) >= 0);
+      H5Pclose (data_prop);
+      H5Dclose (data_id);
+      return found;
+    };
+
+  hid_t file_id = H5Fopen ("./test_filter.h5",H5F_ACC_RDONLY,H5P_DEFAULT);
+
+  // Do not print the error stack for filters that are not found
+  H5Eset_auto (H5E_DEFAULT,NULL,NULL);
+
+  for (int i_filter=0; i_filter<3; i_filter++) {
+
+    const std::string group = "/" + filter_list[i_filter] + "/";
+
+    // lz4 and zstd fall back to gzip without the filter plugin
+    const int filter = (H5Zfilter_avail(filter_id[i_filter]) > 0) ?
+      filter_id[i_filter] : H5Z_FILTER_DEFLATE;
+
+    //----------------------------------------------------------------------
+    unit_func(("FileHdf5 " + filter_list[i_filter] + " filters").c_str());
+    //----------------------------------------------------------------------
+
+    hsize_t chunk[4];
+    int rank, num_filters;
+
+    unit_assert (data_filters
+                 (file_id,group + "velocity_x",filter,
+                  chunk,&rank,&num_filters));
+    unit_assert (data_filters
+                 (file_id,group + "velocity_x",H5Z_FILTER_SHUFFLE,
+                  chunk,&rank,&num_filters));
+    unit_assert (! data_filters
+                 (file_id,group + "velocity_x",H5Z_FILTER_SCALEOFFSET,
+                  chunk,&rank,&num_filters));
+    unit_assert (num_filters == 2);
+    unit_assert (data_filters
+                 (file_id,group + "density",H5Z_FILTER_SCALEOFFSET,
+                  chunk,&rank,&num_filters));
+    unit_assert (num_filters == 3);
+
+    //----------------------------------------------------------------------
+    unit_func(("FileHdf5 " + filter_list[i_filter] + " chunks").c_str());
+    //----------------------------------------------------------------------
+
+    // chunks are at most 1 MB, and not split further than needed
+
+    long long chunk_bytes = sizeof(double);
+    for (int i=0; i<rank; i++) chunk_bytes *= chunk[i];
+    unit_assert (rank == 4);
+    unit_assert (chunk_bytes <= 1024*1024);
+    unit_assert (chunk_bytes >  1024*1024/2);
+  }
+
+  //----------------------------------------------------------------------
+  unit_func("FileHdf5 small dataset chunks");
+  //----------------------------------------------------------------------
+
+  {
+    hsize_t chunk[4];
+    int rank, num_filters;
+    unit_assert (data_filters
+                 (file_id,"/small/double",H5Z_FILTER_DEFLATE,
+                  chunk,&rank,&num_filters));
+    unit_assert (num_filters == 1);
+    unit_assert (rank == 4);
+    unit_assert (chunk[0] == hsize_t(nx) && chunk[1] == hsize_t(ny) &&
+                 chunk[2] == 1 && chunk[3] == 1);
+  }
+
+  H5Fclose (file_id);
+
+  FileHdf5 hdf5_g("./","test_filter.h5");
+  hdf5_g.file_open();
+
+  for (int i_filter=0; i_filter<3; i_filter++) {
+
+    //----------------------------------------------------------------------
+    unit_func(("FileHdf5 " + filter_list[i_filter] + " lossless").c_str());
+    //----------------------------------------------------------------------
+
+    int f_nx, f_ny, f_nz;
+
+    hdf5_g.group_chdir ("/" + filter_list[i_filter]);
+    hdf5_g.group_open ();
+    hdf5_g.mem_create(fx,fy,fz,fx,fy,fz,0,0,0);
+
+    std::fill_n (b_field,nf,0.0);
+    hdf5_g.data_open ("velocity_x",&type,&f_nx,&f_ny,&f_nz);
+    hdf5_g.data_read (b_field);
+    hdf5_g.data_close ();
+
+    unit_assert (type == type_double);
+    unit_assert (f_nx == fx && f_ny == fy && f_nz == fz);
+    bool p_field = true;
+    for (int i=0; i<nf; i++) p_field = p_field && (a_field[i] == b_field[i]);
+    unit_assert (p_field);
+
+    //----------------------------------------------------------------------
+    unit_func(("FileHdf5 " + filter_list[i_filter] + " quantized").c_str());
+    //----------------------------------------------------------------------
+
+    // scale-offset error is at most 0.5*10^-digits
+
+    std::fill_n (b_field,nf,0.0);
+    hdf5_g.data_open ("density",&type,&f_nx,&f_ny,&f_nz);
+    hdf5_g.data_read (b_field);
+    hdf5_g.data_close ();
+
+    double error = 0.0;
+    for (int i=0; i<nf; i++) {
+      error = std::max(error,std::abs(a_field[i] - b_field[i]));
+    }
+    unit_assert (error <= 0.5*pow(10.0,-digits)*(1.0 + 1e-9));
+    unit_assert (error > 0.0);
+
+    hdf5_g.mem_close();
+    hdf5_g.group_close ();
+  }
+
+  hdf5_g.file_close();
+
+  delete [] a_field;
+  delete [] b_field;
+
   //--------------------------------------------------
   // Finalize
   //--------------------------------------------------
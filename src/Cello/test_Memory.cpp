@@ -245,6 +245,127 @@ PARALLEL_MAIN_BEGIN
   unit_assert(true);
 #endif/* CONFIG_USE_MEMORY */
 
+  //----------------------------------------------------------------------
+  // ScratchArena
+  //----------------------------------------------------------------------
+
+  unit_class("ScratchArena");
+
+  ScratchArena arena;
+
+  unit_func("bytes()");
+
+  unit_assert (ScratchArena::bytes<char>(1)   == ScratchArena::ALIGNMENT);
+  unit_assert (ScratchArena::bytes<double>(8) == ScratchArena::ALIGNMENT);
+  unit_assert (ScratchArena::bytes<double>(9) == 2*ScratchArena::ALIGNMENT);
+  unit_assert (ScratchArena::bytes<float>(0)  == 0);
+
+  unit_func("reserve()");
+
+  const int n1 = 1000;
+  const int n2 = 33;
+  const int n3 = 17;
+  const std::size_t bytes_arena =
+    ScratchArena::bytes<double>(n1) +
+    ScratchArena::bytes<float>(n2) +
+    ScratchArena::bytes<char>(n3);
+
+  unit_assert (arena.capacity() == 0);
+  unit_assert (arena.num_resized() == 0);
+
+  arena.reserve(bytes_arena);
+
+  unit_assert (arena.capacity() == bytes_arena);
+  unit_assert (arena.num_resized() == 1);
+  unit_assert (arena.bytes_highest() == bytes_arena);
+
+  unit_func("allocate()");
+
+  // arrays are aligned, do not overlap, and fill the reserved space
+
+  double * a1 = arena.allocate<double>(n1);
+  float  * a2 = arena.allocate<float>(n2);
+  char   * a3 = arena.allocate<char>(n3);
+
+  unit_assert ((std::size_t)(a1) % ScratchArena::ALIGNMENT == 0);
+  unit_assert ((std::size_t)(a2) % ScratchArena::ALIGNMENT == 0);
+  unit_assert ((std::size_t)(a3) % ScratchArena::ALIGNMENT == 0);
+  unit_assert ((char *)(a1 + n1) <= (char *)(a2));
+  unit_assert ((char *)(a2 + n2) <= a3);
+  unit_assert ((char *)(a3) + ScratchArena::bytes<char>(n3) ==
+               (char *)(a1) + bytes_arena);
+
+  for (int i=0; i<n1; i++) a1[i] = 1.0*i;
+  for (int i=0; i<n2; i++) a2[i] = 2.0*i;
+  for (int i=0; i<n3; i++) a3[i] = i;
+
+  bool values_match = true;
+  for (int i=0; i<n1; i++) values_match = values_match && (a1[i] == 1.0*i);
+  for (int i=0; i<n2; i++) values_match = values_match && (a2[i] == 2.0f*i);
+  unit_assert (values_match);
+
+  unit_func("reserve() reuse");
+
+  // reserving the same or fewer bytes reuses the buffer
+
+  arena.reserve(bytes_arena);
+
+  unit_assert (arena.num_resized() == 1);
+  unit_assert (arena.capacity() == bytes_arena);
+  unit_assert (arena.allocate<double>(n1) == a1);
+
+  arena.reserve(ScratchArena::bytes<double>(n1));
+
+  unit_assert (arena.num_resized() == 1);
+  unit_assert (arena.capacity() == bytes_arena);
+  unit_assert (arena.allocate<double>(n1) == a1);
+
+  unit_func("reserve() grow");
+
+  // reserving more bytes reallocates the buffer
+
+  arena.reserve(2*bytes_arena);
+
+  unit_assert (arena.num_resized() == 2);
+  unit_assert (arena.capacity() == 2*bytes_arena);
+  unit_assert (arena.bytes_highest() == 2*bytes_arena);
+
+  double * b1 = arena.allocate<double>(n1);
+  double * b2 = arena.allocate<double>(n1);
+  unit_assert ((std::size_t)(b1) % ScratchArena::ALIGNMENT == 0);
+  unit_assert ((std::size_t)(b2) % ScratchArena::ALIGNMENT == 0);
+
+  arena.reserve(bytes_arena);
+
+  unit_assert (arena.num_resized() == 2);
+  unit_assert (arena.capacity() == 2*bytes_arena);
+  unit_assert (arena.bytes_highest() == 2*bytes_arena);
+
+  unit_func("bytes_available()");
+
+  // allocate() requires bytes<T>(n) <= bytes_available()
+
+  arena.reserve(bytes_arena);
+
+  unit_assert (arena.bytes_available() == bytes_arena);
+  arena.allocate<double>(n1);
+  unit_assert (arena.bytes_available() ==
+               bytes_arena - ScratchArena::bytes<double>(n1));
+  arena.allocate<float>(n2);
+  arena.allocate<char>(n3);
+  unit_assert (arena.bytes_available() == 0);
+  unit_assert (ScratchArena::bytes<char>(1) > arena.bytes_available());
+
+  arena.reserve(bytes_arena);
+
+  unit_assert (arena.bytes_available() == bytes_arena);
+
+  unit_func("clear()");
+
+  arena.clear();
+
+  unit_assert (arena.capacity() == 0);
+
   unit_finalize();
 
   exit_();
@@ -102,6 +102,8 @@ void generate_input()
   fp << "    var_float_2 {\n";
   fp << "       num1 = sin(x);\n";
   fp << "       num2 = atan(y/3.0+3.0*t);\n";
+  fp << "       num3 = sqrt(x*x+y*y+z*z)*exp((x-y)/(2.0*3.0))"
+     << " + 4.0*t*t - x/(1.0+z*z);\n";
   fp << "     }\n";
   fp << "  }\n";
 
@@ -396,6 +398,14 @@ void check_parameters(Parameters * parameters)
   unit_assert (CLOSE(values_float[1],atan(y[1]/3.0+3*t)));
   unit_assert (CLOSE(values_float[2],atan(y[2]/3.0+3*t)));
 
+  parameters->evaluate_float("num3",3,values_float,deflts_float,x,y,z,t);
+  for (int i=0; i<3; i++) {
+    const double value =
+      sqrt(x[i]*x[i]+y[i]*y[i]+z[i]*z[i])*exp((x[i]-y[i])/6.0)
+      + 4.0*t*t - x[i]/(1.0+z[i]*z[i]);
+    unit_assert (cello::err_rel(values_float[i],value) < 1e-12);
+  }
+
   //--------------------------------------------------
   unit_func("evaluate_logical");
   //--------------------------------------------------
@@ -543,6 +553,59 @@ void check_parameters(Parameters * parameters)
 
 }
 
+//----------------------------------------------------------------------
+
+void benchmark_evaluate_float(Parameters * parameters)
+/// Time evaluating a floating-point expression over a large grid, and
+/// compare with the same expression written in C++
+{
+  //--------------------------------------------------
+  unit_func("evaluate_float (benchmark)");
+  //--------------------------------------------------
+
+  const int n = 64*64*64;
+  const int num_repeat = 10;
+  std::vector<double> x(n), y(n), z(n), value(n), value_cpp(n);
+  std::vector<double> deflt(n,0.0);
+  for (int i=0; i<n; i++) {
+    x[i] = (i % 64) / 64.0;
+    y[i] = ((i/64) % 64) / 64.0;
+    z[i] = (i/(64*64)) / 64.0;
+  }
+  const double t = 0.5;
+
+  parameters->group_set(0,"Float_expr");
+  parameters->group_set(1,"var_float_2");
+
+  Timer timer;
+  timer.start();
+  for (int k=0; k<num_repeat; k++) {
+    parameters->evaluate_float
+      ("num3",n,value.data(),deflt.data(),x.data(),y.data(),z.data(),t);
+  }
+  timer.stop();
+
+  Timer timer_cpp;
+  timer_cpp.start();
+  for (int k=0; k<num_repeat; k++) {
+    for (int i=0; i<n; i++) {
+      value_cpp[i] = sqrt(x[i]*x[i]+y[i]*y[i]+z[i]*z[i])*exp((x[i]-y[i])/6.0)
+        + 4.0*t*t - x[i]/(1.0+z[i]*z[i]);
+    }
+  }
+  timer_cpp.stop();
+
+  bool match = true;
+  for (int i=0; i<n; i++) {
+    match = match && (cello::err_rel(value[i],value_cpp[i]) < 1e-12);
+  }
+  unit_assert (match);
+
+  const double cells = 1e-6*n*num_repeat;
+  CkPrintf ("evaluate_float  Mcells/s  expression: %7.2f  C++: %7.2f\n",
+            cells/timer.value(), cells/timer_cpp.value());
+}
+
 //======================================================================
 
 PARALLEL_MAIN_BEGIN
@@ -574,6 +637,8 @@ PARALLEL_MAIN_BEGIN
 
   check_parameters(parameters1);
 
+  benchmark_evaluate_float(parameters1);
+
   parameters1->write ( "test1.out", param_write_cello );
 
 
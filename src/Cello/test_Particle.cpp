@@ -1055,6 +1055,158 @@ PARALLEL_MAIN_BEGIN
   delete [] buffer;
   // printf ("error_gather_int %d\n",error_gather_int);
 
+  //--------------------------------------------------
+  // sort(), sort_offset()
+  //--------------------------------------------------
+
+  unit_func("sort()");
+  {
+    const int np_sort = new_p.num_particles(it_dark);
+    std::vector<int> key (np_sort);
+    nb = new_p.num_batches(it_dark);
+    // key particles by cell in reverse row-major order
+    for (int ib=0,i=0; ib<nb; ib++) {
+      int np = new_p.num_particles(it_dark,ib);
+      float * xa = (float *) new_p.attribute_array(it_dark,ia_dark_x,ib);
+      float * ya = (float *) new_p.attribute_array(it_dark,ia_dark_y,ib);
+      for (int ip=0; ip<np; ip++,i++) {
+	int ix = (int)(xa[ip*dx]-1);
+	int iy = (int)(ya[ip*dx]-1);
+	key[i] = ndx*ndy - 1 - (ix + ndx*iy);
+      }
+    }
+    unit_assert (new_p.sort_offset(it_dark) == nullptr);
+    unit_assert (new_p.sort(it_dark,key.data(),ndx*ndy) == (np_sort > 1));
+    unit_assert (new_p.num_particles(it_dark) == np_sort);
+
+    const std::vector<int> * offset = new_p.sort_offset(it_dark);
+    unit_assert (offset != nullptr);
+    unit_assert (offset && (int)offset->size() == ndx*ndy+1);
+    unit_assert (offset && (*offset)[ndx*ndy] == np_sort);
+
+    // particles must be in key order and agree with offsets
+    int error_sort = 0;
+    nb = new_p.num_batches(it_dark);
+    int key_prev = -1;
+    for (int ib=0,i=0; ib<nb; ib++) {
+      int np = new_p.num_particles(it_dark,ib);
+      if (ib < nb-1 && np != new_p.batch_size()) ++error_sort;
+      float * xa = (float *) new_p.attribute_array(it_dark,ia_dark_x,ib);
+      float * ya = (float *) new_p.attribute_array(it_dark,ia_dark_y,ib);
+      for (int ip=0; ip<np; ip++,i++) {
+	int ix = (int)(xa[ip*dx]-1);
+	int iy = (int)(ya[ip*dx]-1);
+	int k = ndx*ndy - 1 - (ix + ndx*iy);
+	key[i] = k;
+	if (k < key_prev) ++error_sort;
+	if (offset && ! ((*offset)[k] <= i && i < (*offset)[k+1])) ++error_sort;
+	key_prev = k;
+      }
+    }
+    unit_assert (error_sort == 0);
+
+    // already sorted: no particles moved
+    unit_assert (new_p.sort(it_dark,key.data(),ndx*ndy) == false);
+
+    // inserting particles invalidates the offsets
+    new_p.insert_particles(it_dark,1);
+    unit_assert (new_p.sort_offset(it_dark) == nullptr);
+  }
+
+  //--------------------------------------------------
+  // scatter() benchmark
+  //--------------------------------------------------
+
+  unit_func("scatter() rate");
+  {
+    // scatter to 16 slots with repeated and NULL destinations, as
+    // for neighbor blocks in particle_scatter_neighbors_().  As
+    // there, particles in the NULL slot are masked out
+    const int np_bench = 200000;
+    const int num_repeat = 4;
+    ParticleData pd_bench_src;
+    ParticleData pd_bench_dst[8];
+    ParticleData * pd_bench[16];
+    for (int k=0; k<16; k++) {
+      pd_bench[k] = (k == 5) ? NULL : &pd_bench_dst[k % 8];
+    }
+    Particle p_bench (particle_descr,&pd_bench_src);
+    p_bench.insert_particles(it_dark,np_bench);
+    const int mb = p_bench.batch_size();
+    std::vector<int> index_bench (mb);
+    std::vector<char> mask_bench (mb);
+    for (int ip=0; ip<mb; ip++) {
+      index_bench[ip] = ip % 16;
+      mask_bench[ip] = (pd_bench[ip % 16] != NULL);
+    }
+    const bool * mask = (const bool *) mask_bench.data();
+
+    // tag every byte of every attribute with the particle and attribute
+    // so that scattered particles can be matched to their source
+    const int na = p_bench.num_attributes(it_dark);
+    auto tag = [] (int i, int ia, int k)
+      { return (char)(i*31 + ia*7 + k); };
+    for (int ib=0,i=0; ib<p_bench.num_batches(it_dark); ib++) {
+      const int np = p_bench.num_particles(it_dark,ib);
+      for (int ip=0; ip<np; ip++,i++) {
+	for (int ia=0; ia<na; ia++) {
+	  const int ny = p_bench.attribute_bytes(it_dark,ia);
+	  const int dp = p_bench.stride(it_dark,ia)*ny;
+	  char * a = p_bench.attribute_array(it_dark,ia,ib) + ip*dp;
+	  for (int k=0; k<ny; k++) a[k] = tag(i,ia,k);
+	}
+      }
+    }
+
+    Timer timer;
+    timer.start();
+    int np_scatter = 0;
+    for (int i=0; i<num_repeat; i++) {
+      for (int ib=0; ib<p_bench.num_batches(it_dark); ib++) {
+	const int np = p_bench.num_particles(it_dark,ib);
+	p_bench.scatter (it_dark,ib,np,mask,index_bench.data(),
+			 16,pd_bench);
+	for (int ip=0; ip<np; ip++) if (mask[ip]) ++np_scatter;
+      }
+    }
+    timer.stop();
+
+    int np_dst = 0;
+    for (int k=0; k<8; k++) {
+      np_dst += Particle(particle_descr,&pd_bench_dst[k]).num_particles(it_dark);
+    }
+    unit_assert (np_dst == np_scatter);
+
+    // each destination must hold its source particles in source
+    // order, with all attributes (including positions) intact
+    int error_scatter = 0;
+    for (int k=0; k<8; k++) {
+      Particle p_dst (particle_descr,&pd_bench_dst[k]);
+      int i_dst = 0;
+      for (int repeat=0; repeat<num_repeat; repeat++) {
+	for (int ib=0,i=0; ib<p_bench.num_batches(it_dark); ib++) {
+	  const int np = p_bench.num_particles(it_dark,ib);
+	  for (int ip=0; ip<np; ip++,i++) {
+	    if (! mask[ip] || (index_bench[ip] % 8) != k) continue;
+	    int ib_dst,ip_dst;
+	    p_dst.index(i_dst++,&ib_dst,&ip_dst);
+	    for (int ia=0; ia<na; ia++) {
+	      const int ny = p_dst.attribute_bytes(it_dark,ia);
+	      const int dp = p_dst.stride(it_dark,ia)*ny;
+	      const char * a =
+		p_dst.attribute_array(it_dark,ia,ib_dst) + ip_dst*dp;
+	      for (int iy=0; iy<ny; iy++) if (a[iy] != tag(i,ia,iy)) ++error_scatter;
+	    }
+	  }
+	}
+      }
+    }
+    unit_assert (error_scatter == 0);
+
+    printf ("scatter: %g particles/s\n",
+	    (timer.value() > 0.0) ? np_scatter / timer.value() : 0.0);
+  }
+
   //--------------------------------------------------
   //   Grouping
   //--------------------------------------------------
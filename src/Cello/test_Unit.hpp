@@ -142,4 +142,9 @@ private:
   Timer timer_;
 };
 
+/// Return count per second of elapsed time in timer, or 0 if no time
+/// has elapsed; used to report throughput in micro-benchmark tests
+inline double unit_rate (double count, const Timer & timer)
+{ return (timer.value() > 0.0) ? count / timer.value() : 0.0; }
+
 #endif /* TEST_UNIT_HPP */
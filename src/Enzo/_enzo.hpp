@@ -270,6 +270,7 @@ extern "C" {
 #include "assorted/EnzoMethodM1Closure.hpp"
 #include "gravity/EnzoMethodPmDeposit.hpp"
 #include "particle/EnzoMethodPmUpdate.hpp"
+#include "particle/EnzoParticleKernels.hpp"
 #include "hydro-mhd/EnzoMethodPpm.hpp"
 #include "hydro-mhd/EnzoMethodPpml.hpp"
 #include "particle/formation/EnzoMethodSinkMaker.hpp"
@@ -299,6 +300,7 @@ extern "C" {
 #include "gravity/solvers/EnzoSolverDiagonal.hpp"
 #include "gravity/solvers/EnzoSolverJacobi.hpp"
 #include "gravity/solvers/EnzoSolverMg0.hpp"
+#include "gravity/solvers/EnzoSolverPipelinedBiCgStab.hpp"
 
 #include "enzo-core/EnzoStopping.hpp"
 
@@ -16,6 +16,8 @@ EnzoMethodGrackle::EnzoMethodGrackle
 (
  GrackleChemistryData my_chemistry,
  bool use_cooling_timestep,
+ bool batch_blocks,
+ double skip_cooling_time_ratio,
  const double radiation_redshift,
  const double physics_cosmology_initial_redshift,
  const double time
@@ -28,10 +30,20 @@ EnzoMethodGrackle::EnzoMethodGrackle
     grackle_rates_(),
     time_grackle_data_initialized_(ENZO_FLOAT_UNDEFINED),
     radiation_redshift_(radiation_redshift),
-    use_cooling_timestep_(use_cooling_timestep)
+    use_cooling_timestep_(use_cooling_timestep),
+    batch_blocks_(batch_blocks),
+    batch_list_(),
+    batch_pending_(false),
+    batch_buffer_(),
+    skip_cooling_time_ratio_(skip_cooling_time_ratio)
 #endif
 {
 #ifdef CONFIG_USE_GRACKLE
+  ASSERT("EnzoMethodGrackle::EnzoMethodGrackle",
+         "Method:grackle:batch_blocks can't be used with "
+         "Method:grackle:skip_cooling_time_ratio",
+         ! (batch_blocks && (skip_cooling_time_ratio > 0.0)));
+
   // sanity check:
   if ((radiation_redshift >= 0) && (enzo::cosmology() != nullptr)){
     ERROR("EnzoMethodGrackle::EnzoMethodGrackle",
@@ -142,6 +154,13 @@ void EnzoMethodGrackle::define_required_grackle_fields
     cello::define_field("volumetric_heating_rate");
   }
 
+  // time elapsed since each cell was last updated, and its cooling
+  // time when it was last computed
+  if (skip_cooling_time_ratio_ > 0.0) {
+    cello::define_field("grackle_elapsed_time");
+    cello::define_field("grackle_cooling_time");
+  }
+
 }
 #endif /* CONFIG_USE_GRACKLE */
 
@@ -150,6 +169,15 @@ void EnzoMethodGrackle::define_required_grackle_fields
 void EnzoMethodGrackle::compute ( Block * block) throw()
 {
 
+#ifdef CONFIG_USE_GRACKLE
+  if (batch_blocks_) {
+    // Blocks resume in EnzoBlock::p_method_grackle_end() after all Blocks
+    // on this process have been solved together
+    compute_batch_(block);
+    return;
+  }
+#endif
+
   if (block->is_leaf()){
 
 #ifndef CONFIG_USE_GRACKLE
@@ -482,6 +510,33 @@ void EnzoMethodGrackle::update_grackle_density_fields(
 #ifdef CONFIG_USE_GRACKLE
 
 void EnzoMethodGrackle::compute_ ( Block * block) throw()
+{
+  check_dual_energy_(block);
+
+  /* Set code units for use in grackle */
+  grackle_field_data grackle_fields;
+
+  EnzoFieldAdaptor fadaptor(block, 0);
+
+  setup_grackle_units(fadaptor, &this->grackle_units_);
+  setup_grackle_fields(fadaptor, &grackle_fields);
+
+  if (skip_cooling_time_ratio_ > 0.0) {
+    solve_deferred_(block, &grackle_fields);
+  } else {
+    solve_chemistry_(&grackle_fields, block->dt());
+  }
+
+  update_block_(block, &grackle_fields, skip_cooling_time_ratio_ > 0.0);
+
+  delete_grackle_fields(&grackle_fields);
+
+  return;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodGrackle::check_dual_energy_ ( Block * block) const throw()
 {
   const EnzoConfig * enzo_config = enzo::config();
   if (block->cycle() == enzo_config->initial_cycle) {
@@ -494,7 +549,50 @@ void EnzoMethodGrackle::compute_ ( Block * block) throw()
            "be in use, when EnzoMethodGrackle is used with a (M)HD-solver",
            nohydro | !enzo::fluid_props()->dual_energy_config().is_disabled());
   }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodGrackle::solve_chemistry_
+(grackle_field_data * grackle_fields, double dt) throw()
+{
+  // Slabs along the outermost axis are distributed among threads: each
+  // thread passes Grackle a copy of grackle_fields (and grackle_units_)
+  // whose grid_start and grid_end span only its own slabs
+  const int axis = grackle_fields->grid_rank - 1;
+  auto solve_slabs = [&](int i_start, int i_stop)
+    {
+      int slab_start[3], slab_end[3];
+      for (int i=0; i<3; i++) {
+        slab_start[i] = grackle_fields->grid_start[i];
+        slab_end[i]   = grackle_fields->grid_end[i];
+      }
+      // grid_end is inclusive
+      slab_start[axis] = i_start;
+      slab_end[axis]   = i_stop - 1;
+
+      grackle_field_data slab_fields = *grackle_fields;
+      slab_fields.grid_start = slab_start;
+      slab_fields.grid_end   = slab_end;
+      code_units slab_units = grackle_units_;
+
+      if (local_solve_chemistry(my_chemistry_.get_ptr(), &grackle_rates_,
+                                &slab_units, &slab_fields, dt)
+          == ENZO_FAIL) {
+        ERROR("EnzoMethodGrackle::compute()",
+              "Error in local_solve_chemistry.\n");
+      }
+    };
+  ParallelFor::apply(grackle_fields->grid_start[axis],
+                     grackle_fields->grid_end[axis] + 1, solve_slabs);
+}
+
+//----------------------------------------------------------------------
 
+void EnzoMethodGrackle::update_block_
+(Block * block, const grackle_field_data * grackle_fields, bool skip_ghosts)
+  throw()
+{
   Field field = block->data()->field();
 
   int gx,gy,gz;
@@ -509,31 +607,14 @@ void EnzoMethodGrackle::compute_ ( Block * block) throw()
 
   const int rank = cello::rank();
 
-  /* Set code units for use in grackle */
-  grackle_field_data grackle_fields;
-
-  EnzoFieldAdaptor fadaptor(block, 0);
-
-  setup_grackle_units(fadaptor, &this->grackle_units_);
-  setup_grackle_fields(fadaptor, &grackle_fields);
-
-  // Solve chemistry
-  double dt = block->dt();
-  if (local_solve_chemistry(my_chemistry_.get_ptr(), &grackle_rates_,
-			    &grackle_units_, &grackle_fields, dt)
-      == ENZO_FAIL) {
-    ERROR("EnzoMethodGrackle::compute()",
-    "Error in local_solve_chemistry.\n");
-  }
-
   // enforce metallicity floor (if one was provided)
   enforce_metallicity_floor(block);
 
   /* Correct total energy for changes in internal energy */
   gr_float * v3[3];
-  v3[0] = grackle_fields.x_velocity;
-  v3[1] = grackle_fields.y_velocity;
-  v3[2] = grackle_fields.z_velocity;
+  v3[0] = grackle_fields->x_velocity;
+  v3[1] = grackle_fields->y_velocity;
+  v3[2] = grackle_fields->z_velocity;
 
   const bool mhd = field.is_field("bfield_x");
   enzo_float * b3[3] = {NULL, NULL, NULL};
@@ -543,31 +624,420 @@ void EnzoMethodGrackle::compute_ ( Block * block) throw()
     if (rank >= 3) b3[2] = (enzo_float*) field.values("bfield_z");
   }
 
+  // ghost zones are only updated if Grackle was applied to them
+  const int ox = skip_ghosts ? gx : 0;
+  const int oy = skip_ghosts ? gy : 0;
+  const int oz = skip_ghosts ? gz : 0;
+
   enzo_float * total_energy    = (enzo_float *) field.values("total_energy");
-  for (int i = 0; i < ngx*ngy*ngz; i++){
-    total_energy[i] = grackle_fields.internal_energy[i];
-
-    enzo_float inv_density;
-    if (mhd) inv_density = 1.0 / grackle_fields.density[i];
-    for (int dim = 0; dim < rank; dim++){
-      total_energy[i] += 0.5 * v3[dim][i] * v3[dim][i];
-      if (mhd) total_energy[i] += 0.5 * b3[dim][i] * b3[dim][i] * inv_density;
+  for (int iz = oz; iz < ngz - oz; iz++) {
+    for (int iy = oy; iy < ngy - oy; iy++) {
+      for (int ix = ox; ix < ngx - ox; ix++) {
+        int i = INDEX(ix, iy, iz, ngx, ngy);
+        total_energy[i] = grackle_fields->internal_energy[i];
+
+        enzo_float inv_density;
+        if (mhd) inv_density = 1.0 / grackle_fields->density[i];
+        for (int dim = 0; dim < rank; dim++){
+          total_energy[i] += 0.5 * v3[dim][i] * v3[dim][i];
+          if (mhd) total_energy[i] += 0.5*b3[dim][i]*b3[dim][i]*inv_density;
+        }
+      }
     }
   }
 
   // For testing purposes - reset internal energies with changes in mu
-  if (enzo_config->initial_grackle_test_reset_energies){
+  if (enzo::config()->initial_grackle_test_reset_energies){
     this->ResetEnergies(block);
   }
+}
 
-  delete_grackle_fields(&grackle_fields);
+//----------------------------------------------------------------------
 
-  return;
+namespace {
+
+  /// Grackle field that may be gathered into a batch
+  struct GrackleBatchField {
+    /// pointer to the grackle_field_data member
+    gr_float * grackle_field_data::* member;
+    /// whether Grackle updates the field, so that it must be scattered
+    /// back to the Blocks
+    bool is_output;
+  };
+
+  /// Fields set by EnzoMethodGrackle::setup_grackle_fields()
+  const GrackleBatchField grackle_batch_fields[] = {
+    {&grackle_field_data::density,                 false},
+    {&grackle_field_data::internal_energy,         true},
+    {&grackle_field_data::x_velocity,              false},
+    {&grackle_field_data::y_velocity,              false},
+    {&grackle_field_data::z_velocity,              false},
+    {&grackle_field_data::HI_density,              true},
+    {&grackle_field_data::HII_density,             true},
+    {&grackle_field_data::HeI_density,             true},
+    {&grackle_field_data::HeII_density,            true},
+    {&grackle_field_data::HeIII_density,           true},
+    {&grackle_field_data::e_density,               true},
+    {&grackle_field_data::HM_density,              true},
+    {&grackle_field_data::H2I_density,             true},
+    {&grackle_field_data::H2II_density,            true},
+    {&grackle_field_data::DI_density,              true},
+    {&grackle_field_data::DII_density,             true},
+    {&grackle_field_data::HDI_density,             true},
+    {&grackle_field_data::metal_density,           false},
+    {&grackle_field_data::RT_heating_rate,         false},
+    {&grackle_field_data::RT_HI_ionization_rate,   false},
+    {&grackle_field_data::RT_HeI_ionization_rate,  false},
+    {&grackle_field_data::RT_HeII_ionization_rate, false},
+    {&grackle_field_data::RT_H2_dissociation_rate, false},
+    {&grackle_field_data::volumetric_heating_rate, false},
+    {&grackle_field_data::specific_heating_rate,   false}
+  };
+
+  /// Copy the active (non-ghost) cells of a Block field to (or from) the
+  /// contiguous array batch_values
+  void copy_active_cells_(Block * block, gr_float * values,
+                          gr_float * batch_values, bool to_batch)
+  {
+    Field field = block->data()->field();
+
+    int gx,gy,gz;
+    field.ghost_depth (0,&gx,&gy,&gz);
+
+    int nx,ny,nz;
+    field.size (&nx,&ny,&nz);
+
+    int ngx = nx + 2*gx;
+    int ngy = ny + 2*gy;
+
+    int j = 0;
+    for (int iz = gz; iz < gz + nz; iz++) {
+      for (int iy = gy; iy < gy + ny; iy++) {
+        const int i = INDEX(gx, iy, iz, ngx, ngy);
+        if (to_batch) {
+          for (int ix=0; ix<nx; ix++) batch_values[j+ix] = values[i+ix];
+        } else {
+          for (int ix=0; ix<nx; ix++) values[i+ix] = batch_values[j+ix];
+        }
+        j += nx;
+      }
+    }
+  }
+
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodGrackle::compute_batch_ ( Block * block) throw()
+{
+  batch_list_.push_back(block);
+
+  // Blocks that skip this method would leave a batch waiting for every
+  // Block on the process forever, so the first Block in a batch also
+  // sends itself p_method_grackle_batch(), which solves the batch once
+  // the entry methods already queued on this process have run
+
+  if (! batch_pending_) {
+    batch_pending_ = true;
+    enzo::block_array()[block->index()].p_method_grackle_batch();
+  }
+
+  // don't wait if every Block on this process has been added
+  if (batch_list_.size() >= cello::hierarchy()->num_blocks()) {
+    compute_batch_end_();
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodGrackle::compute_batch_flush () throw()
+{
+  batch_pending_ = false;
+  compute_batch_end_();
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodGrackle::compute_batch_end_ () throw()
+{
+  if (batch_list_.size() == 0) return;
+
+  Simulation * simulation = cello::simulation();
+  simulation->performance()->start_region(perf_grackle,__FILE__,__LINE__);
+
+  solve_batch_();
+
+  simulation->performance()->stop_region(perf_grackle,__FILE__,__LINE__);
+
+  // Resume all Blocks in the batch
+  std::vector<Block *> block_list;
+  block_list.swap(batch_list_);
+  for (Block * block_batch : block_list) {
+    enzo::block_array()[block_batch->index()].p_method_grackle_end();
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodGrackle::solve_batch_ () throw()
+{
+  Performance * performance = cello::simulation()->performance();
+
+  // Cells in a batch must have the same width, and are solved with the
+  // units and timestep of a single Block, so leaf Blocks are grouped by
+  // level, cycle, time, and timestep
+  typedef std::tuple<int, int, double, double> batch_key;
+  std::map<batch_key, std::vector<Block *> > group_list;
+  for (Block * block : batch_list_) {
+    if (block->is_leaf()) {
+      const batch_key key
+        (block->level(), block->cycle(), block->time(), block->dt());
+      group_list[key].push_back(block);
+    }
+  }
+
+  const int num_fields =
+    sizeof(grackle_batch_fields) / sizeof(grackle_batch_fields[0]);
+
+  for (const auto & group_blocks : group_list) {
+
+    const std::vector<Block *> & block_list = group_blocks.second;
+    const int num_blocks = block_list.size();
+
+    check_dual_energy_(block_list[0]);
+
+    performance->start_region(perf_grackle_gather,__FILE__,__LINE__);
+
+    // Grackle fields for each Block, and the offset of each Block's
+    // active cells within the batch
+    std::vector<grackle_field_data> block_fields(num_blocks);
+    std::vector<int> offset(num_blocks + 1, 0);
+    for (int ib=0; ib<num_blocks; ib++) {
+      setup_grackle_fields(block_list[ib], &block_fields[ib]);
+      int nx,ny,nz;
+      block_list[ib]->data()->field().size(&nx,&ny,&nz);
+      offset[ib+1] = offset[ib] + nx*ny*nz;
+    }
+    const int n = offset[num_blocks];
+
+    // The batch is a one-dimensional grid with no ghost zones
+    int batch_dimension[3] = {n,   1, 1};
+    int batch_start[3]     = {0,   0, 0};
+    int batch_end[3]       = {n-1, 0, 0};
+
+    grackle_field_data batch_fields = block_fields[0];
+    batch_fields.grid_rank      = 1;
+    batch_fields.grid_dimension = batch_dimension;
+    batch_fields.grid_start     = batch_start;
+    batch_fields.grid_end       = batch_end;
+
+    // Gather the active cells of all fields into batch_buffer_
+    int num_batch_fields = 0;
+    for (int k=0; k<num_fields; k++) {
+      if (block_fields[0].*(grackle_batch_fields[k].member) != nullptr) {
+        ++num_batch_fields;
+      }
+    }
+    batch_buffer_.resize((size_t)num_batch_fields*n);
+
+    gr_float * batch_values = batch_buffer_.data();
+    for (int k=0; k<num_fields; k++) {
+      gr_float * grackle_field_data::* member = grackle_batch_fields[k].member;
+      if (block_fields[0].*member == nullptr) {
+        batch_fields.*member = nullptr;
+        continue;
+      }
+      batch_fields.*member = batch_values;
+      for (int ib=0; ib<num_blocks; ib++) {
+        copy_active_cells_(block_list[ib], block_fields[ib].*member,
+                           batch_values + offset[ib], true);
+      }
+      batch_values += n;
+    }
+
+    performance->stop_region(perf_grackle_gather,__FILE__,__LINE__);
+
+    // Solve chemistry for the whole batch
+
+    performance->start_region(perf_grackle_solve,__FILE__,__LINE__);
+
+    setup_grackle_units(EnzoFieldAdaptor(block_list[0], 0),
+                        &this->grackle_units_);
+    solve_chemistry_(&batch_fields, block_list[0]->dt());
+
+    performance->stop_region(perf_grackle_solve,__FILE__,__LINE__);
+
+    // Scatter updated fields back to the Blocks
+
+    performance->start_region(perf_grackle_scatter,__FILE__,__LINE__);
+
+    for (int k=0; k<num_fields; k++) {
+      gr_float * grackle_field_data::* member = grackle_batch_fields[k].member;
+      if (batch_fields.*member == nullptr ||
+          ! grackle_batch_fields[k].is_output) continue;
+      for (int ib=0; ib<num_blocks; ib++) {
+        copy_active_cells_(block_list[ib], block_fields[ib].*member,
+                           batch_fields.*member + offset[ib], false);
+      }
+    }
+
+    for (int ib=0; ib<num_blocks; ib++) {
+      update_block_(block_list[ib], &block_fields[ib], true);
+      delete_grackle_fields(&block_fields[ib]);
+    }
+
+    performance->stop_region(perf_grackle_scatter,__FILE__,__LINE__);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodGrackle::solve_deferred_
+(Block * block, grackle_field_data * grackle_fields) throw()
+{
+  Field field = block->data()->field();
+
+  int gx,gy,gz;
+  field.ghost_depth (0,&gx,&gy,&gz);
+
+  int nx,ny,nz;
+  field.size (&nx,&ny,&nz);
+
+  int ngx = nx + 2*gx;
+  int ngy = ny + 2*gy;
+  int ngz = nz + 2*gz;
+
+  const double dt = block->dt();
+
+  if (dt <= 0.0) return;
+
+  enzo_float * elapsed_time =
+    (enzo_float *) field.values("grackle_elapsed_time");
+  enzo_float * cooling_time =
+    (enzo_float *) field.values("grackle_cooling_time");
+
+  // A cell is updated once its cooling time is no longer than
+  // skip_cooling_time_ratio_ times the time elapsed since its last update.
+  // The cooling time is only recomputed for cells that would be due for
+  // an update given the cooling time saved when it was last computed.
+  std::vector<int> candidate;
+  for (int iz = gz; iz < ngz - gz; iz++) {
+    for (int iy = gy; iy < ngy - gy; iy++) {
+      for (int ix = gx; ix < ngx - gx; ix++) {
+        const int i = INDEX(ix, iy, iz, ngx, ngy);
+        elapsed_time[i] += dt;
+        if (cooling_time[i] <= skip_cooling_time_ratio_ * elapsed_time[i]) {
+          candidate.push_back(i);
+        }
+      }
+    }
+  }
+
+  if (candidate.size() == 0) return;
+
+  const int num_fields =
+    sizeof(grackle_batch_fields) / sizeof(grackle_batch_fields[0]);
+
+  // The cells in index are solved as a one-dimensional grid
+  int group_dimension[3] = {0, 1, 1};
+  int group_start[3]     = {0, 0, 0};
+  int group_end[3]       = {0, 0, 0};
+  grackle_field_data group_fields = *grackle_fields;
+  group_fields.grid_rank      = 1;
+  group_fields.grid_dimension = group_dimension;
+  group_fields.grid_start     = group_start;
+  group_fields.grid_end       = group_end;
+
+  int num_group_fields = 0;
+  for (int k=0; k<num_fields; k++) {
+    if (grackle_fields->*(grackle_batch_fields[k].member) != nullptr) {
+      ++num_group_fields;
+    }
+  }
+
+  // Copy the cells in index into batch_buffer_
+  auto gather = [&](const std::vector<int> & index)
+    {
+      const int n = index.size();
+      group_dimension[0] = n;
+      group_end[0] = n - 1;
+      batch_buffer_.resize((size_t)num_group_fields*n);
+      gr_float * group_values = batch_buffer_.data();
+      for (int k=0; k<num_fields; k++) {
+        gr_float * grackle_field_data::* member =
+          grackle_batch_fields[k].member;
+        const gr_float * values = grackle_fields->*member;
+        if (values == nullptr) continue;
+        group_fields.*member = group_values;
+        for (int j=0; j<n; j++) group_values[j] = values[index[j]];
+        group_values += n;
+      }
+    };
+
+  // Compute the cooling time of the candidate cells only
+
+  gather(candidate);
+  std::vector<enzo_float> candidate_cooling_time (candidate.size());
+  calculate_cooling_time(EnzoFieldAdaptor(block, 0),
+                         candidate_cooling_time.data(), 0,
+                         &this->grackle_units_, &group_fields);
+
+  // Cells due for an update are advanced by their elapsed time rounded
+  // down to dt times a power of two, and the remainder is carried to
+  // their next update, so that they fall into a few groups that are each
+  // solved with one Grackle call
+  std::map<int, std::vector<int> > groups;
+  for (size_t j=0; j<candidate.size(); j++) {
+    const int i = candidate[j];
+    cooling_time[i] = std::abs(candidate_cooling_time[j]);
+    if (cooling_time[i] <= skip_cooling_time_ratio_ * elapsed_time[i]) {
+      int level = 0;
+      while (std::ldexp(dt, level + 1) <= elapsed_time[i]) ++level;
+      groups[level].push_back(i);
+      elapsed_time[i] -= std::ldexp(dt, level);
+    }
+  }
+
+  for (const auto & group : groups) {
+
+    const std::vector<int> & index = group.second;
+    const int n = index.size();
+
+    gather(index);
+
+    solve_chemistry_(&group_fields, std::ldexp(dt, group.first));
+
+    for (int k=0; k<num_fields; k++) {
+      gr_float * grackle_field_data::* member = grackle_batch_fields[k].member;
+      gr_float * values = grackle_fields->*member;
+      if (values == nullptr || ! grackle_batch_fields[k].is_output) continue;
+      for (int j=0; j<n; j++) values[index[j]] = (group_fields.*member)[j];
+    }
+  }
 }
+
 #endif // config use grackle
 
 //----------------------------------------------------------------------
 
+void EnzoBlock::p_method_grackle_batch()
+{
+#ifdef CONFIG_USE_GRACKLE
+  EnzoMethodGrackle * method =
+    static_cast<EnzoMethodGrackle*> (enzo::problem()->method("grackle"));
+  method->compute_batch_flush();
+#endif
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_method_grackle_end()
+{
+  compute_done();
+}
+
+//----------------------------------------------------------------------
+
 double EnzoMethodGrackle::timestep ( Block * block ) throw()
 {
   double dt = std::numeric_limits<double>::max();;
@@ -50,6 +50,8 @@ public: // interface
   /// Create a new EnzoMethodGrackle object
   EnzoMethodGrackle(GrackleChemistryData my_chemistry,
                     bool use_cooling_timestep,
+                    bool batch_blocks,
+                    double skip_cooling_time_ratio,
                     const double radiation_redshift,
                     const double physics_cosmology_initial_redshift,
                     const double time);
@@ -70,6 +72,11 @@ public: // interface
       , time_grackle_data_initialized_(ENZO_FLOAT_UNDEFINED)
       , radiation_redshift_(-1.0)
       , use_cooling_timestep_(false)
+      , batch_blocks_(false)
+      , batch_list_()
+      , batch_pending_(false)
+      , batch_buffer_()
+      , skip_cooling_time_ratio_(0.0)
 #endif
     {  }
 
@@ -90,6 +97,8 @@ public: // interface
     p | last_init_time;
     p | radiation_redshift_;
     p | use_cooling_timestep_;
+    p | batch_blocks_;
+    p | skip_cooling_time_ratio_;
     if (p.isUnpacking()) {
       ASSERT("EnzoMethodGrackle::pup",
              "grackle_chemistry_data must have previously been initialized",
@@ -115,6 +124,13 @@ public: // interface
   /// Compute maximum timestep for this method
   virtual double timestep ( Block * block) throw();
 
+#ifdef CONFIG_USE_GRACKLE
+  /// Solve the current batch of Blocks, if any, and resume them.
+  /// Called from EnzoBlock::p_method_grackle_batch(), which the first
+  /// Block in each batch sends to itself
+  void compute_batch_flush () throw();
+#endif
+
   /// returns the stored instance of GrackleChemistryData, if the simulation is
   /// configured to actually use grackle
   const GrackleChemistryData* try_get_chemistry() const throw() {
@@ -265,6 +281,41 @@ protected: // methods
 #ifdef CONFIG_USE_GRACKLE
   void compute_( Block * block) throw();
 
+  /// Check that the dual-energy formalism is used with a hydro method
+  void check_dual_energy_ ( Block * block) const throw();
+
+  /// Call Grackle's local_solve_chemistry, distributing slabs of the grid
+  /// among threads
+  void solve_chemistry_ (grackle_field_data * grackle_fields,
+                         double dt) throw();
+
+  /// Update the Block's fields after Grackle has been applied; when
+  /// skip_ghosts is true, ghost zones are not updated
+  void update_block_ (Block * block,
+                      const grackle_field_data * grackle_fields,
+                      bool skip_ghosts) throw();
+
+  /// Add the Block to the batch of Blocks on this process, and solve the
+  /// batch once all Blocks have been added, or once the Blocks already
+  /// waiting to run on this process have been added
+  void compute_batch_ ( Block * block) throw();
+
+  /// Solve the Blocks in batch_list_, if any, and resume them
+  void compute_batch_end_ () throw();
+
+  /// Solve chemistry for the active cells of all leaf Blocks in
+  /// batch_list_, with one Grackle call for each group of Blocks with
+  /// the same level, cycle, time, and timestep
+  void solve_batch_ () throw();
+
+  /// Solve chemistry only for active cells whose cooling time is short
+  /// compared to the time elapsed since they were last updated, using
+  /// the elapsed time rounded down to dt times a power of two as the
+  /// timestep.  The cooling time is only recomputed for cells that the
+  /// previously computed value ("grackle_cooling_time") makes due
+  void solve_deferred_ (Block * block,
+                        grackle_field_data * grackle_fields) throw();
+
   void ResetEnergies ( Block * block) throw();
 
 #endif
@@ -283,6 +334,25 @@ protected: // attributes
 
   bool use_cooling_timestep_;
 
+  /// Whether to solve all Blocks on a process with a single batched call
+  bool batch_blocks_;
+
+  /// Blocks added to the current batch (not PUP'ed: empty outside of
+  /// compute)
+  std::vector<Block *> batch_list_;
+
+  /// Whether EnzoBlock::p_method_grackle_batch() has been sent to solve
+  /// the current batch (not PUP'ed)
+  bool batch_pending_;
+
+  /// Contiguous storage for the batched fields
+  std::vector<gr_float> batch_buffer_;
+
+  /// Cells are not updated while their cooling time exceeds this ratio
+  /// times the time elapsed since their last update (0 to update all
+  /// cells every cycle)
+  double skip_cooling_time_ratio_;
+
 #endif
 
 };
@@ -246,6 +246,14 @@ public: /// entry methods
   /// sink fields.
   void p_method_accretion_end();
 
+  /// EnzoMethodGrackle: solve the batch of Blocks waiting on this
+  /// process, if it hasn't already been solved
+  void p_method_grackle_batch();
+
+  /// EnzoMethodGrackle: resume after the batch containing this Block has
+  /// been solved
+  void p_method_grackle_end();
+
   // ------------------------------------------------
   
   /// EnzoSolverCg entry method: DOT ==> refresh P
@@ -304,6 +312,30 @@ public: /// entry methods
   /// EnzoSolverBiCGStab entry method: ITER++
   void r_solver_bicgstab_loop_15(CkReductionMsg* msg);
 
+  //--------------------------------------------------
+
+  /// EnzoSolverPipelinedBiCgStab entry method: SUM(B) and COUNT(B)
+  void r_solver_pbicgstab_start_1(CkReductionMsg* msg);
+
+  /// EnzoSolverPipelinedBiCgStab entry method: refresh R
+  void p_solver_pbicgstab_start_2();
+
+  /// EnzoSolverPipelinedBiCgStab entry method: refresh W
+  void p_solver_pbicgstab_start_3();
+
+  /// EnzoSolverPipelinedBiCgStab entry method: DOT(R0,R), DOT(R0,W),
+  /// DOT(R0,S), DOT(R0,Z), DOT(R,R) and SUM(X)
+  void r_solver_pbicgstab_loop_0(CkReductionMsg* msg);
+
+  /// EnzoSolverPipelinedBiCgStab entry method: refresh W
+  void p_solver_pbicgstab_loop_0();
+
+  /// EnzoSolverPipelinedBiCgStab entry method: DOT(Q,Y) and DOT(Y,Y)
+  void r_solver_pbicgstab_loop_1(CkReductionMsg* msg);
+
+  /// EnzoSolverPipelinedBiCgStab entry method: refresh Z
+  void p_solver_pbicgstab_loop_1();
+
   void p_dot_recv_parent  (int n, long double * dot_block,
 			   std::vector<int> is_array,
 			   int i_function, int iter);
@@ -200,6 +200,9 @@ EnzoConfig::EnzoConfig() throw ()
   method_check_ordering("order_morton"),
   method_check_dir(),
   method_check_monitor_iter(0),
+  method_check_layout("block"),
+  method_check_async(false),
+  method_check_async_memory(0),
   // EnzoInitialMergeSinksTest
   initial_merge_sinks_test_particle_data_filename(""),
   // EnzoInitialAccretionTest
@@ -312,6 +315,8 @@ EnzoConfig::EnzoConfig() throw ()
   method_grackle_use_grackle(false),
   method_grackle_chemistry(),
   method_grackle_use_cooling_timestep(false),
+  method_grackle_batch_blocks(false),
+  method_grackle_skip_cooling_time_ratio(0.0),
   method_grackle_radiation_redshift(-1.0),
   // EnzoMethodGravity
   method_gravity_grav_const(0.0),
@@ -335,12 +340,14 @@ EnzoConfig::EnzoConfig() throw ()
   method_pm_deposit_alpha(0.5),
   /// EnzoMethodPmUpdate
   method_pm_update_max_dt(std::numeric_limits<double>::max()),
+  method_pm_update_sort_order("none"),
   /// EnzoMethodMHDVlct
   method_vlct_riemann_solver(""),
   method_vlct_half_dt_reconstruct_method(""),
   method_vlct_full_dt_reconstruct_method(""),
   method_vlct_theta_limiter(0.0),
   method_vlct_mhd_choice(""),
+  method_vlct_tile_depth(0),
   /// EnzoMethodMergeSinks
   method_merge_sinks_merging_radius_cells(0.0),
   /// EnzoMethodAccretion
@@ -608,6 +615,9 @@ void EnzoConfig::pup (PUP::er &p)
   p | method_check_ordering;
   p | method_check_dir;
   p | method_check_monitor_iter;
+  p | method_check_layout;
+  p | method_check_async;
+  p | method_check_async_memory;
 
   PUParray(p,initial_accretion_test_sink_position,3);
   PUParray(p,initial_accretion_test_sink_velocity,3);
@@ -744,12 +754,14 @@ void EnzoConfig::pup (PUP::er &p)
 
   p | method_pm_deposit_alpha;
   p | method_pm_update_max_dt;
+  p | method_pm_update_sort_order;
 
   p | method_vlct_riemann_solver;
   p | method_vlct_half_dt_reconstruct_method;
   p | method_vlct_full_dt_reconstruct_method;
   p | method_vlct_theta_limiter;
   p | method_vlct_mhd_choice;
+  p | method_vlct_tile_depth;
 
   p | method_merge_sinks_merging_radius_cells;
 
@@ -792,6 +804,8 @@ void EnzoConfig::pup (PUP::er &p)
 
   if (method_grackle_use_grackle) {
     p  | method_grackle_use_cooling_timestep;
+    p  | method_grackle_batch_blocks;
+    p  | method_grackle_skip_cooling_time_ratio;
     p  | method_grackle_radiation_redshift;
     p  | method_grackle_chemistry;
   }
@@ -1521,6 +1535,12 @@ void EnzoConfig::read_method_grackle_(Parameters * p)
     method_grackle_use_cooling_timestep = p->value_logical
       ("Method:grackle:use_cooling_timestep", false);
 
+    method_grackle_batch_blocks = p->value_logical
+      ("Method:grackle:batch_blocks", false);
+
+    method_grackle_skip_cooling_time_ratio = p->value_float
+      ("Method:grackle:skip_cooling_time_ratio", 0.0);
+
     // for when not using cosmology - redshift of UVB
     method_grackle_radiation_redshift = p->value_float
       ("Method:grackle:radiation_redshift", -1.0);
@@ -1545,7 +1565,8 @@ void EnzoConfig::read_method_grackle_(Parameters * p)
     //      be updated if we introduce additional parameters for configuring
     //      EnzoMethodGrackle)
     const std::unordered_set<std::string> ignore_leaf_names =
-      {"use_cooling_timestep", "radiation_redshift",
+      {"use_cooling_timestep", "batch_blocks", "skip_cooling_time_ratio",
+       "radiation_redshift",
        // the next option is deprecated and is only listed in the short-term
        // for backwards compatability (it should now be replaced by
        // "Physics:fluid_props:floors:metallicity")
@@ -1888,6 +1909,8 @@ void EnzoConfig::read_method_vlct_(Parameters * p)
     ("Method:mhd_vlct:full_dt_reconstruct_method","plm");
   method_vlct_theta_limiter = p->value_float
     ("Method:mhd_vlct:theta_limiter", 1.5);
+  method_vlct_tile_depth = p->value_integer
+    ("Method:mhd_vlct:tile_depth", 0);
 
   // we should raise an error if mhd_choice is not specified
   bool uses_vlct = false;
@@ -1948,6 +1971,17 @@ void EnzoConfig::read_method_check_(Parameters * p)
     }
   }
   method_check_monitor_iter = p->value_integer("monitor_iter",0);
+
+  method_check_layout = p->value_string("layout","block");
+
+  ASSERT1 ("EnzoConfig::read_method_check_()",
+           "Method:check:layout \"%s\" must be \"block\" or \"aggregate\"",
+           method_check_layout.c_str(),
+           (method_check_layout == "block" ||
+            method_check_layout == "aggregate"));
+
+  method_check_async = p->value_logical("async",false);
+  method_check_async_memory = p->value_integer("async_memory",0);
 }
 
 //----------------------------------------------------------------------
@@ -2060,6 +2094,8 @@ void EnzoConfig::read_method_pm_update_(Parameters * p)
 {
   method_pm_update_max_dt = p->value_float
     ("Method:pm_update:max_dt", std::numeric_limits<double>::max());
+  method_pm_update_sort_order = p->value_string
+    ("Method:pm_update:sort_order", "none");
 }
 
 //----------------------------------------------------------------------
@@ -258,6 +258,9 @@ public: // interface
       method_check_ordering("order_morton"),
       method_check_dir(),
       method_check_monitor_iter(0),
+      method_check_layout("block"),
+      method_check_async(false),
+      method_check_async_memory(0),
       /// EnzoMethodFeedback
       method_feedback_ejecta_mass(0.0),
       method_feedback_ejecta_metal_fraction(0.0),
@@ -354,6 +357,8 @@ public: // interface
       method_grackle_use_grackle(false),
       method_grackle_chemistry(),
       method_grackle_use_cooling_timestep(false),
+      method_grackle_batch_blocks(false),
+      method_grackle_skip_cooling_time_ratio(0.0),
       method_grackle_radiation_redshift(-1.0),
       // EnzoMethodGravity
       method_gravity_grav_const(0.0),
@@ -377,12 +382,14 @@ public: // interface
       method_pm_deposit_alpha(0.5),
       // EnzoMethodPmUpdate
       method_pm_update_max_dt(0.0),
+      method_pm_update_sort_order(""),
       // EnzoMethodMHDVlct
       method_vlct_riemann_solver(""),
       method_vlct_half_dt_reconstruct_method(""),
       method_vlct_full_dt_reconstruct_method(""),
       method_vlct_theta_limiter(0.0),
       method_vlct_mhd_choice(""),
+      method_vlct_tile_depth(0),
       // EnzoMethodMergeSinks
       method_merge_sinks_merging_radius_cells(0.0),
       // EnzoMethodAccretion
@@ -771,6 +778,9 @@ public: // attributes
   std::string                method_check_ordering;
   std::vector<std::string>   method_check_dir;
   int                        method_check_monitor_iter;
+  std::string                method_check_layout;
+  bool                       method_check_async;
+  int                        method_check_async_memory;
 
   /// EnzoMethodCheckGravity
   std::string                method_check_gravity_particle_type;
@@ -879,6 +889,8 @@ public: // attributes
   bool                       method_grackle_use_grackle;
   GrackleChemistryData       method_grackle_chemistry;
   bool                       method_grackle_use_cooling_timestep;
+  bool                       method_grackle_batch_blocks;
+  double                     method_grackle_skip_cooling_time_ratio;
   double                     method_grackle_radiation_redshift;
 
   /// EnzoMethodGravity
@@ -912,6 +924,7 @@ public: // attributes
   /// EnzoMethodPmUpdate
 
   double                     method_pm_update_max_dt;
+  std::string                method_pm_update_sort_order;
 
   /// EnzoMethodMHDVlct
   std::string                method_vlct_riemann_solver;
@@ -919,6 +932,7 @@ public: // attributes
   std::string                method_vlct_full_dt_reconstruct_method;
   double                     method_vlct_theta_limiter;
   std::string                method_vlct_mhd_choice;
+  int                        method_vlct_tile_depth;
 
   /// EnzoMethodMergeSinks
   double                     method_merge_sinks_merging_radius_cells;
@@ -32,9 +32,12 @@ EnzoMsgCheck::EnzoMsgCheck()
     name_this_(),
     name_next_(),
     index_block_(),
+    num_blocks_file_(0),
+    pe_send_(-1),
     is_first_(),
     is_last_(),
     name_dir_(),
+    hierarchy_meta_(),
     index_file_(-1)
 {
   ++counter[cello::index_static()];
@@ -109,9 +112,12 @@ void * EnzoMsgCheck::pack (EnzoMsgCheck * msg)
   SIZE_STRING_TYPE(size,msg->name_this_);
   SIZE_STRING_TYPE(size,msg->name_next_);
   SIZE_SCALAR_TYPE(size,long long,msg->index_block_);
+  SIZE_SCALAR_TYPE(size,int,msg->num_blocks_file_);
+  SIZE_SCALAR_TYPE(size,int,msg->pe_send_);
   SIZE_SCALAR_TYPE(size,bool,msg->is_first_);
   SIZE_SCALAR_TYPE(size,bool,msg->is_last_);
   SIZE_STRING_TYPE(size,msg->name_dir_);
+  SIZE_VECTOR_TYPE(size,char,msg->hierarchy_meta_);
   SIZE_SCALAR_TYPE(size,int,msg->index_file_);
   SIZE_ARRAY_TYPE (size,int,msg->adapt_buffer_,ADAPT_BUFFER_SIZE);
 
@@ -159,9 +165,12 @@ void * EnzoMsgCheck::pack (EnzoMsgCheck * msg)
   SAVE_STRING_TYPE(pc,msg->name_this_);
   SAVE_STRING_TYPE(pc,msg->name_next_);
   SAVE_SCALAR_TYPE(pc,long long,msg->index_block_);
+  SAVE_SCALAR_TYPE(pc,int,msg->num_blocks_file_);
+  SAVE_SCALAR_TYPE(pc,int,msg->pe_send_);
   SAVE_SCALAR_TYPE(pc,bool,msg->is_first_);
   SAVE_SCALAR_TYPE(pc,bool,msg->is_last_);
   SAVE_STRING_TYPE(pc,msg->name_dir_);
+  SAVE_VECTOR_TYPE(pc,char,msg->hierarchy_meta_);
   SAVE_SCALAR_TYPE(pc,int,msg->index_file_);
   SAVE_ARRAY_TYPE (pc,int,msg->adapt_buffer_,ADAPT_BUFFER_SIZE);
 
@@ -170,6 +179,13 @@ void * EnzoMsgCheck::pack (EnzoMsgCheck * msg)
 	  (pc - (char*)buffer),size,
 	  (pc - (char*)buffer) == size);
 
+  // The message is freed without calling its destructor, so delete
+  // the objects it owns here
+  if (msg->is_local_) {
+    delete msg->data_msg_;
+    delete msg->io_block_;
+  }
+
   CkFreeMsg (msg);
   // Return the buffer
   return (void *) buffer;
@@ -230,9 +246,12 @@ EnzoMsgCheck * EnzoMsgCheck::unpack(void * buffer)
   LOAD_STRING_TYPE(pc,msg->name_this_);
   LOAD_STRING_TYPE(pc,msg->name_next_);
   LOAD_SCALAR_TYPE(pc,long long,msg->index_block_);
+  LOAD_SCALAR_TYPE(pc,int,msg->num_blocks_file_);
+  LOAD_SCALAR_TYPE(pc,int,msg->pe_send_);
   LOAD_SCALAR_TYPE(pc,bool,msg->is_first_);
   LOAD_SCALAR_TYPE(pc,bool,msg->is_last_);
   LOAD_STRING_TYPE(pc,msg->name_dir_);
+  LOAD_VECTOR_TYPE(pc,char,msg->hierarchy_meta_);
   LOAD_SCALAR_TYPE(pc,int,msg->index_file_);
   LOAD_ARRAY_TYPE (pc,int,msg->adapt_buffer_,ADAPT_BUFFER_SIZE);
 
@@ -22,6 +22,7 @@ public: // interface
   friend class EnzoBlock;
   friend class IoEnzoWriter;
   friend class IoEnzoReader;
+  friend class EnzoSimulation;
 
   static long counter[CONFIG_NODE_SIZE];
 
@@ -127,6 +128,24 @@ public: // interface
   void set_name_dir (std::string name_dir)
   { name_dir_ = name_dir; }
 
+  /// Set the number of blocks written to the same file as this one
+  void set_num_blocks_file (int num_blocks_file)
+  { num_blocks_file_ = num_blocks_file; }
+  int num_blocks_file() const { return num_blocks_file_; }
+
+  /// Set the processing element holding the message before it is sent
+  void set_pe_send (int pe_send) { pe_send_ = pe_send; }
+  int pe_send() const { return pe_send_; }
+
+  /// Return the size in bytes of the Block data held by the message
+  int data_size() const
+  { return data_msg_ ? data_msg_->data_size() : 0; }
+
+  /// [Method:check:async] Return the file metadata saved when the
+  /// message was staged, or an empty vector
+  const std::vector<char> & hierarchy_meta() const
+  { return hierarchy_meta_; }
+
   void set_io_block(IoBlock * io_block) { io_block_ = io_block; }
   IoBlock * io_block() { return io_block_; }
 
@@ -160,9 +179,12 @@ protected: // methods
     name_this_   = enzo_msg_check.name_this_;
     name_next_   = enzo_msg_check.name_next_;
     index_block_ = enzo_msg_check.index_block_;
+    num_blocks_file_ = enzo_msg_check.num_blocks_file_;
+    pe_send_     = enzo_msg_check.pe_send_;
     is_first_    = enzo_msg_check.is_first_;
     is_last_     = enzo_msg_check.is_last_;
     name_dir_    = enzo_msg_check.name_dir_;
+    hierarchy_meta_ = enzo_msg_check.hierarchy_meta_;
     std::copy_n ( enzo_msg_check.adapt_buffer_, ADAPT_BUFFER_SIZE,
                   adapt_buffer_);
     index_file_  = enzo_msg_check.index_file_;
@@ -206,11 +228,17 @@ protected: // attributes
   std::string name_this_;
   std::string name_next_;
   long long index_block_;
+  int num_blocks_file_;
+  int pe_send_;
   bool is_first_;
   bool is_last_;
 
   std::string name_dir_;
 
+  /// [Method:check:async] File metadata saved by
+  /// IoEnzoWriter::save_hierarchy_meta() when the message was staged
+  std::vector<char> hierarchy_meta_;
+
   /// Array holding serialized Array object
   int adapt_buffer_[ADAPT_BUFFER_SIZE];
   
@@ -456,6 +456,22 @@ Solver * EnzoProblem::create_solver_
        enzo_config->solver_precondition[index_solver],
        enzo_config->solver_coarse_level[index_solver]);
 
+  } else if (solver_type == "pbicgstab") {
+
+    solver = new EnzoSolverPipelinedBiCgStab
+      (enzo_config->solver_list[index_solver],
+       enzo_config->solver_field_x[index_solver],
+       enzo_config->solver_field_b[index_solver],
+       enzo_config->solver_monitor_iter[index_solver],
+       enzo_config->solver_restart_cycle[index_solver],
+       solve_type,
+       index_prolong,
+       index_restrict,
+       enzo_config->solver_min_level[index_solver],
+       enzo_config->solver_max_level[index_solver],
+       enzo_config->solver_iter_max[index_solver],
+       enzo_config->solver_res_tol[index_solver]);
+
   } else if (solver_type == "diagonal") {
 
     solver = new EnzoSolverDiagonal
@@ -621,7 +637,8 @@ Method * EnzoProblem::create_method_
   } else if (name == "pm_update") {
 
     method = new EnzoMethodPmUpdate
-      (enzo_config->method_pm_update_max_dt);
+      (enzo_config->method_pm_update_max_dt,
+       enzo_config->method_pm_update_sort_order);
 
   } else if (name == "heat") {
 
@@ -636,6 +653,8 @@ Method * EnzoProblem::create_method_
     method = new EnzoMethodGrackle
       (enzo_config->method_grackle_chemistry,
        enzo_config->method_grackle_use_cooling_timestep,
+       enzo_config->method_grackle_batch_blocks,
+       enzo_config->method_grackle_skip_cooling_time_ratio,
        enzo_config->method_grackle_radiation_redshift,
        enzo_config->physics_cosmology_initial_redshift,
        enzo::simulation()->time());
@@ -710,7 +729,8 @@ Method * EnzoProblem::create_method_
        enzo_config->method_vlct_full_dt_reconstruct_method,
        enzo_config->method_vlct_theta_limiter,
        enzo_config->method_vlct_mhd_choice,
-       store_fluxes_for_corrections);
+       store_fluxes_for_corrections,
+       enzo_config->method_vlct_tile_depth);
 
   } else if (name == "background_acceleration") {
 
@@ -763,7 +783,13 @@ Method * EnzoProblem::create_method_
       (enzo_config->method_check_num_files,
        enzo_config->method_check_ordering,
        enzo_config->method_check_dir,
-       enzo_config->method_check_monitor_iter);
+       enzo_config->method_check_monitor_iter,
+       enzo_config->method_check_layout,
+       FileFilter(config->method_compress[index_method],
+                  config->method_compress_level[index_method],
+                  config->method_compress_shuffle[index_method],
+                  config->method_quantize_fields[index_method],
+                  config->method_quantize_digits[index_method]));
 
   } else if (name == "merge_sinks") {
 
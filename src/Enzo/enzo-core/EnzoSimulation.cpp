@@ -39,7 +39,16 @@ EnzoSimulation::EnzoSimulation
     check_num_files_(0),
     check_ordering_(""),
     check_directory_(),
-    restart_level_(0)
+    check_active_(false),
+    check_pending_(false),
+    check_exit_pending_(false),
+    check_staged_(),
+    check_bytes_(),
+    check_staged_bytes_(0),
+    check_in_flight_(0),
+    check_blocked_(),
+    restart_level_(0),
+    restart_time_read_(0.0)
 {
 #ifdef CHECK_MEMORY
   mtrace();
@@ -92,7 +101,13 @@ void EnzoSimulation::pup (PUP::er &p)
   p | check_num_files_;
   p | check_ordering_;
   p | check_directory_;
+  p | check_active_;
+  p | check_pending_;
+  p | check_exit_pending_;
+  // check_staged_, check_bytes_, check_staged_bytes_,
+  // check_in_flight_ and check_blocked_ are transient
   p | restart_level_;
+  p | restart_time_read_;
 
   if (p.isUnpacking()) {
     EnzoBlock::initialize(enzo::config());
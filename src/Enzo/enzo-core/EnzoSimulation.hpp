@@ -66,6 +66,17 @@ public: // functions
   /// EnzoMethodCheck
   void r_method_check_enter (CkReductionMsg *);
   void p_check_done();
+
+  /// [Method:check:async] Take ownership of a Block's checkpoint
+  /// message, copying its data so that the Block can continue.
+  /// Return false if the Block must wait for staging memory, in which
+  /// case it is later sent p_check_done()
+  bool check_stage (EnzoMsgCheck * msg_check, int index_file, Index index);
+  /// [Method:check:async] A staged message has been written
+  void p_check_written(long long index_block);
+  /// [Method:check:async] Return true if exiting must wait for
+  /// checkpoint writes to complete, which then call Main::p_exit()
+  bool check_defer_exit();
   void p_set_io_reader(CProxy_IoEnzoReader proxy);
   void p_set_io_writer(CProxy_IoEnzoWriter proxy);
   void p_set_level_array(CProxy_EnzoLevelArray proxy);
@@ -91,8 +102,9 @@ public: // functions
   void p_infer_done();
 
   /// Read in and initialize the next refinement level from a checkpoint;
-  /// or exit if done
-  void p_restart_next_level();
+  /// or exit if done.  time_read is the reader's total time spent
+  /// reading block data so far
+  void p_restart_next_level(double time_read);
   void p_restart_level_created();
 
 public: // virtual functions
@@ -107,6 +119,11 @@ private: // functions
 
   void infer_check_create_();
 
+  /// Create the checkpoint directory and start writing blocks
+  void check_start_();
+  /// Send staged checkpoint messages to IoEnzoWriters
+  void check_send_();
+
 private: // virtual functions
 
   virtual void initialize_config_() throw();
@@ -127,11 +144,30 @@ private: // attributes
   int                      check_num_files_;
   std::string              check_ordering_;
   std::vector<std::string> check_directory_;
+  /// [Method:check:async] whether writers are still writing a
+  /// checkpoint, and whether another checkpoint or exiting is waiting
+  /// for them
+  bool                     check_active_;
+  bool                     check_pending_;
+  bool                     check_exit_pending_;
+  /// [Method:check:async] Checkpoint messages on this process
+  /// waiting to be sent, with their file index
+  std::vector< std::pair<int,EnzoMsgCheck *> > check_staged_;
+  /// [Method:check:async] Bytes of staged or unwritten messages sent
+  /// from this process, by block index
+  std::map<long long,long long> check_bytes_;
+  long long                check_staged_bytes_;
+  /// [Method:check:async] Number of messages sent but not written
+  int                      check_in_flight_;
+  /// [Method:check:async] Blocks waiting for staging memory
+  std::vector<Index>       check_blocked_;
 
   /// Balance Method synchronization
   Sync sync_method_balance_;
   /// Current restart level
   int restart_level_; 
+  /// Maximum time any IoEnzoReader has spent reading block data
+  double restart_time_read_;
 #ifdef BYPASS_CHARM_MEM_LEAK
   std::map<Index,EnzoMsgCheck *> msg_check_map_;
 #endif
@@ -284,6 +284,11 @@ PARALLEL_MAIN_BEGIN
 
  //--------------------------------------------------
 
+#ifdef CONFIG_SMP_MODE
+  // Initialize CkLoop for ParallelFor loops, using one thread per PE
+  CkLoop_Init(-1);
+#endif
+
   proxy_main     = thishandle;
 
   // --------------------------------------------------
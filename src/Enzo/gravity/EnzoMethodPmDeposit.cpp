@@ -152,6 +152,10 @@ namespace { // define local helper functions in anonymous namespace
     // to zero.
     int dm;
 
+    // Batches of non-interleaved particle types, which are deposited
+    // using vectorized kernels after the loop over particle types
+    std::vector< std::pair<int,int> > soa_batches;
+
     // Loop over particle types in "is_gravitating" group
     for (int ipt = 0; ipt < num_is_grav; ipt++) {
       const int it = particle.type_index(particle_groups->item("is_gravitating",ipt));
@@ -172,6 +176,12 @@ namespace { // define local helper functions in anonymous namespace
 	       ((be == 4) ? "single" : ((be == 8) ? "double" : "quadruple")),
 	       (ba == be));
 
+      if (! particle.interleaved(it)) {
+        for (int ib=0; ib<particle.num_batches(it); ib++) {
+          soa_batches.push_back(std::make_pair(it,ib));
+        }
+        continue;
+      }
 
       // Loop over batches
       for (int ib=0; ib<particle.num_batches(it); ib++) {
@@ -424,6 +434,66 @@ namespace { // define local helper functions in anonymous namespace
 
     } // Loop over particle types in "is_gravitating" group
 
+    if (soa_batches.empty()) return;
+
+    // Deposit non-interleaved particle types with vectorized kernels,
+    // using a private density array per thread if more than one
+
+    const double hxi = nx / (xp - xm);
+    const double hyi = ny / (yp - ym);
+    const double hzi = nz / (zp - zm);
+
+    auto deposit_batch = [&](int i, enzo_float * de)
+      {
+        const int it = soa_batches[i].first;
+        const int ib = soa_batches[i].second;
+        const int np = particle.num_particles(it,ib);
+        const enzo_float * xa[3] = {nullptr,nullptr,nullptr};
+        const enzo_float * va[3] = {nullptr,nullptr,nullptr};
+        const char * axis[3] = {"x","y","z"};
+        const char * vaxis[3] = {"vx","vy","vz"};
+        for (int axis_index=0; axis_index<rank; axis_index++) {
+          xa[axis_index] = (enzo_float *) particle.attribute_array
+            (it,particle.attribute_index(it,axis[axis_index]),ib);
+          va[axis_index] = (enzo_float *) particle.attribute_array
+            (it,particle.attribute_index(it,vaxis[axis_index]),ib);
+        }
+        const enzo_float * pm;
+        int dpm;
+        if (particle.has_attribute(it,"mass")) {
+          pm = (enzo_float *) particle.attribute_array
+            (it,particle.attribute_index(it,"mass"),ib);
+          dpm = 1;
+        } else {
+          pm = (enzo_float *) particle.constant_value
+            (it,particle.constant_index(it,"mass"));
+          dpm = 0;
+        }
+        if (rank == 1) {
+          enzo_particle_kernels::cic_deposit<1>
+            (de,mx,my, xa[0],xa[1],xa[2], va[0],va[1],va[2], dt_div_cosmoa,
+             pm,dpm,inv_vol,np, xm,ym,zm, hxi,hyi,hzi, gx,gy,gz);
+        } else if (rank == 2) {
+          enzo_particle_kernels::cic_deposit<2>
+            (de,mx,my, xa[0],xa[1],xa[2], va[0],va[1],va[2], dt_div_cosmoa,
+             pm,dpm,inv_vol,np, xm,ym,zm, hxi,hyi,hzi, gx,gy,gz);
+        } else {
+          enzo_particle_kernels::cic_deposit<3>
+            (de,mx,my, xa[0],xa[1],xa[2], va[0],va[1],va[2], dt_div_cosmoa,
+             pm,dpm,inv_vol,np, xm,ym,zm, hxi,hyi,hzi, gx,gy,gz);
+        }
+      };
+
+    const int m = mx*my*mz;
+    enzo_particle_kernels::deposit_private
+      (de_p, m, soa_batches.size(), deposit_batch);
+
+    for (int i=0; i<m; i++) {
+      if (de_p[i] < 0.0)
+        WARNING3("EnzoMethodPmDeposit",
+                 "Block %s: de_p[%d] = %g",
+                 block->name().c_str(),i,de_p[i]);
+    }
   }
 
   //----------------------------------------------------------------------
@@ -23,7 +23,7 @@ void EnzoMatrixLaplace::matvec (int i_y, int i_x, Block * block,
   enzo_float * X = (enzo_float * ) field.values(i_x);
   enzo_float * Y = (enzo_float * ) field.values(i_y);
   
-  matvec_(Y,X,g0);
+  matvec_(Y,X,g0,0,mz_);
 }
 
 //----------------------------------------------------------------------
@@ -32,7 +32,145 @@ void EnzoMatrixLaplace::matvec
 (precision_type precision,
  void * y, void * x, int g0) throw()
 {
-  matvec_((enzo_float *)(y),(enzo_float *)(x),g0);
+  matvec_((enzo_float *)(y),(enzo_float *)(x),g0,0,mz_);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMatrixLaplace::matvec_dot
+(int i_y, int i_x, int n, const int * iw, long double * dot,
+ Block * block, int g0) throw()
+{
+  Field field = block->data()->field();
+
+  field.dimensions(0,&mx_,&my_,&mz_);
+  block->cell_width (&hx_,&hy_,&hz_);
+
+  int gx,gy,gz;
+  field.ghost_depth(i_y,&gx,&gy,&gz);
+
+  enzo_float * X = (enzo_float * ) field.values(i_x);
+  enzo_float * Y = (enzo_float * ) field.values(i_y);
+  std::vector<const enzo_float *> W(n);
+  for (int k=0; k<n; k++) W[k] = (const enzo_float *) field.values(iw[k]);
+
+  // Sweep through the block in z-slabs small enough that the slab of
+  // Y just computed is still in cache when it is read for the dot
+  // products.  Partial sums are kept per slab, so that slabs can be
+  // evaluated concurrently and the result is independent of the
+  // number of threads
+
+  const int nb = slab_depth_(n + 2);
+  const int num_slabs = (mz_ + nb - 1) / nb;
+  std::vector<long double> partial (num_slabs*n,0.0);
+
+  auto compute_slabs = [&](int is_start, int is_stop)
+    {
+      for (int is=is_start; is<is_stop; is++) {
+	const int iz_start = is*nb;
+	const int iz_stop  = std::min(mz_,iz_start + nb);
+	matvec_(Y,X,g0,iz_start,iz_stop);
+	for (int k=0; k<n; k++) {
+	  const enzo_float * Wk = W[k];
+	  long double sum = 0.0;
+	  for (int iz=std::max(gz,iz_start); iz<std::min(mz_-gz,iz_stop); iz++) {
+	    for (int iy=gy; iy<my_-gy; iy++) {
+	      for (int ix=gx; ix<mx_-gx; ix++) {
+		const int i = ix + mx_*(iy + my_*iz);
+		sum += Y[i]*Wk[i];
+	      }
+	    }
+	  }
+	  partial[is*n+k] = sum;
+	}
+      }
+    };
+
+  ParallelFor::apply(0,num_slabs,compute_slabs);
+
+  for (int k=0; k<n; k++) {
+    dot[k] = 0.0;
+    for (int is=0; is<num_slabs; is++) dot[k] += partial[is*n+k];
+  }
+}
+
+//----------------------------------------------------------------------
+
+long double EnzoMatrixLaplace::residual_norm
+(int i_r, int i_b, int i_x, Block * block, int g0) throw()
+{
+  Field field = block->data()->field();
+
+  field.dimensions(0,&mx_,&my_,&mz_);
+  block->cell_width (&hx_,&hy_,&hz_);
+
+  int gx,gy,gz;
+  field.ghost_depth(i_r,&gx,&gy,&gz);
+
+  enzo_float * X = (enzo_float * ) field.values(i_x);
+  enzo_float * R = (enzo_float * ) field.values(i_r);
+  const enzo_float * B = (const enzo_float * ) field.values(i_b);
+
+  return residual_norm_(R,B,X,g0,gx,gy,gz);
+}
+
+//----------------------------------------------------------------------
+
+long double EnzoMatrixLaplace::residual_norm
+(precision_type precision, void * r, void * b, void * x, int g0,
+ int gx, int gy, int gz) throw()
+{
+  return residual_norm_((enzo_float *)(r),(const enzo_float *)(b),
+			(enzo_float *)(x),g0,gx,gy,gz);
+}
+
+//----------------------------------------------------------------------
+
+long double EnzoMatrixLaplace::residual_norm_
+(enzo_float * R, const enzo_float * B, enzo_float * X, int g0,
+ int gx, int gy, int gz) const throw()
+{
+  // zones updated by R <-- B - R, as in Matrix::residual()
+  const int ix0 = (mx_ > 1) ? g0 : 0;
+  const int iy0 = (my_ > 1) ? g0 : 0;
+  const int iz0 = (mz_ > 1) ? g0 : 0;
+
+  const int nb = slab_depth_(3);
+  const int num_slabs = (mz_ + nb - 1) / nb;
+  std::vector<long double> partial (num_slabs,0.0);
+
+  auto compute_slabs = [&](int is_start, int is_stop)
+    {
+      for (int is=is_start; is<is_stop; is++) {
+	const int iz_start = is*nb;
+	const int iz_stop  = std::min(mz_,iz_start + nb);
+	matvec_(R,X,g0,iz_start,iz_stop);
+	for (int iz=std::max(iz0,iz_start); iz<std::min(mz_-iz0,iz_stop); iz++) {
+	  for (int iy=iy0; iy<my_-iy0; iy++) {
+	    for (int ix=ix0; ix<mx_-ix0; ix++) {
+	      const int i = ix + mx_*(iy + my_*iz);
+	      R[i] = B[i] - R[i];
+	    }
+	  }
+	}
+	long double sum = 0.0;
+	for (int iz=std::max(gz,iz_start); iz<std::min(mz_-gz,iz_stop); iz++) {
+	  for (int iy=gy; iy<my_-gy; iy++) {
+	    for (int ix=gx; ix<mx_-gx; ix++) {
+	      const int i = ix + mx_*(iy + my_*iz);
+	      sum += R[i]*R[i];
+	    }
+	  }
+	}
+	partial[is] = sum;
+      }
+    };
+
+  ParallelFor::apply(0,num_slabs,compute_slabs);
+
+  long double rr = 0.0;
+  for (int is=0; is<num_slabs; is++) rr += partial[is];
+  return rr;
 }
 
 //----------------------------------------------------------------------
@@ -51,8 +189,19 @@ void EnzoMatrixLaplace::diagonal (int i_x, Block * block, int g0) throw()
 
 //----------------------------------------------------------------------
 
+int EnzoMatrixLaplace::slab_depth_ (int num_fields) const throw()
+{
+  // Target working set per slab: about the size of a typical L2 cache
+  const long slab_bytes = 256*1024;
+  const long plane_bytes = long(mx_)*my_*sizeof(enzo_float)*num_fields;
+  return std::max(1L, slab_bytes / std::max(1L,plane_bytes));
+}
+
+//----------------------------------------------------------------------
+
 void EnzoMatrixLaplace::matvec_
-(enzo_float * Y, enzo_float * X, int g0) const throw()
+(enzo_float * Y, enzo_float * X, int g0,
+ int iz_start, int iz_stop) const throw()
 {
   const int idx = 1;
   const int idy = mx_;
@@ -84,7 +233,9 @@ void EnzoMatrixLaplace::matvec_
       }
 
     } else if (rank == 3) {
-      for     (int iz=g0; iz<mz_-g0; iz++) {
+      const int iz0 = std::max(g0,iz_start);
+      const int iz1 = std::min(mz_-g0,iz_stop);
+      for     (int iz=iz0; iz<iz1; iz++) {
 	for   (int iy=g0; iy<my_-g0; iy++) {
 	  for (int ix=g0; ix<mx_-g0; ix++) {
 	    const int i = ix + mx_*(iy + my_*iz);
@@ -146,7 +297,9 @@ void EnzoMatrixLaplace::matvec_
 
     } else if (rank == 3) {
 
-      for     (int iz=g0; iz<mz_-g0; iz++) {
+      const int iz0 = std::max(g0,iz_start);
+      const int iz1 = std::min(mz_-g0,iz_stop);
+      for     (int iz=iz0; iz<iz1; iz++) {
 	for   (int iy=g0; iy<my_-g0; iy++) {
 	  for (int ix=g0; ix<mx_-g0; ix++) {
 	    const int i = ix + mx_*(iy + my_*iz);
@@ -211,7 +364,9 @@ void EnzoMatrixLaplace::matvec_
 
     } else if (rank == 3) {
 
-      for     (int iz=g0; iz<mz_-g0; iz++) {
+      const int iz0 = std::max(g0,iz_start);
+      const int iz1 = std::min(mz_-g0,iz_stop);
+      for     (int iz=iz0; iz<iz1; iz++) {
 	for   (int iy=g0; iy<my_-g0; iy++) {
 	  for (int ix=g0; ix<mx_-g0; ix++) {
 	    const int i = ix + mx_*(iy + my_*iz);
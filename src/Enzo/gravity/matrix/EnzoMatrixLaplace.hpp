@@ -76,6 +76,15 @@ public: // interface
     hy_ = hy;
     hz_ = hz;
   }
+
+  /// Set array dimensions.  Required for lower-level methods that
+  /// don't have access to the Block
+  void set_dimensions (int mx, int my, int mz)
+  {
+    mx_ = mx;
+    my_ = my;
+    mz_ = mz;
+  }
   
 public: // virtual functions
 
@@ -88,6 +97,24 @@ public: // virtual functions
   virtual void matvec (precision_type precision,
 		       void * y, void * x, int g0=1) throw();
 
+  /// Apply the matrix Y <-- A*X fused with dot products of Y with
+  /// the fields iw[], computed over cache-sized z-slabs
+  virtual void matvec_dot (int id_y, int id_x, int n, const int * iw,
+			   long double * dot,
+			   Block * block, int g0=1) throw();
+
+  /// Compute residual R <-- B - A*X fused with the norm R*R, computed
+  /// over cache-sized z-slabs
+  virtual long double residual_norm (int id_r, int id_b, int id_x,
+				     Block * block, int g0=1) throw();
+
+  /// Low-level residual_norm, useful for non-Block arrays.  The norm
+  /// excludes gx,gy,gz ghost zones.  Must call set_cell_width and
+  /// set_dimensions first manually!
+  long double residual_norm (precision_type precision,
+			     void * r, void * b, void * x, int g0,
+			     int gx, int gy, int gz) throw();
+
   /// Extract the diagonal into the given field
   virtual void diagonal (int id_x, Block * block, int g0=1) throw();
 
@@ -101,7 +128,19 @@ public: // virtual functions
 
 protected: // functions
 
-  void matvec_ (enzo_float * Y, enzo_float * X, int g0) const throw();
+  /// Apply the matrix Y <-- A*X to z-planes iz_start <= iz < iz_stop
+  void matvec_ (enzo_float * Y, enzo_float * X, int g0,
+		int iz_start, int iz_stop) const throw();
+
+  /// Compute R <-- B - A*X and return R*R over zones outside the
+  /// gx,gy,gz ghost zones
+  long double residual_norm_ (enzo_float * R, const enzo_float * B,
+			      enzo_float * X, int g0,
+			      int gx, int gy, int gz) const throw();
+
+  /// Number of z-planes per slab for fused kernels accessing
+  /// num_fields fields
+  int slab_depth_ (int num_fields) const throw();
 
   void diagonal_ (enzo_float * X, int g0) const throw();
 
@@ -0,0 +1,83 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_EnzoMatrixLaplace.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    Test program for the fused EnzoMatrixLaplace::residual_norm()
+///
+/// Compares residual_norm() against matvec() followed by R <-- B - R
+/// and a separate norm, as computed by Matrix::residual_norm(), for
+/// several values of the ghost depth g0 passed to the matrix.  Since
+/// there is no Simulation, cello::rank() is 1, so arrays are
+/// one-dimensional.
+
+#include "test.hpp"
+#include "main.hpp"
+#include "enzo.hpp"
+
+#define CK_TEMPLATES_ONLY
+#include "enzo.def.h"
+#undef CK_TEMPLATES_ONLY
+
+// number of cells including ghost zones
+const int M = 32;
+// ghost depth of the field, which is excluded from the norm
+const int G = 3;
+
+//----------------------------------------------------------------------
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class ("EnzoMatrixLaplace");
+
+  EnzoMatrixLaplace matrix (2);
+  matrix.set_dimensions (M,1,1);
+  matrix.set_cell_width (0.125,0.0,0.0);
+
+  std::vector<enzo_float> X(M), B(M);
+  for (int i=0; i<M; i++) {
+    X[i] = 1.0 + 0.25*i + 0.0625*i*i;
+    B[i] = 2.0 - 0.125*i;
+  }
+
+  for (int g0=1; g0<=G; g0++) {
+
+    char name[80];
+    snprintf (name,sizeof(name),"residual_norm() g0 = %d",g0);
+    unit_func (name);
+
+    // R is set to a value that differs from both A*X and B - A*X, so
+    // that zones written with the wrong ghost depth are detected
+
+    std::vector<enzo_float> R_fused (M,-7.0);
+    std::vector<enzo_float> R_ref   (M,-7.0);
+
+    long double rr_fused = matrix.residual_norm
+      (default_precision, R_fused.data(), B.data(), X.data(), g0, G,0,0);
+
+    // reference: residual followed by a plain norm
+
+    matrix.matvec (default_precision, R_ref.data(), X.data(), g0);
+    for (int i=g0; i<M-g0; i++) R_ref[i] = B[i] - R_ref[i];
+    long double rr_ref = 0.0;
+    for (int i=G; i<M-G; i++) rr_ref += R_ref[i]*R_ref[i];
+
+    bool match = true;
+    for (int i=0; i<M; i++) match = match && (R_fused[i] == R_ref[i]);
+
+    unit_assert (match);
+    unit_assert (std::abs(rr_fused - rr_ref) <= 1e-12*rr_ref);
+    unit_assert (rr_ref > 0.0);
+  }
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
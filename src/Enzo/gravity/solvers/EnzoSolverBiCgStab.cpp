@@ -604,8 +604,9 @@ void EnzoSolverBiCgStab::start_2(EnzoBlock* block,
       }
     }
 
-    // recompute residual given shifted B and X
-    A_->residual (ir_, ib_, ix_, block);
+    // recompute residual given shifted B and X, fused with the
+    // local contribution to beta_n_ = DOT(R, R0) = DOT(R, R)
+    reduce[1] = A_->residual_norm (ir_, ib_, ix_, block);
 
     /// LINE 01:  R0 = B - A * X_0
     /// LINE 02:  P0 = R0
@@ -614,13 +615,11 @@ void EnzoSolverBiCgStab::start_2(EnzoBlock* block,
       P[i]  = R[i];
     }      
 
-    /// Compute local contributions to beta_n_ = DOT(R, R0)
-    /// and B*B for stopping criteria
+    /// Compute local contributions to B*B for stopping criteria
     for (int iz=gz_; iz<mz_-gz_; iz++) {
       for (int iy=gy_; iy<my_-gy_; iy++) {
 	for (int ix=gx_; ix<mx_-gx_; ix++) {
 	  int i = ix + mx_*(iy + my_*iz);
-	  reduce[1] += R[i]*R0[i];
 	  reduce[2] += B[i]*B[i];
 	  reduce[3] += R[i];
 	}
@@ -970,38 +969,24 @@ void EnzoSolverBiCgStab::loop_4(EnzoBlock* block) throw() {
   COPY_FIELD(block,"loop_4",iy_,"Y1_bcg");
   COPY_FIELD(block,"loop_4",iv_,"V1_bcg");
   
+  std::vector<long double> reduce;
+  reduce.resize(3+1);
+  reduce.clear();
+  reduce[0] = 3;
+  
   if (is_finest_(block)) {
 
     /// LINE 05: V = A * Y
+    /// LINE 07 [part]  vr0_ = V*R0, fused with the matrix product
     
-    A_->matvec(iv_, iy_, block);
+    A_->matvec_dot(iv_, iy_, 1, &ir0_, &reduce[1], block);
 
   }
 
   COPY_FIELD(block,"loop_4",iv_,"V1_bcg");
-  /// compute local contributions to vr0_ = DOT(V, R0)
-  
-  std::vector<long double> reduce;
-  reduce.resize(3+1);
-  reduce.clear();
-  reduce[0] = 3;
   
   if (is_finest_(block)) {
     
-    enzo_float* R0 = (enzo_float*) field.values(ir0_);
-    enzo_float* V  = (enzo_float*) field.values(iv_);
-
-    /// LINE 07 [part]  vr0_ = V*R0
-    
-    for (int iz=gz_; iz<mz_-gz_; iz++) {
-      for (int iy=gy_; iy<my_-gy_; iy++) {
-	for (int ix=gx_; ix<mx_-gx_; ix++) {
-	  int i = ix + mx_*(iy + my_*iz);
-	  reduce[1] += V[i]*R0[i];
-	}
-      }
-    }
-    
     /// for singular Poisson problems need all vectors in R(A), so
     /// project both Y and V into R(A)
 
@@ -1269,38 +1254,27 @@ void EnzoSolverBiCgStab::loop_10(EnzoBlock* block) throw() {
   COPY_FIELD(block,"loop_10",iq_,"Q2_bcg");
   COPY_FIELD(block,"loop_10",iy_,"Y2_bcg");
 
+  std::vector<long double> reduce;
+  reduce.resize(5+1);
+  reduce.clear();
+  reduce[0] = 5;
+  
   if (is_finest_(block)) {
 
     /// LINE 11:     U = A * Y
-    
-    A_->matvec(iu_, iy_, block);     /// apply matrix to local block
+    /// omega_n = DOT(U, Q)
+    /// omega_d = DOT(U, U)
+    ///
+    /// apply matrix to local block fused with the dot products
+
+    const int iw[2] = {iq_, iu_};
+    A_->matvec_dot(iu_, iy_, 2, iw, &reduce[1], block);
 
   }
 
   COPY_FIELD(block,"loop_10",iu_,"U");
 
-  std::vector<long double> reduce;
-  reduce.resize(5+1);
-  reduce.clear();
-  reduce[0] = 5;
-  
   if (is_finest_(block)) {
-    
-    enzo_float* U  = (enzo_float*) field.values(iu_);
-    enzo_float* Q  = (enzo_float*) field.values(iq_);
-    
-    /// omega_n = DOT(U, Q)
-    /// omega_d = DOT(U, U)
-  
-    for (int iz=gz_; iz<mz_-gz_; iz++) {
-      for (int iy=gy_; iy<my_-gy_; iy++) {
-	for (int ix=gx_; ix<mx_-gx_; ix++) {
-	  int i = ix + mx_*(iy + my_*iz);
-	  reduce[1] += U[i]*Q[i];
-	  reduce[2] += U[i]*U[i];
-	}
-      }
-    }
   
     /// for singular Poisson problems, project both Y and U into R(A)
 
@@ -1454,49 +1428,51 @@ void EnzoSolverBiCgStab::loop_12(EnzoBlock* block,
     this->end(block, return_error);
   }
 
-  /// update vectors on leaf blocks
-  
-  if (is_finest_(block)) {
-
-    enzo_float* X = (enzo_float*) field.values(ix_);
-    enzo_float* Y = (enzo_float*) field.values(iy_);
-    enzo_float* R = (enzo_float*) field.values(ir_);
-    enzo_float* Q = (enzo_float*) field.values(iq_);
-    enzo_float* U = (enzo_float*) field.values(iu_);
-    
-    /// LINE 13:     X = X + omega * Y
-    /// LINE 14:     R = Q - omega * U
-
-    for (int i=0; i<m_; i++) {
-      X[i] = X[i] + S(omega)*Y[i];
-      R[i] = Q[i] - S(omega)*U[i];
-    }
-  }
-
-  
   /// Update previous beta value (beta_d_) to current value (beta_n_)
   
   S(beta_d) = S(beta_n);
   
-  /// rr_     = DOT(R, R)
-  /// beta_n = DOT(R, R0)
-  
   std::vector<long double> reduce;
   reduce.resize(2+1);
   reduce.clear();
   reduce[0] = 2;
   
+  /// update vectors on leaf blocks
+
   if (is_finest_(block)) {
-    
+
+    enzo_float* X  = (enzo_float*) field.values(ix_);
+    enzo_float* Y  = (enzo_float*) field.values(iy_);
     enzo_float* R  = (enzo_float*) field.values(ir_);
+    enzo_float* Q  = (enzo_float*) field.values(iq_);
+    enzo_float* U  = (enzo_float*) field.values(iu_);
     enzo_float* R0 = (enzo_float*) field.values(ir0_);
+
+    const long double omega = S(omega);
     
-    for (int iz=gz_; iz<mz_-gz_; iz++) {
-      for (int iy=gy_; iy<my_-gy_; iy++) {
-	for (int ix=gx_; ix<mx_-gx_; ix++) {
-	  int i = ix + mx_*(iy + my_*iz);
-	  reduce[1] += R[i]*R[i];
-	  reduce[2] += R[i]*R0[i];
+    /// LINE 13:     X = X + omega * Y
+    /// LINE 14:     R = Q - omega * U
+    /// rr_     = DOT(R, R)
+    /// beta_n = DOT(R, R0)
+    ///
+    /// vector updates are fused with the reductions: each row is
+    /// updated and, if in the active region, summed while in cache
+
+    for (int iz=0; iz<mz_; iz++) {
+      const bool active_z = (gz_ <= iz && iz < mz_-gz_);
+      for (int iy=0; iy<my_; iy++) {
+	const int i0 = mx_*(iy + my_*iz);
+	for (int ix=0; ix<mx_; ix++) {
+	  const int i = i0 + ix;
+	  X[i] = X[i] + omega*Y[i];
+	  R[i] = Q[i] - omega*U[i];
+	}
+	if (active_z && gy_ <= iy && iy < my_-gy_) {
+	  for (int ix=gx_; ix<mx_-gx_; ix++) {
+	    const int i = i0 + ix;
+	    reduce[1] += R[i]*R[i];
+	    reduce[2] += R[i]*R0[i];
+	  }
 	}
       }
     }
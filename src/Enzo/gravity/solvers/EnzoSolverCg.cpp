@@ -497,18 +497,14 @@ void EnzoSolverCg::loop_2b (EnzoBlock * enzo_block) throw()
     Data * data = enzo_block->data();
     Field field = data->field();
 
-    if (is_finest_(enzo_block)) {
-
-      A_->matvec(iy_,id_,enzo_block);
-
-    }
-
     long double reduce[3] = {0.0, 0.0, 0.0};
 
     if (is_finest_(enzo_block)) {
 
-      enzo_float * D = (enzo_float*) field.values(id_);
-      enzo_float * Y = (enzo_float*) field.values(iy_);
+      // Y = A*D fused with dy = DOT(D,Y)
+
+      A_->matvec_dot(iy_,id_,1,&id_,&reduce[2],enzo_block);
+
       enzo_float * R = (enzo_float*) field.values(ir_);
       enzo_float * Z = (enzo_float*) field.values(iz_);
 
@@ -518,7 +514,6 @@ void EnzoSolverCg::loop_2b (EnzoBlock * enzo_block) throw()
 	    int i = ix + mx_*(iy + my_*iz);
 	    reduce[0] += R[i]*R[i];
 	    reduce[1] += R[i]*Z[i];
-	    reduce[2] += D[i]*Y[i];
 	  }
 	}
       }
@@ -576,6 +571,8 @@ void EnzoSolverCg::loop_4 (EnzoBlock * enzo_block) throw ()
   Data * data = enzo_block->data();
   Field field = data->field();
 
+  long double reduce[3] = {0.0, 0.0, 0.0};
+
   if (is_finest_(enzo_block)) {
 
     enzo_float * X = (enzo_float*) field.values(ix_);
@@ -587,40 +584,36 @@ void EnzoSolverCg::loop_4 (EnzoBlock * enzo_block) throw ()
 
     cello::check(a,"CG::a",__FILE__,__LINE__);
 
-    //    field.axpy (ix_,  a ,id_, ix_);
-    //    field.axpy (ir_, -a, iy_, ir_);
-    for (int i=0; i<mx_*my_*mz_; i++) {
-      X[i] += a * D[i];
-      R[i] -= a * Y[i];
-    }
-
-    enzo_float * Z = (enzo_float*) field.values(iz_);
-
-    // M_->matvec(iz_,ir_,enzo_block);
-    for (int i=0; i<mx_*my_*mz_; i++) {
-      Z[i] = R[i];
-    }
-
-  }
-
-  long double reduce[3] = {0.0, 0.0, 0.0};
-
-  if (is_finest_(enzo_block)) {
-
-    enzo_float * X = (enzo_float*) field.values(ix_);
-    enzo_float * R = (enzo_float*) field.values(ir_);
     enzo_float * Z = (enzo_float*) field.values(iz_);
 
+    //    field.axpy (ix_,  a ,id_, ix_);
+    //    field.axpy (ir_, -a, iy_, ir_);
+    //    M_->matvec(iz_,ir_,enzo_block);
     //    reduce[0] = field.dot(ir_,iz_);
     //    reduce[1] = sum_(R);
     //    reduce[2] = sum_(X);
-    for (int iz=gz_; iz<mz_-gz_; iz++) {
-      for (int iy=gy_; iy<my_-gy_; iy++) {
-	for (int ix=gx_; ix<mx_-gx_; ix++) {
-	  int i = ix + mx_*(iy + my_*iz);
-	  reduce[0] += R[i]*Z[i];
-	  reduce[1] += R[i];
-	  reduce[2] += X[i];
+
+    // Vector updates are fused with the reductions: each row is
+    // updated and, if it lies in the active region, summed while
+    // still in cache
+
+    for (int iz=0; iz<mz_; iz++) {
+      const bool active_z = (gz_ <= iz && iz < mz_-gz_);
+      for (int iy=0; iy<my_; iy++) {
+	const int i0 = mx_*(iy + my_*iz);
+	for (int ix=0; ix<mx_; ix++) {
+	  const int i = i0 + ix;
+	  X[i] += a * D[i];
+	  R[i] -= a * Y[i];
+	  Z[i] = R[i];
+	}
+	if (active_z && gy_ <= iy && iy < my_-gy_) {
+	  for (int ix=gx_; ix<mx_-gx_; ix++) {
+	    const int i = i0 + ix;
+	    reduce[0] += R[i]*Z[i];
+	    reduce[1] += R[i];
+	    reduce[2] += X[i];
+	  }
 	}
       }
     }
@@ -805,18 +798,18 @@ void EnzoSolverCg::local_cg_(EnzoBlock * enzo_block)
 
     refresh_local_(id_,enzo_block);
 
-    A_->matvec(iy_,id_,enzo_block);
+    long double dy;
+    A_->matvec_dot(iy_,id_,1,&id_,&dy,enzo_block);
+    dy_ = dy;
 
     rr_ = 0.0;
     rz_ = 0.0;
-    dy_ = 0.0;
     for (int iz=gz_; iz<mz_-gz_; iz++) {
       for (int iy=gy_; iy<my_-gy_; iy++) {
 	for (int ix=gx_; ix<mx_-gx_; ix++) {
 	  int i = ix + mx_*(iy + my_*iz);
 	  rr_ += R[i]*R[i];
 	  rz_ += R[i]*Z[i];
-	  dy_ += D[i]*Y[i];
 	}
       }
     }
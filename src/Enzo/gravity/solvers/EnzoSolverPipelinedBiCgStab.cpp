@@ -0,0 +1,770 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoSolverPipelinedBiCgStab.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    Implements the pipelined BiCgStab Krylov linear solver
+///
+/// Algorithm (Cools and Vanroose 2017, Algorithm 3):
+///
+///   R = B - A*X,  R0 = R,  W = A*R,  T = A*W
+///   alpha = DOT(R0,R) / DOT(R0,W),  beta = 0
+///   loop
+///     P = R + beta*(P - omega*S)
+///     S = W + beta*(S - omega*Z)
+///     Z = T + beta*(Z - omega*V)
+///     Q = R - alpha*S
+///     Y = W - alpha*Z
+///     [ DOT(Q,Y), DOT(Y,Y) ]                 reduction 1
+///     V = A*Z                                overlaps reduction 1
+///     omega = DOT(Q,Y) / DOT(Y,Y)
+///     X = X + alpha*P + omega*Q
+///     R = Q - omega*Y
+///     W = Y - omega*(T - alpha*V)
+///     [ DOT(R0,R), DOT(R0,W), DOT(R0,S),
+///       DOT(R0,Z), DOT(R,R) ]                reduction 2
+///     T = A*W                                overlaps reduction 2
+///     beta  = (alpha/omega) * DOT(R0,R) / DOT(R0,R)_old
+///     alpha = DOT(R0,R) / (DOT(R0,W) + beta*DOT(R0,S)
+///                          - beta*omega*DOT(R0,Z))
+///
+/// Each reduction is contributed before the refresh and matvec that
+/// follow it are started, and the block continues only after both
+/// the reduction result and the matvec are available.  Vector updates
+/// are restricted to active zones, since neighbors that are already
+/// ahead may have sent ghost zone values for the next refresh.
+
+#include "enzo.hpp"
+#include "charm_enzo.hpp"
+
+//----------------------------------------------------------------------
+
+#define S(index) scalar_(block,is_##index##_)
+
+//----------------------------------------------------------------------
+
+EnzoSolverPipelinedBiCgStab::EnzoSolverPipelinedBiCgStab
+(std::string name,
+ std::string field_x,
+ std::string field_b,
+ int monitor_iter,
+ int restart_cycle,
+ int solve_type,
+ int index_prolong,
+ int index_restrict,
+ int min_level,
+ int max_level,
+ int iter_max,
+ double res_tol)
+  : Solver(name,
+	   field_x,
+	   field_b,
+	   monitor_iter,
+	   restart_cycle,
+	   solve_type,
+	   index_prolong,
+	   index_restrict,
+	   min_level,
+	   max_level),
+    A_(NULL),
+    iter_max_(iter_max),
+    res_tol_(res_tol),
+    ir_(-1), ir0_(-1), iw_(-1), it_(-1), ip_(-1),
+    is_(-1), iz_(-1), iq_(-1), iy_(-1), iv_(-1),
+    mx_(0),my_(0),mz_(0),
+    gx_(0),gy_(0),gz_(0),
+    ir_loop_0_(-1), ir_loop_1_(-1), ir_start_2_(-1), ir_start_3_(-1),
+    is_alpha_(-1), is_beta_(-1), is_omega_(-1),
+    is_r0r_(-1), is_r0w_(-1), is_r0s_(-1), is_r0z_(-1),
+    is_qy_(-1), is_yy_(-1),
+    is_rr_(-1), is_rr0_(-1), is_rr_min_(-1), is_rr_max_(-1),
+    is_bs_(-1), is_bc_(-1), is_xs_(-1),
+    is_iter_(-1),
+    is_sync_(-1),
+    time_begin_(0.0)
+{
+  ASSERT1 ("EnzoSolverPipelinedBiCgStab::EnzoSolverPipelinedBiCgStab()",
+	   "Solver %s: solve_type must be \"leaf\" or \"level\"",
+	   name.c_str(),
+	   (solve_type == solve_leaf || solve_type == solve_level));
+
+  ScalarDescr * scalar_descr_quad = cello::scalar_descr_long_double();
+
+  is_alpha_   = scalar_descr_quad->new_value(name + ":pbicgstab_alpha");
+  is_beta_    = scalar_descr_quad->new_value(name + ":pbicgstab_beta");
+  is_omega_   = scalar_descr_quad->new_value(name + ":pbicgstab_omega");
+  is_r0r_     = scalar_descr_quad->new_value(name + ":pbicgstab_r0r");
+  is_r0w_     = scalar_descr_quad->new_value(name + ":pbicgstab_r0w");
+  is_r0s_     = scalar_descr_quad->new_value(name + ":pbicgstab_r0s");
+  is_r0z_     = scalar_descr_quad->new_value(name + ":pbicgstab_r0z");
+  is_qy_      = scalar_descr_quad->new_value(name + ":pbicgstab_qy");
+  is_yy_      = scalar_descr_quad->new_value(name + ":pbicgstab_yy");
+  is_rr_      = scalar_descr_quad->new_value(name + ":pbicgstab_rr");
+  is_rr0_     = scalar_descr_quad->new_value(name + ":pbicgstab_rr0");
+  is_rr_min_  = scalar_descr_quad->new_value(name + ":pbicgstab_rr_min");
+  is_rr_max_  = scalar_descr_quad->new_value(name + ":pbicgstab_rr_max");
+  is_bs_      = scalar_descr_quad->new_value(name + ":pbicgstab_bs");
+  is_bc_      = scalar_descr_quad->new_value(name + ":pbicgstab_bc");
+  is_xs_      = scalar_descr_quad->new_value(name + ":pbicgstab_xs");
+
+  is_iter_ = cello::scalar_descr_int()->new_value(name + ":pbicgstab_iter");
+  is_sync_ = cello::scalar_descr_sync()->new_value(name + ":pbicgstab_sync");
+
+  FieldDescr * field_descr = cello::field_descr();
+
+  ir_  = field_descr->insert_temporary();
+  ir0_ = field_descr->insert_temporary();
+  iw_  = field_descr->insert_temporary();
+  it_  = field_descr->insert_temporary();
+  ip_  = field_descr->insert_temporary();
+  is_  = field_descr->insert_temporary();
+  iz_  = field_descr->insert_temporary();
+  iq_  = field_descr->insert_temporary();
+  iy_  = field_descr->insert_temporary();
+  iv_  = field_descr->insert_temporary();
+
+  // Initialize Refresh phases
+
+  Refresh * refresh_post = cello::refresh(ir_post_);
+  cello::simulation()->refresh_set_name(ir_post_,name);
+  refresh_post->add_field (ix_);
+
+  ir_start_2_ = add_refresh_();
+  cello::simulation()->refresh_set_name(ir_start_2_,name+":start_2");
+  cello::refresh(ir_start_2_)->add_field (ir_);
+  cello::refresh(ir_start_2_)->set_callback
+    (CkIndex_EnzoBlock::p_solver_pbicgstab_start_2());
+
+  ir_start_3_ = add_refresh_();
+  cello::simulation()->refresh_set_name(ir_start_3_,name+":start_3");
+  cello::refresh(ir_start_3_)->add_field (iw_);
+  cello::refresh(ir_start_3_)->set_callback
+    (CkIndex_EnzoBlock::p_solver_pbicgstab_start_3());
+
+  ir_loop_0_ = add_refresh_();
+  cello::simulation()->refresh_set_name(ir_loop_0_,name+":loop_0");
+  cello::refresh(ir_loop_0_)->add_field (iw_);
+  cello::refresh(ir_loop_0_)->set_callback
+    (CkIndex_EnzoBlock::p_solver_pbicgstab_loop_0());
+
+  ir_loop_1_ = add_refresh_();
+  cello::simulation()->refresh_set_name(ir_loop_1_,name+":loop_1");
+  cello::refresh(ir_loop_1_)->add_field (iz_);
+  cello::refresh(ir_loop_1_)->set_callback
+    (CkIndex_EnzoBlock::p_solver_pbicgstab_loop_1());
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverPipelinedBiCgStab::pup(PUP::er& p)
+{
+  // NOTE: change this function whenever attributes change
+
+  TRACEPUP;
+
+  Solver::pup(p);
+
+  //  p | A_;
+  p | iter_max_;
+  p | res_tol_;
+
+  p | ir_;
+  p | ir0_;
+  p | iw_;
+  p | it_;
+  p | ip_;
+  p | is_;
+  p | iz_;
+  p | iq_;
+  p | iy_;
+  p | iv_;
+
+  p | mx_;
+  p | my_;
+  p | mz_;
+  p | gx_;
+  p | gy_;
+  p | gz_;
+
+  p | ir_loop_0_;
+  p | ir_loop_1_;
+  p | ir_start_2_;
+  p | ir_start_3_;
+
+  p | is_alpha_;
+  p | is_beta_;
+  p | is_omega_;
+  p | is_r0r_;
+  p | is_r0w_;
+  p | is_r0s_;
+  p | is_r0z_;
+  p | is_qy_;
+  p | is_yy_;
+  p | is_rr_;
+  p | is_rr0_;
+  p | is_rr_min_;
+  p | is_rr_max_;
+  p | is_bs_;
+  p | is_bc_;
+  p | is_xs_;
+  p | is_iter_;
+  p | is_sync_;
+
+  p | time_begin_;
+}
+
+//======================================================================
+
+void EnzoSolverPipelinedBiCgStab::apply
+( std::shared_ptr<Matrix> A, Block * block) throw()
+{
+  Solver::begin_(block);
+
+  A_ = A;
+
+  allocate_temporary_(block);
+
+  Field field = block->data()->field();
+
+  field.dimensions (ib_, &mx_, &my_, &mz_);
+  field.ghost_depth(ib_, &gx_, &gy_, &gz_);
+
+  // each reduction is joined with one matvec
+  s_sync_(block).reset();
+  s_sync_(block).set_stop(2);
+
+  if (block->index().is_root()) {
+    time_begin_ = cello::simulation()->timer();
+  }
+
+  compute_(enzo::block(block));
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverPipelinedBiCgStab::compute_(EnzoBlock * block) throw()
+{
+  s_iter_(block) = 0;
+
+  Field field = block->data()->field();
+
+  const int m = mx_*my_*mz_;
+
+  long double reduce[2] = {0.0, 0.0};
+
+  if (is_finest_(block)) {
+
+    enzo_float * X  = (enzo_float*) field.values(ix_);
+    enzo_float * B  = (enzo_float*) field.values(ib_);
+    enzo_float * R  = (enzo_float*) field.values(ir_);
+    enzo_float * R0 = (enzo_float*) field.values(ir0_);
+    enzo_float * W  = (enzo_float*) field.values(iw_);
+    enzo_float * T  = (enzo_float*) field.values(it_);
+    enzo_float * P  = (enzo_float*) field.values(ip_);
+    enzo_float * S  = (enzo_float*) field.values(is_);
+    enzo_float * Z  = (enzo_float*) field.values(iz_);
+    enzo_float * Q  = (enzo_float*) field.values(iq_);
+    enzo_float * Y  = (enzo_float*) field.values(iy_);
+    enzo_float * V  = (enzo_float*) field.values(iv_);
+
+    /// X = 0, R = B (R = B - A*X)
+
+    for (int i=0; i<m; i++) {
+      X[i] = 0.0;
+      R[i] = B[i];
+      R0[i] = W[i] = T[i] = P[i] = S[i] = 0.0;
+      Z[i] = Q[i] = Y[i] = V[i] = 0.0;
+    }
+
+    /// SUM(B), COUNT(B) for projecting B into R(A) if singular
+
+    for (int iz=gz_; iz<mz_-gz_; iz++) {
+      for (int iy=gy_; iy<my_-gy_; iy++) {
+	for (int ix=gx_; ix<mx_-gx_; ix++) {
+	  int i = ix + mx_*(iy + my_*iz);
+	  reduce[0] += B[i];
+	  reduce[1] += 1.0;
+	}
+      }
+    }
+  }
+
+  CkCallback callback
+    (CkIndex_EnzoBlock::r_solver_pbicgstab_start_1(NULL),
+     block->proxy_array());
+
+  block->contribute (2*sizeof(long double), &reduce,
+		     sum_long_double_2_type, callback);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::r_solver_pbicgstab_start_1(CkReductionMsg* msg)
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  static_cast<EnzoSolverPipelinedBiCgStab*> (solver())->start_1(this,msg);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverPipelinedBiCgStab::start_1
+(EnzoBlock * block, CkReductionMsg * msg) throw()
+{
+  long double * data = (long double *) msg->getData();
+
+  S(bs) = data[0];
+  S(bc) = data[1];
+
+  delete msg;
+
+  if (is_finest_(block)) {
+
+    Field field = block->data()->field();
+
+    enzo_float * B  = (enzo_float*) field.values(ib_);
+    enzo_float * R  = (enzo_float*) field.values(ir_);
+    enzo_float * R0 = (enzo_float*) field.values(ir0_);
+
+    /// for singular problems, project B into R(A)
+
+    const enzo_float shift =
+      (A_->is_singular() && S(bc) > 0.0) ? enzo_float(S(bs) / S(bc)) : 0.0;
+
+    for (int iz=gz_; iz<mz_-gz_; iz++) {
+      for (int iy=gy_; iy<my_-gy_; iy++) {
+	for (int ix=gx_; ix<mx_-gx_; ix++) {
+	  int i = ix + mx_*(iy + my_*iz);
+	  B[i] -= shift;
+	  R[i] -= shift;
+	  R0[i] = R[i];
+	}
+      }
+    }
+  }
+
+  refresh_start_(block, ir_start_2_,
+		 CkIndex_EnzoBlock::p_solver_pbicgstab_start_2());
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_solver_pbicgstab_start_2()
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  static_cast<EnzoSolverPipelinedBiCgStab*> (solver())->start_2(this);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverPipelinedBiCgStab::start_2(EnzoBlock * block) throw()
+{
+  /// W = A*R
+
+  if (is_finest_(block)) A_->matvec(iw_, ir_, block);
+
+  refresh_start_(block, ir_start_3_,
+		 CkIndex_EnzoBlock::p_solver_pbicgstab_start_3());
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_solver_pbicgstab_start_3()
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  static_cast<EnzoSolverPipelinedBiCgStab*> (solver())->start_3(this);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverPipelinedBiCgStab::start_3(EnzoBlock * block) throw()
+{
+  long double reduce[6+1] = {6, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+
+  if (is_finest_(block)) {
+
+    /// T = A*W fused with DOT(R0,W)
+
+    A_->matvec_dot(it_, iw_, 1, &ir0_, &reduce[2], block);
+
+    Field field = block->data()->field();
+
+    enzo_float * R  = (enzo_float*) field.values(ir_);
+    enzo_float * R0 = (enzo_float*) field.values(ir0_);
+
+    /// DOT(R0,R), DOT(R,R); DOT(R0,S) = DOT(R0,Z) = SUM(X) = 0
+
+    for (int iz=gz_; iz<mz_-gz_; iz++) {
+      for (int iy=gy_; iy<my_-gy_; iy++) {
+	for (int ix=gx_; ix<mx_-gx_; ix++) {
+	  int i = ix + mx_*(iy + my_*iz);
+	  reduce[1] += R0[i]*R[i];
+	  reduce[5] += R[i]*R[i];
+	}
+      }
+    }
+  }
+
+  contribute_loop_0_(block,reduce);
+
+  // T is already computed
+  if (s_sync_(block).next()) loop_0(block);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverPipelinedBiCgStab::contribute_loop_0_
+(EnzoBlock * block, long double * reduce) throw()
+{
+  CkCallback callback
+    (CkIndex_EnzoBlock::r_solver_pbicgstab_loop_0(NULL),
+     block->proxy_array());
+
+  block->contribute ((6+1)*sizeof(long double), reduce,
+		     sum_long_double_n_type, callback);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::r_solver_pbicgstab_loop_0(CkReductionMsg* msg)
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  static_cast<EnzoSolverPipelinedBiCgStab*> (solver())->set_loop_0(this,msg);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverPipelinedBiCgStab::set_loop_0
+(EnzoBlock * block, CkReductionMsg * msg) throw()
+{
+  long double * data = (long double *) msg->getData();
+
+  ASSERT1("EnzoSolverPipelinedBiCgStab::set_loop_0()",
+	  "Expecting (data[0] = %Lg) == 6",
+	  data[0],(data[0] == 6));
+
+  const long double r0r = data[1];
+  const long double r0w = data[2];
+  const long double r0s = data[3];
+  const long double r0z = data[4];
+
+  S(rr) = data[5];
+  S(xs) = data[6];
+
+  delete msg;
+
+  /// update alpha and beta
+
+  if (s_iter_(block) == 0) {
+    S(beta)  = 0.0;
+    S(alpha) = (r0w != 0.0) ? r0r / r0w : 0.0;
+  } else {
+    S(beta) = (S(alpha) / S(omega)) * (r0r / S(r0r));
+    const long double d = r0w + S(beta)*r0s - S(beta)*S(omega)*r0z;
+    S(alpha) = (d != 0.0) ? r0r / d : 0.0;
+  }
+  S(r0r) = r0r;
+  S(r0w) = r0w;
+  S(r0s) = r0s;
+  S(r0z) = r0z;
+
+  if (s_sync_(block).next()) loop_0(block);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_solver_pbicgstab_loop_0()
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  static_cast<EnzoSolverPipelinedBiCgStab*> (solver())->matvec_loop_0(this);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverPipelinedBiCgStab::matvec_loop_0(EnzoBlock * block) throw()
+{
+  /// T = A*W
+
+  if (is_finest_(block)) A_->matvec(it_, iw_, block);
+
+  if (s_sync_(block).next()) loop_0(block);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverPipelinedBiCgStab::loop_0(EnzoBlock * block) throw()
+{
+  const int iter = s_iter_(block);
+
+  if (iter == 0) {
+    S(rr0)    = S(rr);
+    S(rr_min) = S(rr);
+    S(rr_max) = S(rr);
+  } else {
+    S(rr_min) = std::min(S(rr_min),S(rr));
+    S(rr_max) = std::max(S(rr_max),S(rr));
+  }
+
+  const bool is_converged = (S(rr0) == 0.0) || (S(rr) / S(rr0) < res_tol_);
+  const bool is_diverged  = (iter >= iter_max_);
+
+  monitor_output_(block, is_converged || is_diverged);
+
+  if (is_converged) {
+    end(block,return_converged);
+    return;
+  } else if (is_diverged) {
+    end(block,return_error);
+    return;
+  } else if (S(alpha) == 0.0) {
+    WARNING1 ("EnzoSolverPipelinedBiCgStab::loop_0()",
+	      "Solver error: %s alpha == 0",
+	      block->name().c_str());
+    end(block,return_error);
+    return;
+  }
+
+  long double reduce[2+1] = {2, 0.0, 0.0};
+
+  if (is_finest_(block)) {
+
+    Field field = block->data()->field();
+
+    enzo_float * X = (enzo_float*) field.values(ix_);
+    enzo_float * R = (enzo_float*) field.values(ir_);
+    enzo_float * W = (enzo_float*) field.values(iw_);
+    enzo_float * T = (enzo_float*) field.values(it_);
+    enzo_float * P = (enzo_float*) field.values(ip_);
+    enzo_float * S = (enzo_float*) field.values(is_);
+    enzo_float * Z = (enzo_float*) field.values(iz_);
+    enzo_float * Q = (enzo_float*) field.values(iq_);
+    enzo_float * Y = (enzo_float*) field.values(iy_);
+    enzo_float * V = (enzo_float*) field.values(iv_);
+
+    const enzo_float alpha = S(alpha);
+    const enzo_float beta  = S(beta);
+    const enzo_float omega = S(omega);
+
+    /// for singular problems, keep X in R(A)
+
+    const enzo_float x_shift =
+      (A_->is_singular() && S(bc) > 0.0) ? enzo_float(S(xs) / S(bc)) : 0.0;
+
+    /// P = R + beta*(P - omega*S)
+    /// S = W + beta*(S - omega*Z)
+    /// Z = T + beta*(Z - omega*V)
+    /// Q = R - alpha*S
+    /// Y = W - alpha*Z
+    /// DOT(Q,Y), DOT(Y,Y)
+
+    for (int iz=gz_; iz<mz_-gz_; iz++) {
+      for (int iy=gy_; iy<my_-gy_; iy++) {
+	for (int ix=gx_; ix<mx_-gx_; ix++) {
+	  int i = ix + mx_*(iy + my_*iz);
+	  X[i] -= x_shift;
+	  P[i] = R[i] + beta*(P[i] - omega*S[i]);
+	  S[i] = W[i] + beta*(S[i] - omega*Z[i]);
+	  Z[i] = T[i] + beta*(Z[i] - omega*V[i]);
+	  Q[i] = R[i] - alpha*S[i];
+	  Y[i] = W[i] - alpha*Z[i];
+	  reduce[1] += Q[i]*Y[i];
+	  reduce[2] += Y[i]*Y[i];
+	}
+      }
+    }
+  }
+
+  CkCallback callback
+    (CkIndex_EnzoBlock::r_solver_pbicgstab_loop_1(NULL),
+     block->proxy_array());
+
+  block->contribute ((2+1)*sizeof(long double), reduce,
+		     sum_long_double_n_type, callback);
+
+  /// overlap reduction with V = A*Z
+
+  refresh_start_(block, ir_loop_1_,
+		 CkIndex_EnzoBlock::p_solver_pbicgstab_loop_1());
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::r_solver_pbicgstab_loop_1(CkReductionMsg* msg)
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  static_cast<EnzoSolverPipelinedBiCgStab*> (solver())->set_loop_1(this,msg);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverPipelinedBiCgStab::set_loop_1
+(EnzoBlock * block, CkReductionMsg * msg) throw()
+{
+  long double * data = (long double *) msg->getData();
+
+  ASSERT1("EnzoSolverPipelinedBiCgStab::set_loop_1()",
+	  "Expecting (data[0] = %Lg) == 2",
+	  data[0],(data[0] == 2));
+
+  S(qy) = data[1];
+  S(yy) = data[2];
+
+  delete msg;
+
+  if (s_sync_(block).next()) loop_1(block);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_solver_pbicgstab_loop_1()
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  static_cast<EnzoSolverPipelinedBiCgStab*> (solver())->matvec_loop_1(this);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverPipelinedBiCgStab::matvec_loop_1(EnzoBlock * block) throw()
+{
+  /// V = A*Z
+
+  if (is_finest_(block)) A_->matvec(iv_, iz_, block);
+
+  if (s_sync_(block).next()) loop_1(block);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverPipelinedBiCgStab::loop_1(EnzoBlock * block) throw()
+{
+  if (S(yy) == 0.0 || S(qy) == 0.0) {
+    WARNING1 ("EnzoSolverPipelinedBiCgStab::loop_1()",
+	      "Solver error: %s omega == 0",
+	      block->name().c_str());
+    end(block,return_error);
+    return;
+  }
+
+  /// omega = DOT(Q,Y) / DOT(Y,Y)
+
+  S(omega) = S(qy) / S(yy);
+
+  long double reduce[6+1] = {6, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+
+  if (is_finest_(block)) {
+
+    Field field = block->data()->field();
+
+    enzo_float * X  = (enzo_float*) field.values(ix_);
+    enzo_float * R  = (enzo_float*) field.values(ir_);
+    enzo_float * R0 = (enzo_float*) field.values(ir0_);
+    enzo_float * W  = (enzo_float*) field.values(iw_);
+    enzo_float * T  = (enzo_float*) field.values(it_);
+    enzo_float * P  = (enzo_float*) field.values(ip_);
+    enzo_float * S  = (enzo_float*) field.values(is_);
+    enzo_float * Z  = (enzo_float*) field.values(iz_);
+    enzo_float * Q  = (enzo_float*) field.values(iq_);
+    enzo_float * Y  = (enzo_float*) field.values(iy_);
+    enzo_float * V  = (enzo_float*) field.values(iv_);
+
+    const enzo_float alpha = S(alpha);
+    const enzo_float omega = S(omega);
+
+    /// X = X + alpha*P + omega*Q
+    /// R = Q - omega*Y
+    /// W = Y - omega*(T - alpha*V)
+    /// DOT(R0,R), DOT(R0,W), DOT(R0,S), DOT(R0,Z), DOT(R,R), SUM(X)
+
+    for (int iz=gz_; iz<mz_-gz_; iz++) {
+      for (int iy=gy_; iy<my_-gy_; iy++) {
+	for (int ix=gx_; ix<mx_-gx_; ix++) {
+	  int i = ix + mx_*(iy + my_*iz);
+	  X[i] += alpha*P[i] + omega*Q[i];
+	  R[i] = Q[i] - omega*Y[i];
+	  W[i] = Y[i] - omega*(T[i] - alpha*V[i]);
+	  reduce[1] += R0[i]*R[i];
+	  reduce[2] += R0[i]*W[i];
+	  reduce[3] += R0[i]*S[i];
+	  reduce[4] += R0[i]*Z[i];
+	  reduce[5] += R[i]*R[i];
+	  reduce[6] += X[i];
+	}
+      }
+    }
+  }
+
+  ++ s_iter_(block);
+
+  contribute_loop_0_(block,reduce);
+
+  /// overlap reduction with T = A*W
+
+  refresh_start_(block, ir_loop_0_,
+		 CkIndex_EnzoBlock::p_solver_pbicgstab_loop_0());
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverPipelinedBiCgStab::refresh_start_
+(EnzoBlock * block, int id_refresh, int entry) throw()
+{
+  Refresh * refresh = cello::refresh(id_refresh);
+
+  refresh->set_active(is_finest_(block));
+
+  block->refresh_start(id_refresh, entry);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverPipelinedBiCgStab::end (EnzoBlock * block, int retval) throw()
+{
+  deallocate_temporary_(block);
+
+  Solver::end_(block);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverPipelinedBiCgStab::monitor_output_
+(EnzoBlock * block, bool final) throw()
+{
+  if (! block->index().is_root()) return;
+
+  const int iter = s_iter_(block);
+
+  const bool l_first_iter = (iter == 0);
+  const bool l_monitor    = (monitor_iter_ && (iter % monitor_iter_) == 0 );
+
+  if (l_first_iter || l_monitor || final) {
+    Solver::monitor_output_
+      (block,iter,S(rr0),S(rr_min),S(rr),S(rr_max),final);
+  }
+
+  if (final) {
+    const double time = cello::simulation()->timer() - time_begin_;
+    cello::monitor()->print
+      ("Solver", "%s iterations %d time %g s time/iter %g s",
+       name().c_str(), iter, time, (iter > 0) ? time/iter : 0.0);
+  }
+}
@@ -38,7 +38,8 @@ EnzoMethodMHDVlct::EnzoMethodMHDVlct (std::string rsolver,
 				      std::string full_recon_name,
 				      double theta_limiter,
 				      std::string mhd_choice,
-				      bool store_fluxes_for_corrections)
+				      bool store_fluxes_for_corrections,
+				      int tile_depth)
   : Method()
 {
   // check compatability with EnzoPhysicsFluidProps
@@ -122,6 +123,19 @@ EnzoMethodMHDVlct::EnzoMethodMHDVlct (std::string rsolver,
            mhd_choice_ == bfield_choice::no_bfield);
   }
 
+  tile_depth_ = std::max(tile_depth, 0);
+  if (tile_depth_ > 0){
+    ASSERT("EnzoMethodMHDVlct::EnzoMethodMHDVlct",
+           "Tiled execution is currently only supported in hydro-mode",
+           mhd_choice_ == bfield_choice::no_bfield);
+    ASSERT("EnzoMethodMHDVlct::EnzoMethodMHDVlct",
+           "Tiled execution doesn't currently support flux corrections",
+           !store_fluxes_for_corrections);
+    // each tile must be at least as deep as the halo, so that the halo of a
+    // tile never extends past its neighboring tile
+    tile_depth_ = std::max(tile_depth_, min_gdepth_req);
+  }
+
   scratch_space_ = nullptr;
 
   // Finally, initialize the default Refresh object
@@ -196,6 +210,7 @@ void EnzoMethodMHDVlct::pup (PUP::er &p)
   p|primitive_field_list_;
   p|lazy_passive_list_;
   p|store_fluxes_for_corrections_;
+  p|tile_depth_;
 }
 
 //----------------------------------------------------------------------
@@ -236,13 +251,14 @@ static EnzoEFltArrayMap get_accel_map_(Block* block) noexcept
 //----------------------------------------------------------------------
 
 EnzoVlctScratchSpace* EnzoMethodMHDVlct::get_scratch_ptr_
-(const std::array<int,3>& field_shape, const str_vec_t& passive_list) noexcept
+(const std::array<int,3>& field_shape, const str_vec_t& passive_list,
+ bool tiled) noexcept
 {
   if (scratch_space_ == nullptr){
     scratch_space_ = new EnzoVlctScratchSpace
       (field_shape, integration_field_list_, primitive_field_list_,
        integration_quan_updater_->integration_keys(), passive_list,
-       enzo::fluid_props()->dual_energy_config().any_enabled());
+       enzo::fluid_props()->dual_energy_config().any_enabled(), tiled);
   }
   return scratch_space_;
 }
@@ -374,40 +390,6 @@ void EnzoMethodMHDVlct::compute ( Block * block) throw()
     EnzoEFltArrayMap external_integration_map = get_integration_map_
       (block, &passive_list);
 
-    // get maps of arrays and stand-alone arrays that serve as scratch space.
-    // (first, retrieve the pointer to the scratch space struct)
-    const std::array<int,3> shape = {external_integration_map.array_shape(0),
-                                     external_integration_map.array_shape(1),
-                                     external_integration_map.array_shape(2)};
-    EnzoVlctScratchSpace* const scratch = get_scratch_ptr_(shape, passive_list);
-
-    // map used for storing integration values at the half time-step. This
-    // includes key,array pairs for each entry in external_integration_map
-    // (there should be no aliased arrays shared between maps)
-    EnzoEFltArrayMap temp_integration_map = scratch->temp_integration_map;
-
-    // Map of arrays used to temporarily store the cell-centered primitive
-    // quantities that are subsequently reconstructed. This includes arrays for
-    // storing the specific form of each of the passively advected scalars.
-    EnzoEFltArrayMap primitive_map = scratch->primitive_map;
-
-    // holds left and right reconstructed primitives (scratch-space)
-    EnzoEFltArrayMap priml_map = scratch->priml_map;
-    EnzoEFltArrayMap primr_map = scratch->primr_map;
-
-    // maps used to store fluxes (in the future, these will wrap FluxData
-    // entries)
-    EnzoEFltArrayMap xflux_map = scratch->xflux_map;
-    EnzoEFltArrayMap yflux_map = scratch->yflux_map;
-    EnzoEFltArrayMap zflux_map = scratch->zflux_map;
-
-    // map of arrays  used to accumulate the changes to the conserved forms of
-    // the integration quantities and passively advected scalars. In other
-    // words, at the start of the (partial) timestep, the fields are all set to
-    // zero and are used to accumulate the flux divergence and source terms. If
-    // CT is used, it won't have space to store changes in the magnetic fields.
-    EnzoEFltArrayMap dUcons_map = scratch->dUcons_map;
-
     // initialize the map that wraps the fields holding the acceleration
     // components (these are nominally computed from gravity). This data is
     // used for the gravity source term calculation. An empty map indicates
@@ -419,134 +401,323 @@ void EnzoMethodMHDVlct::compute ( Block * block) throw()
       bfield_method_->register_target_block(block);
     }
 
-    EnzoPhysicsFluidProps* fluid_props = enzo::fluid_props();
+    // tiles are slabs along z, so only tile 3D blocks with more active
+    // layers than a single tile
+    int gx,gy,gz;
+    Field field = block->data()->field();
+    field.ghost_depth(field.field_id("density"), &gx, &gy, &gz);
+    const int nz_active = external_integration_map.array_shape(0) - 2*gz;
+
+    if ((tile_depth_ > 0) && (cello::rank() == 3) &&
+        (nz_active > tile_depth_)) {
+
+      compute_tiled_(block, external_integration_map, accel_map,
+                     passive_list);
+
+    } else {
+
+      // retrieve the pointer to the scratch space struct
+      const std::array<int,3> shape =
+        {external_integration_map.array_shape(0),
+         external_integration_map.array_shape(1),
+         external_integration_map.array_shape(2)};
+      EnzoVlctScratchSpace* const scratch =
+        get_scratch_ptr_(shape, passive_list);
+
+      // the updated values are written directly into the fields
+      integrate_(block, external_integration_map, external_integration_map,
+                 accel_map, scratch, store_fluxes_for_corrections_,
+                 passive_list);
+    }
+  }
+
+  block->compute_done();
+}
 
-    const enzo_float* const cell_widths = enzo::block(block)->CellWidth;
+//----------------------------------------------------------------------
 
-    double dt = block->dt();
+void EnzoMethodMHDVlct::integrate_
+(Block * block, EnzoEFltArrayMap &external_integration_map,
+ EnzoEFltArrayMap &final_integration_map, const EnzoEFltArrayMap &accel_map,
+ EnzoVlctScratchSpace * scratch, bool save_fluxes,
+ const str_vec_t& passive_list) noexcept
+{
+  // the scratch arrays may be deeper along z than the integration arrays
+  // (e.g. for the last tile in tiled mode), so slice them to match
+  const int mz = external_integration_map.array_shape(0);
+  const CSlice full_slc(0, nullptr);
+  const CSlice cc_z_slc(0, mz);
+  const CSlice fc_z_slc(0, mz-1);
+
+  // map used for storing integration values at the half time-step. This
+  // includes key,array pairs for each entry in external_integration_map
+  // (there should be no aliased arrays shared between maps)
+  EnzoEFltArrayMap temp_integration_map =
+    scratch->temp_integration_map.subarray_map(cc_z_slc, full_slc, full_slc);
+
+  // Map of arrays used to temporarily store the cell-centered primitive
+  // quantities that are subsequently reconstructed. This includes arrays for
+  // storing the specific form of each of the passively advected scalars.
+  EnzoEFltArrayMap primitive_map =
+    scratch->primitive_map.subarray_map(cc_z_slc, full_slc, full_slc);
+
+  // holds left and right reconstructed primitives (scratch-space)
+  EnzoEFltArrayMap priml_map =
+    scratch->priml_map.subarray_map(cc_z_slc, full_slc, full_slc);
+  EnzoEFltArrayMap primr_map =
+    scratch->primr_map.subarray_map(cc_z_slc, full_slc, full_slc);
+
+  // maps used to store fluxes (in the future, these will wrap FluxData
+  // entries)
+  EnzoEFltArrayMap xflux_map =
+    scratch->xflux_map.subarray_map(cc_z_slc, full_slc, full_slc);
+  EnzoEFltArrayMap yflux_map =
+    scratch->yflux_map.subarray_map(cc_z_slc, full_slc, full_slc);
+  EnzoEFltArrayMap zflux_map =
+    scratch->zflux_map.subarray_map(fc_z_slc, full_slc, full_slc);
+
+  // map of arrays  used to accumulate the changes to the conserved forms of
+  // the integration quantities and passively advected scalars. In other
+  // words, at the start of the (partial) timestep, the fields are all set to
+  // zero and are used to accumulate the flux divergence and source terms. If
+  // CT is used, it won't have space to store changes in the magnetic fields.
+  EnzoEFltArrayMap dUcons_map =
+    scratch->dUcons_map.subarray_map(cc_z_slc, full_slc, full_slc);
+
+  EnzoPhysicsFluidProps* fluid_props = enzo::fluid_props();
 
-    // stale_depth indicates the number of field entries from the outermost
-    // field value that the region including "stale" values (need to be
-    // refreshed) extends over.
-    int stale_depth = 0;
+  const enzo_float* const cell_widths = enzo::block(block)->CellWidth;
 
-    // repeat the following loop twice (for half time-step and full time-step)
-    for (int i=0;i<2;i++){
-      double cur_dt = (i == 0) ? dt/2. : dt;
-      EnzoEFltArrayMap& cur_integration_map =
-        (i == 0) ? external_integration_map : temp_integration_map;
-      EnzoEFltArrayMap& out_integration_map =
-        (i == 0) ? temp_integration_map     : external_integration_map;
+  double dt = block->dt();
 
-      EnzoReconstructor *reconstructor;
+  // stale_depth indicates the number of field entries from the outermost
+  // field value that the region including "stale" values (need to be
+  // refreshed) extends over.
+  int stale_depth = 0;
 
-      if (i == 0){
-        reconstructor = half_dt_recon_;
+  // repeat the following loop twice (for half time-step and full time-step)
+  for (int i=0;i<2;i++){
+    double cur_dt = (i == 0) ? dt/2. : dt;
+    EnzoEFltArrayMap& cur_integration_map =
+      (i == 0) ? external_integration_map : temp_integration_map;
+    EnzoEFltArrayMap& out_integration_map =
+      (i == 0) ? temp_integration_map     : final_integration_map;
+
+    EnzoReconstructor *reconstructor;
+
+    if (i == 0){
+      reconstructor = half_dt_recon_;
+    } else {
+      reconstructor = full_dt_recon_;
+    }
+
+    // set all elements of the arrays in dUcons_map to 0 (throughout the rest
+    // of the current loop, flux divergence and source terms will be
+    // accumulated in these arrays)
+    integration_quan_updater_->clear_dUcons_map(dUcons_map, 0., passive_list);
+
+    // Compute the primitive quantities from the integration quantites
+    // This basically copies all quantities that are both and an integration
+    // quantity and a primitive and converts the passsive scalars from
+    // conserved-form to specific-form (i.e. from density to mass fraction).
+    // For a non-barotropic gas, this also computes pressure
+    // - for consistency with the Ppm solver, we explicitly avoid the Grackle
+    //   routine. This is only meaningful when grackle models molecular
+    //   hydrogen (which modifes the adiabtic index)
+    const bool ignore_grackle = true;
+    fluid_props->primitive_from_integration(cur_integration_map,
+                                            primitive_map,
+                                            stale_depth, passive_list,
+                                            ignore_grackle);
+
+    // Compute flux along each dimension
+    EnzoEFltArrayMap *flux_maps[3] = {&xflux_map, &yflux_map, &zflux_map};
+
+    for (int dim = 0; dim < 3; dim++){
+      // trim the shape of priml_map and primr_map (they're bigger than
+      // necessary so that they can be reused for each dim).
+      CSlice x_slc = (dim == 0) ? CSlice(0,-1) : CSlice(0, nullptr);
+      CSlice y_slc = (dim == 1) ? CSlice(0,-1) : CSlice(0, nullptr);
+      CSlice z_slc = (dim == 2) ? CSlice(0,-1) : CSlice(0, nullptr);
+
+      EnzoEFltArrayMap pl_map = priml_map.subarray_map(z_slc, y_slc, x_slc);
+      EnzoEFltArrayMap pr_map = primr_map.subarray_map(z_slc, y_slc, x_slc);
+
+      EFlt3DArray *interface_vel_arr_ptr, sliced_interface_vel_arr;
+      if (fluid_props->dual_energy_config().any_enabled()){
+        // when using dual energy formalism, trim the trim scratch-array for
+        // storing interface velocity values (computed by the Riemann Solver).
+        // This is used in the calculation of the internal energy source
+        // term). As with priml_map and primr_map, the array is bigger than
+        // necessary so it can be reused for each axis
+        sliced_interface_vel_arr = scratch->interface_vel_arr
+          .subarray(cc_z_slc, full_slc, full_slc)
+          .subarray(z_slc, y_slc, x_slc);
+        interface_vel_arr_ptr = &sliced_interface_vel_arr;
       } else {
-        reconstructor = full_dt_recon_;
+        // no scratch-space was allocated, so we just pass a nullptr
+        interface_vel_arr_ptr = nullptr;
       }
 
-      // set all elements of the arrays in dUcons_map to 0 (throughout the rest
-      // of the current loop, flux divergence and source terms will be
-      // accumulated in these arrays)
-      integration_quan_updater_->clear_dUcons_map(dUcons_map, 0., passive_list);
-
-      // Compute the primitive quantities from the integration quantites
-      // This basically copies all quantities that are both and an integration
-      // quantity and a primitive and converts the passsive scalars from
-      // conserved-form to specific-form (i.e. from density to mass fraction).
-      // For a non-barotropic gas, this also computes pressure
-      // - for consistency with the Ppm solver, we explicitly avoid the Grackle
-      //   routine. This is only meaningful when grackle models molecular
-      //   hydrogen (which modifes the adiabtic index)
-      const bool ignore_grackle = true;
-      fluid_props->primitive_from_integration(cur_integration_map,
-                                              primitive_map,
-                                              stale_depth, passive_list,
-                                              ignore_grackle);
-
-      // Compute flux along each dimension
-      EnzoEFltArrayMap *flux_maps[3] = {&xflux_map, &yflux_map, &zflux_map};
-
-      for (int dim = 0; dim < 3; dim++){
-        // trim the shape of priml_map and primr_map (they're bigger than
-        // necessary so that they can be reused for each dim).
-        CSlice x_slc = (dim == 0) ? CSlice(0,-1) : CSlice(0, nullptr);
-        CSlice y_slc = (dim == 1) ? CSlice(0,-1) : CSlice(0, nullptr);
-        CSlice z_slc = (dim == 2) ? CSlice(0,-1) : CSlice(0, nullptr);
-
-        EnzoEFltArrayMap pl_map = priml_map.subarray_map(z_slc, y_slc, x_slc);
-        EnzoEFltArrayMap pr_map = primr_map.subarray_map(z_slc, y_slc, x_slc);
-
-        EFlt3DArray *interface_vel_arr_ptr, sliced_interface_vel_arr;
-        if (fluid_props->dual_energy_config().any_enabled()){
-          // when using dual energy formalism, trim the trim scratch-array for
-          // storing interface velocity values (computed by the Riemann Solver).
-          // This is used in the calculation of the internal energy source
-          // term). As with priml_map and primr_map, the array is bigger than
-          // necessary so it can be reused for each axis
-          sliced_interface_vel_arr =
-            scratch->interface_vel_arr.subarray(z_slc, y_slc, x_slc);
-          interface_vel_arr_ptr = &sliced_interface_vel_arr;
-        } else {
-          // no scratch-space was allocated, so we just pass a nullptr
-          interface_vel_arr_ptr = nullptr;
-        }
+      compute_flux_(dim, cur_dt, cell_widths[dim], primitive_map,
+                    pl_map, pr_map, *(flux_maps[dim]), dUcons_map,
+                    interface_vel_arr_ptr, *reconstructor, bfield_method_,
+                    stale_depth, passive_list);
+    }
 
-        compute_flux_(dim, cur_dt, cell_widths[dim], primitive_map,
-                      pl_map, pr_map, *(flux_maps[dim]), dUcons_map,
-                      interface_vel_arr_ptr, *reconstructor, bfield_method_,
-                      stale_depth, passive_list);
-      }
+    if (i == 1 && save_fluxes) {
+      // Dual Energy Formalism Note:
+      // - the interface velocities on the edge of the blocks will be
+      //   different if using SMR/AMR. This means that the internal energy
+      //   source terms won't be fully self-consistent along the edges. This
+      //   same effect is also present in the Ppm Solver
+      save_fluxes_for_corrections_(block, xflux_map, 0, cell_widths[0],
+                                   cur_dt);
+      save_fluxes_for_corrections_(block, yflux_map, 1, cell_widths[1],
+                                   cur_dt);
+      save_fluxes_for_corrections_(block, zflux_map, 2, cell_widths[2],
+                                   cur_dt);
+    }
 
-      if (i == 1 && store_fluxes_for_corrections_) {
-        // Dual Energy Formalism Note:
-        // - the interface velocities on the edge of the blocks will be
-        //   different if using SMR/AMR. This means that the internal energy
-        //   source terms won't be fully self-consistent along the edges. This
-        //   same effect is also present in the Ppm Solver
-        save_fluxes_for_corrections_(block, xflux_map, 0, cell_widths[0],
-				     cur_dt);
-        save_fluxes_for_corrections_(block, yflux_map, 1, cell_widths[1],
-				     cur_dt);
-        save_fluxes_for_corrections_(block, zflux_map, 2, cell_widths[2],
-				     cur_dt);
-      }
+    // increment the stale_depth
+    stale_depth+=reconstructor->immediate_staling_rate();
+
+    // Compute the source terms (use them to update dUcons_group)
+    compute_source_terms_(cur_dt, i == 1, external_integration_map,
+                          primitive_map, accel_map, dUcons_map, stale_depth);
+
+    // Update Bfields
+    if (bfield_method_ != nullptr) {
+      bfield_method_->update_all_bfield_components(cur_integration_map,
+                                                   xflux_map, yflux_map,
+                                                   zflux_map,
+                                                   out_integration_map,
+                                                   cur_dt,
+                                                   stale_depth);
+      bfield_method_->increment_partial_timestep();
+    }
+
+    // Update the integration quantities (includes flux divergence and source
+    // terms). This currently needs to happen after updating the
+    // cell-centered B-field so that the pressure floor can be applied to the
+    // total energy (and if necessary the total energy can be synchronized
+    // with the internal energy)
+    integration_quan_updater_->update_quantities
+      (external_integration_map, dUcons_map, out_integration_map,
+       stale_depth, passive_list);
+
+    // increment stale_depth since the inner values have been updated
+    // but the outer values have not
+    stale_depth+=reconstructor->delayed_staling_rate();
+  }
+}
+
+//----------------------------------------------------------------------
 
-      // increment the stale_depth
-      stale_depth+=reconstructor->immediate_staling_rate();
-
-      // Compute the source terms (use them to update dUcons_group)
-      compute_source_terms_(cur_dt, i == 1, external_integration_map,
-                            primitive_map, accel_map, dUcons_map, stale_depth);
-
-      // Update Bfields
-      if (bfield_method_ != nullptr) {
-        bfield_method_->update_all_bfield_components(cur_integration_map,
-                                                     xflux_map, yflux_map,
-                                                     zflux_map,
-                                                     out_integration_map,
-                                                     cur_dt,
-                                                     stale_depth);
-        bfield_method_->increment_partial_timestep();
+/// Copy the layers [iz_start, iz_stop) from the tile buffer (whose first
+/// layer corresponds to layer iz_offset of the block) into the fields.
+/// Only the cells at least stale_depth cells from the x and y edges are
+/// copied, since the outer cells of the buffer were never updated
+static void copy_tile_to_fields_(const EnzoEFltArrayMap &tile_map,
+                                 EnzoEFltArrayMap &integration_map,
+                                 int iz_offset, int iz_start, int iz_stop,
+                                 int stale_depth)
+{
+  const int my = integration_map.array_shape(1);
+  const int mx = integration_map.array_shape(2);
+  const std::size_t nkeys = integration_map.size();
+  for (std::size_t ikey = 0; ikey < nkeys; ikey++){
+    CelloView<const enzo_float,3> src = tile_map[ikey];
+    CelloView<enzo_float,3> dst = integration_map[ikey];
+    for (int iz = iz_start; iz < iz_stop; iz++){
+      for (int iy = stale_depth; iy < my - stale_depth; iy++){
+        for (int ix = stale_depth; ix < mx - stale_depth; ix++){
+          dst(iz,iy,ix) = src(iz - iz_offset,iy,ix);
+        }
       }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
 
-      // Update the integration quantities (includes flux divergence and source
-      // terms). This currently needs to happen after updating the
-      // cell-centered B-field so that the pressure floor can be applied to the
-      // total energy (and if necessary the total energy can be synchronized
-      // with the internal energy)
-      integration_quan_updater_->update_quantities
-        (external_integration_map, dUcons_map, out_integration_map,
-         stale_depth, passive_list);
-
-      // increment stale_depth since the inner values have been updated
-      // but the outer values have not
-      stale_depth+=reconstructor->delayed_staling_rate();
+void EnzoMethodMHDVlct::compute_tiled_
+(Block * block, EnzoEFltArrayMap &integration_map,
+ const EnzoEFltArrayMap &accel_map, const str_vec_t& passive_list) noexcept
+{
+  // the halo of each tile must be deep enough to cover the staling from
+  // both partial timesteps
+  const int halo = (half_dt_recon_->total_staling_rate() +
+                    full_dt_recon_->total_staling_rate());
+
+  int gx,gy,gz;
+  Field field = block->data()->field();
+  field.ghost_depth(field.field_id("density"), &gx, &gy, &gz);
+
+  const int mz = integration_map.array_shape(0);
+  const int my = integration_map.array_shape(1);
+  const int mx = integration_map.array_shape(2);
+
+  const std::array<int,3> tile_shape = {tile_depth_ + 2*halo, my, mx};
+  EnzoVlctScratchSpace* const scratch =
+    get_scratch_ptr_(tile_shape, passive_list, true);
+
+  ASSERT("EnzoMethodMHDVlct::compute_tiled_",
+         "scratch space was allocated for a different mode or block shape",
+         (scratch->tile_out_map[0].size() > 0) &&
+         (scratch->primitive_map.array_shape(0) == tile_shape[0]) &&
+         (scratch->primitive_map.array_shape(1) == my) &&
+         (scratch->primitive_map.array_shape(2) == mx));
+
+  // number of cells from the edges of a tile that are stale after the
+  // final update of the integration quantities (matches integrate_)
+  const int stale_depth = (half_dt_recon_->total_staling_rate() +
+                           full_dt_recon_->immediate_staling_rate());
+
+  const CSlice full_slc(0, nullptr);
+  const bool has_accel = accel_map.size() != 0;
+
+  // layers updated by the previous tile, waiting to be copied back into
+  // the fields
+  int prev_start = 0, prev_stop = 0, prev_offset = 0;
+
+  const int num_tiles = (mz - 2*gz + tile_depth_ - 1) / tile_depth_;
+
+  for (int it = 0; it < num_tiles; it++){
+    // active layers updated by this tile, and the layers it reads
+    const int iz_start = gz + it*tile_depth_;
+    const int iz_stop = std::min(iz_start + tile_depth_, mz - gz);
+    const int iz_offset = iz_start - halo;
+    const CSlice tile_slc(iz_offset, iz_stop + halo);
+
+    EnzoEFltArrayMap tile_integration_map =
+      integration_map.subarray_map(tile_slc, full_slc, full_slc);
+    const EnzoEFltArrayMap tile_accel_map = (has_accel) ?
+      accel_map.subarray_map(tile_slc, full_slc, full_slc) : accel_map;
+    EnzoEFltArrayMap tile_out_map = scratch->tile_out_map[it % 2]
+      .subarray_map(CSlice(0, iz_stop + halo - iz_offset), full_slc, full_slc);
+
+    integrate_(block, tile_integration_map, tile_out_map, tile_accel_map,
+               scratch, false, passive_list);
+
+    // the halo of this tile overlapped the layers updated by the previous
+    // tile, so they can only be written back now
+    if (it > 0) {
+      copy_tile_to_fields_(scratch->tile_out_map[(it - 1) % 2],
+                           integration_map, prev_offset,
+                           prev_start, prev_stop, stale_depth);
     }
+
+    // write back the tile's active layers; the first and last tiles also
+    // write back the ghost layers of the block that are still valid
+    prev_start = (it == 0) ? iz_offset + stale_depth : iz_start;
+    prev_stop = (it == num_tiles - 1) ? iz_stop + halo - stale_depth : iz_stop;
+    prev_offset = iz_offset;
   }
 
-  block->compute_done();
+  copy_tile_to_fields_(scratch->tile_out_map[(num_tiles - 1) % 2],
+                       integration_map, prev_offset, prev_start, prev_stop,
+                       stale_depth);
 }
 
 //----------------------------------------------------------------------
@@ -71,6 +71,21 @@
 ///        - For the purposes of these enumerated maps, we assume that the
 ///          length of a face-centered array along the dimension with
 ///          face-centering is 1 less than that of a cell-centered array
+///
+///    Tiled Execution
+///    ---------------
+///    When tile_depth is positive, the active zone of the block is split
+///    into slabs along the z-axis, each holding tile_depth layers of cells.
+///    Both partial timesteps are evaluated for one slab (plus a halo of
+///    ghost-depth layers on either side) at a time, so that all scratch
+///    maps are sized to a slab rather than the full block. The updated
+///    values of a slab are held in one of two slab-sized buffers and are
+///    only copied back into the fields once the next slab (whose halo
+///    overlaps the current slab) has been computed. Only the cells of a
+///    slab that are not stale are copied back (its active layers, and the
+///    ghost layers that are still valid). This mode currently
+///    requires that mhd_choice is "no_bfield" and that fluxes are not
+///    stored for flux corrections.
 
 #ifndef ENZO_ENZO_METHOD_VLCT_HPP
 #define ENZO_ENZO_METHOD_VLCT_HPP
@@ -105,7 +120,8 @@ public: // interface
 		    std::string full_recon_name,
 		    double theta_limiter,
 		    std::string mhd_choice,
-		    bool store_fluxes_for_corrections);
+		    bool store_fluxes_for_corrections,
+		    int tile_depth = 0);
 
   /// Charm++ PUP::able declarations
   PUPable_decl(EnzoMethodMHDVlct);
@@ -124,7 +140,8 @@ public: // interface
       integration_field_list_(),
       primitive_field_list_(),
       lazy_passive_list_(),
-      store_fluxes_for_corrections_(false)
+      store_fluxes_for_corrections_(false),
+      tile_depth_(0)
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -161,6 +178,37 @@ protected: // methods
                                         const str_vec_t *passive_list)
     const noexcept;
 
+  /// Advances the integration quantities in `external_integration_map` over
+  /// both partial timesteps and stores the result in `final_integration_map`
+  ///
+  /// @param[in]     block The Block being updated. It's used to save fluxes
+  ///     for flux corrections (when `save_fluxes` is true)
+  /// @param[in]     external_integration_map Map of arrays holding the
+  ///     integration quantities at the start of the timestep. This includes
+  ///     passive scalars.
+  /// @param[out]    final_integration_map Map of arrays where the updated
+  ///     integration quantities are stored. This may be the same object as
+  ///     `external_integration_map`.
+  /// @param[in]     accel_map Map that optionally holds the components of the
+  ///     acceleration vector field (with the same shape as
+  ///     `external_integration_map`)
+  /// @param[in]     scratch Pointer to the scratch space. The arrays are
+  ///     sliced along z so that they match `external_integration_map`.
+  /// @param[in]     save_fluxes Indicates whether fluxes are saved for flux
+  ///     corrections.
+  /// @param[in]     passive_list A list of keys for passively advected scalars.
+  void integrate_
+  (Block * block, EnzoEFltArrayMap &external_integration_map,
+   EnzoEFltArrayMap &final_integration_map, const EnzoEFltArrayMap &accel_map,
+   EnzoVlctScratchSpace * scratch, bool save_fluxes,
+   const str_vec_t& passive_list) noexcept;
+
+  /// Advances the block one timestep by calling `integrate_` on slabs of
+  /// `tile_depth_` layers along the z-axis (see "Tiled Execution" above)
+  void compute_tiled_
+  (Block * block, EnzoEFltArrayMap &integration_map,
+   const EnzoEFltArrayMap &accel_map, const str_vec_t& passive_list) noexcept;
+
   /// Computes the fluxes along a given dimension, `dim`, and accumulate the
   /// changes to the integration quantities in `dUcons_map`
   ///
@@ -293,8 +341,11 @@ protected: // methods
   /// @param[in] field_shape Gives the shape, including ghost-zones, of a hydro
   ///     cell-centered field, ordered as (mz,my,mx)
   /// @param[in] passive_list A list of keys for passively advected scalars.
+  /// @param[in] tiled Indicates whether the scratch space is used in
+  ///     tiled mode, in which case field_shape is the shape of a tile
   EnzoVlctScratchSpace* get_scratch_ptr_(const std::array<int,3>& field_shape,
-					 const str_vec_t& passive_list)
+					 const str_vec_t& passive_list,
+                                         bool tiled = false)
     noexcept;
 
 protected: // attributes
@@ -334,6 +385,10 @@ protected: // attributes
 
   /// Indicates whether fluxes should be stored for flux corrections
   bool store_fluxes_for_corrections_;
+
+  /// Number of active cell layers along z per tile (0 to update the full
+  /// block at once)
+  int tile_depth_;
 };
 
 
@@ -365,12 +420,15 @@ public:
   ///     scalars that should be included in each arraymap.
   /// @param[in] dual_energy Indicates whether the dual energy formalism is in
   ///     use (which specifies if relevant scratch-space should be allocated).
+  /// @param[in] tiled Indicates whether the two ``tile_out_map`` buffers
+  ///     used in tiled execution should be allocated.
   EnzoVlctScratchSpace(const std::array<int,3>& shape,
                        const str_vec_t& integration_key_list,
                        const str_vec_t& primitive_key_list,
                        const str_vec_t& integ_updater_keys,
                        const str_vec_t& passive_list,
-		       bool dual_energy) noexcept
+		       bool dual_energy,
+                       bool tiled = false) noexcept
     : interface_vel_arr((dual_energy) ? EFlt3DArray(shape[0],shape[1],shape[2])
 			: EFlt3DArray())
   {
@@ -394,6 +452,10 @@ public:
     primitive_map = setup("primitive", {0,0,0}, primitive_key_list);
     priml_map = setup("priml", {0,0,0}, primitive_key_list);
     primr_map = setup("primr", {0,0,0}, primitive_key_list);
+    if (tiled) {
+      tile_out_map[0] = setup("tile_out_0", {0,0,0}, integration_key_list);
+      tile_out_map[1] = setup("tile_out_1", {0,0,0}, integration_key_list);
+    }
   }
 
 public: // attributes
@@ -433,6 +495,11 @@ public: // attributes
   /// is used, this map won't hold arrays for accumulating changes to the
   /// magnetic fields (that update is handled separately).
   EnzoEFltArrayMap dUcons_map;
+
+  /// Maps of arrays holding the updated integration quantities of the two
+  /// most recently computed tiles, before they are copied back into the
+  /// fields. These are only allocated in tiled mode.
+  EnzoEFltArrayMap tile_out_map[2];
 };
 
 #endif /* ENZO_ENZO_METHOD_VLCT_HPP */
@@ -222,31 +222,40 @@ void EnzoReconstructorPLM<Limiter>::reconstruct_interface
       // initializing the left (right) interface value thanks to the adoption
       // of immediate_staling_rate
 
-      for (int iz=0; iz<wc_right.shape(0); iz++) {
-        for (int iy=0; iy<wc_right.shape(1); iy++) {
-          for (int ix=0; ix<wc_right.shape(2); ix++) {
-
-            // compute limited slopes
-            enzo_float val = wc_center(iz,iy,ix);
-            enzo_float dv = limiter_func(wc_left(iz,iy,ix), val,
-                                         wc_right(iz,iy,ix), theta_limiter);
-            enzo_float half_dv = dv*0.5;
-            enzo_float left_val, right_val;
-
-            if (use_floor) {
-              right_val = enzo_utils::apply_floor(val - half_dv, prim_floor);
-              left_val  = enzo_utils::apply_floor(val + half_dv, prim_floor);
-            } else {
-              right_val = val - half_dv;
-              left_val  = val + half_dv;
+      // distribute the z-slabs among threads
+      auto reconstruct_slabs = [&](int iz_start, int iz_stop)
+        {
+          for (int iz=iz_start; iz<iz_stop; iz++) {
+            for (int iy=0; iy<wc_right.shape(1); iy++) {
+              for (int ix=0; ix<wc_right.shape(2); ix++) {
+
+                // compute limited slopes
+                enzo_float val = wc_center(iz,iy,ix);
+                enzo_float dv = limiter_func(wc_left(iz,iy,ix), val,
+                                             wc_right(iz,iy,ix),
+                                             theta_limiter);
+                enzo_float half_dv = dv*0.5;
+                enzo_float left_val, right_val;
+
+                if (use_floor) {
+                  right_val = enzo_utils::apply_floor(val - half_dv,
+                                                      prim_floor);
+                  left_val  = enzo_utils::apply_floor(val + half_dv,
+                                                      prim_floor);
+                } else {
+                  right_val = val - half_dv;
+                  left_val  = val + half_dv;
+                }
+
+                // face centered fields: index i corresponds to the value at
+                // i-1/2
+                wr(iz,iy,ix) = right_val;
+                wl_offset(iz,iy,ix) = left_val;
+              }
             }
-
-            // face centered fields: index i corresponds to the value at i-1/2
-            wr(iz,iy,ix) = right_val;
-            wl_offset(iz,iy,ix) = left_val;
           }
-        }
-      }
+        };
+      ParallelFor::apply(0, wc_right.shape(0), reconstruct_slabs);
     };
 
   for (const std::string &key : active_key_names_){
@@ -33,11 +33,44 @@ int EnzoBlock::SolveHydroEquations
   field.ghost_depth(0,&gx,&gy,&gz);
   field.dimensions(0,&mx,&my,&mz);
 
+  // ncolor: number of color fields
+
+  int    ncolor  = field.groups()->size("color");
+
+  /* Reserve per-process scratch space for all temporary arrays below,
+     which is reused across blocks and cycles and only reallocated when
+     the block shape or number of color fields grows.  This includes
+     the solver workspace (enough to fit 31 of the largest possible 2d
+     slices plus 4*ncolor). */
+
+  const int m = mx*my*mz;
+
+  int tempsize = MAX(MAX(mx*my, my*mz), mz*mx);
+
+  int NumberOfSubgrids = 1;
+
+  const int array_size = NumberOfSubgrids*3*(18+2*ncolor) + 1;
+
+  ScratchArena * scratch = ScratchArena::instance();
+
+  scratch->reserve
+    (ScratchArena::bytes<int>(ncolor) +
+     ScratchArena::bytes<int>(array_size) +
+     ScratchArena::bytes<enzo_float>(tempsize*(32+ncolor*4)) +
+     2*ScratchArena::bytes<enzo_float>(m) + // velocity stand-ins
+     ScratchArena::bytes<enzo_float>(mx) +  // CellWidthTemp
+     ScratchArena::bytes<enzo_float>(my) +
+     ScratchArena::bytes<enzo_float>(mz)
+#ifdef IE_ERROR_FIELD
+     + 3*ScratchArena::bytes<int>(m)
+#endif
+     );
+
 #ifdef IE_ERROR_FIELD
   int num_ie_error = 0;
-  int *ie_error_x = new int [mx*my*mz];
-  int *ie_error_y = new int [mx*my*mz];
-  int *ie_error_z = new int [mx*my*mz];
+  int *ie_error_x = scratch->allocate<int>(m);
+  int *ie_error_y = scratch->allocate<int>(m);
+  int *ie_error_z = scratch->allocate<int>(m);
 #else
   int num_ie_error = -1;
   int *ie_error_x = nullptr;
@@ -50,15 +83,11 @@ int EnzoBlock::SolveHydroEquations
   // Prepare color field parameters
   //------------------------------
 
-  // ncolor: number of color fields
-
-  int    ncolor  = field.groups()->size("color");
-
   // colorpt: the color 'array' (contains all color fields)
   enzo_float * colorpt = (enzo_float *) field.permanent();
 
   // coloff: offsets into the color array (for each color field)
-  int * coloff   = (ncolor > 0) ? (new int [ncolor]) : NULL;
+  int * coloff   = (ncolor > 0) ? scratch->allocate<int>(ncolor) : NULL;
   int index_color = 0;
   for (int index_field = 0;
        index_field < field.field_count();
@@ -95,14 +124,14 @@ int EnzoBlock::SolveHydroEquations
   if (rank >= 2) {
     velocity_y = (enzo_float *) field.values("velocity_y");
   } else {
-    velocity_y = new enzo_float[size];
+    velocity_y = scratch->allocate<enzo_float>(size);
     for (int i=0; i<size; i++) velocity_y[i] = 0.0;
   }
 
     if (rank >= 3) {
     velocity_z = (enzo_float *) field.values("velocity_z");
   } else {
-    velocity_z = new enzo_float[size];
+    velocity_z = scratch->allocate<enzo_float>(size);
     for (int i=0; i<size; i++) velocity_z[i] = 0.0;
   }
 
@@ -151,10 +180,6 @@ int EnzoBlock::SolveHydroEquations
   enzo_float pressure_floor = fluid_floor_config.has_pressure_floor() ?
                  fluid_floor_config.pressure() : 0.0;
 
-  /* allocate space for fluxes */
-
-  int NumberOfSubgrids = 1;
-
   /* fix grid quantities so they are defined to at least 3 dims */
 
   for (int i = rank; i < 3; i++) {
@@ -164,22 +189,15 @@ int EnzoBlock::SolveHydroEquations
     //      GridGlobalStart[i] = 0;
   }
 
-  /* allocate temporary space for solver (enough to fit 31 of the largest
-     possible 2d slices plus 4*ncolor). */
+  /* temporary space for solver */
 
-  int tempsize = MAX(MAX(GridDimension[0]*GridDimension[1],
-			 GridDimension[1]*GridDimension[2]),
-		     GridDimension[2]*GridDimension[0]);
-
-  enzo_float *temp = new enzo_float[tempsize*(32+ncolor*4)];
+  enzo_float *temp = scratch->allocate<enzo_float>(tempsize*(32+ncolor*4));
 
   /* create and fill in arrays which are easier for the solver to
      understand. */
 
-  size = NumberOfSubgrids*3*(18+2*ncolor) + 1;
-
-  int * array = new int[size];
-  for (int i=0; i<size; i++) array[i] = 0;
+  int * array = scratch->allocate<int>(array_size);
+  for (int i=0; i<array_size; i++) array[i] = 0;
 
   int * p = array;
   int *leftface  = p; p+=3;
@@ -287,7 +305,7 @@ int EnzoBlock::SolveHydroEquations
 
   enzo_float * CellWidthTemp[MAX_DIMENSION];
   for (dim = 0; dim < MAX_DIMENSION; dim++) {
-    CellWidthTemp[dim] = new enzo_float [GridDimension[dim]];
+    CellWidthTemp[dim] = scratch->allocate<enzo_float>(GridDimension[dim]);
     if (dim < rank) {
       for (int i=0; i<GridDimension[dim]; i++)
 	CellWidthTemp[dim][i] = (cosmo_a*CellWidth[dim]);
@@ -359,24 +377,7 @@ int EnzoBlock::SolveHydroEquations
   }
 #endif
 
-  for (dim = 0; dim < MAX_DIMENSION; dim++) {
-    delete [] CellWidthTemp[dim];
-  }
-
-  /* deallocate temporary space for solver */
-
-  delete [] temp;
-  if (rank < 2) delete [] velocity_y;
-  if (rank < 3) delete [] velocity_z;
-
-  delete [] array;
-
-  delete [] coloff;
-#ifdef IE_ERROR_FIELD
-  delete [] ie_error_x;
-  delete [] ie_error_y;
-  delete [] ie_error_z;
-#endif
+  /* temporary space for solver is kept in the scratch arena */
 
   return ENZO_SUCCESS;
 
@@ -16,6 +16,7 @@
 // private headers:
 #include "EnzoRiemannLUT.hpp"
 #include "EnzoRiemannUtils.hpp"
+#include "EnzoRiemannBatch.hpp"
 #include "EnzoRiemannImpl.hpp"
 #include "EnzoRiemannHLL.hpp"
 #include "EnzoRiemannHLLC.hpp"
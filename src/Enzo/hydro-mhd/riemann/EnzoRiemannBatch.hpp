@@ -0,0 +1,116 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     EnzoRiemannBatch.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    [\ref Enzo] Batched execution of Riemann solver kernels
+///
+/// Riemann solver kernels compute the flux at a single cell interface. The
+/// functions defined here evaluate a kernel over all non-stale interfaces,
+/// grouping consecutive interfaces along the x-axis into batches of a
+/// compile-time width. Each batch is an OpenMP SIMD loop with a fixed trip
+/// count equal to the width, so the compiler can map one batch onto full
+/// vector registers without runtime peeling or alignment checks; leftover
+/// interfaces at the end of each row are handled by a scalar loop.
+///
+/// The batches rely on OpenMP SIMD directives, which the riemann library
+/// enables (and signals by defining ENZO_RIEMANN_OMP_SIMD) whenever the
+/// compiler supports them, independently of the global USE_SIMD option.
+/// The batch width then defaults to the number of `enzo_float` values that
+/// fit in a vector register of the target instruction set; without the
+/// directives it defaults to 1, since a batch would just be a scalar loop.
+/// It can be overridden by defining ENZO_RIEMANN_BATCH_WIDTH (see the
+/// `riemann_batch_width` CMake option); a width of 1 disables batching.
+
+#ifndef ENZO_ENZO_RIEMANN_BATCH_HPP
+#define ENZO_ENZO_RIEMANN_BATCH_HPP
+
+namespace enzo_riemann_utils{
+
+  /// number of bytes in a vector register of the target instruction set
+#if defined(__AVX512F__)
+  constexpr int simd_register_bytes = 64;
+#elif defined(__AVX__)
+  constexpr int simd_register_bytes = 32;
+#elif defined(__SSE2__) || defined(__ARM_NEON) || defined(__ALTIVEC__)
+  constexpr int simd_register_bytes = 16;
+#else
+  constexpr int simd_register_bytes = 0;
+#endif
+
+  /// number of cell interfaces evaluated per batch
+#if defined(ENZO_RIEMANN_BATCH_WIDTH)
+  constexpr int batch_width = ENZO_RIEMANN_BATCH_WIDTH;
+#elif ! defined(ENZO_RIEMANN_OMP_SIMD)
+  constexpr int batch_width = 1;
+#else
+  constexpr int batch_width =
+    (simd_register_bytes >= (int)sizeof(enzo_float)) ?
+    simd_register_bytes / (int)sizeof(enzo_float) : 1;
+#endif
+
+  static_assert(batch_width >= 1, "Riemann batch width must be positive");
+
+  //----------------------------------------------------------------------
+
+  /// Evaluate `kernel` at the interfaces `(iz,iy,ix)` for
+  /// `ix_start <= ix < ix_stop`, in batches of `W` interfaces
+  template <int W, class KernelFunctor>
+  FORCE_INLINE void execute_row_batched(const KernelFunctor& kernel,
+                                        const int iz, const int iy,
+                                        const int ix_start,
+                                        const int ix_stop) noexcept
+  {
+    int ix = ix_start;
+    for (; ix + W <= ix_stop; ix += W) {
+      #pragma omp simd simdlen(W)
+      for (int lane = 0; lane < W; lane++) {
+        kernel(iz, iy, ix + lane);
+      }
+    }
+    // remaining interfaces that don't fill a batch
+    for (; ix < ix_stop; ix++) {
+      kernel(iz, iy, ix);
+    }
+  }
+
+  //----------------------------------------------------------------------
+
+  /// Evaluate `kernel` at all interfaces that are at least `stale_depth`
+  /// entries from the edges of an array of shape `(mz, my, mx)`.
+  ///
+  /// The z-slabs are distributed among threads using ParallelFor.
+  ///
+  /// @tparam W The number of interfaces per batch. When `W` is 1, this reduces
+  ///     to a plain loop over each row (relying on auto-vectorization).
+  template <int W, class KernelFunctor>
+  void execute_kernel(const KernelFunctor& kernel, const int mz, const int my,
+                      const int mx, const int stale_depth) noexcept
+  {
+    auto execute_slabs = [&kernel, my, mx, stale_depth](int iz_start,
+                                                        int iz_stop)
+      {
+        if constexpr (W == 1) {
+          for (int iz = iz_start; iz < iz_stop; iz++) {
+            for (int iy = stale_depth; iy < my - stale_depth; iy++) {
+              #pragma omp simd
+              for (int ix = stale_depth; ix < mx - stale_depth; ix++) {
+                kernel(iz,iy,ix);
+              }
+            }
+          }
+        } else {
+          for (int iz = iz_start; iz < iz_stop; iz++) {
+            for (int iy = stale_depth; iy < my - stale_depth; iy++) {
+              execute_row_batched<W>(kernel, iz, iy,
+                                     stale_depth, mx - stale_depth);
+            }
+          }
+        }
+      };
+    ParallelFor::apply(stale_depth, mz - stale_depth, execute_slabs);
+  }
+
+}
+
+#endif /* ENZO_ENZO_RIEMANN_BATCH_HPP */
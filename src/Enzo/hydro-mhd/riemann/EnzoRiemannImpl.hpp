@@ -211,6 +211,9 @@ private: // helper methods
 
   /// Actually executes the Riemann Solver
   ///
+  /// The kernel is evaluated over batches of
+  /// `enzo_riemann_utils::batch_width` interfaces (see EnzoRiemannBatch.hpp)
+  ///
   /// @note
   /// for purposes of getting icc to vectorize code, it seems to be important
   /// that this method's contents are separated from `EnzoRiemannImpl::solve`
@@ -327,14 +330,8 @@ void EnzoRiemannImpl<KernelFunctor>::solve_
   const int mx = config.flux_arr.shape(3);
 
   // compute the flux at all non-stale cell interfaces
-  for (int iz = stale_depth; iz < mz - stale_depth; iz++) {
-    for (int iy = stale_depth; iy < my - stale_depth; iy++) {
-      #pragma omp simd
-      for (int ix = stale_depth; ix < mx - stale_depth; ix++) {
-        kernel(iz,iy,ix);
-      }
-    }
-  }
+  enzo_riemann_utils::execute_kernel<enzo_riemann_utils::batch_width>
+    (kernel, mz, my, mx, stale_depth);
 }
 
 #endif /* ENZO_ENZO_RIEMANN_IMPL_HPP */
@@ -0,0 +1,234 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_EnzoRiemann.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    Test program and micro-benchmark for batched Riemann solver
+///           kernels
+///
+/// For each kernel (HLLE and HLLC with HydroLUT, HLLE and HLLD with MHDLUT)
+/// and each axis, this evaluates the kernel over a smooth test problem with
+/// several batch widths. Results for every width are checked against the
+/// unbatched (width 1) evaluation, and the throughput of each width is
+/// printed in millions of interfaces per second. The widths are timed over
+/// several rounds in alternating order, with the caches flushed before each
+/// timing, and the best rate of each width is reported, so that no width
+/// benefits from running first or from data left in cache by another.
+
+#include "test.hpp"
+#include "main.hpp"
+#include "enzo.hpp"
+
+#include "EnzoRiemannLUT.hpp"
+#include "EnzoRiemannUtils.hpp"
+#include "EnzoRiemannBatch.hpp"
+#include "EnzoRiemannImpl.hpp"
+#include "EnzoRiemannHLL.hpp"
+#include "EnzoRiemannHLLC.hpp"
+#include "EnzoRiemannHLLD.hpp"
+
+#define CK_TEMPLATES_ONLY
+#include "enzo.def.h"
+#undef CK_TEMPLATES_ONLY
+
+// number of interfaces along each axis
+const int N = 64;
+// number of times each kernel is evaluated over the full array per timing
+const int NUM_REPEAT = 4;
+// number of timing rounds; the order of the widths alternates between rounds
+const int NUM_ROUNDS = 4;
+// number of bytes written between timings to flush the caches
+const std::size_t FLUSH_BYTES = 32*1024*1024;
+// number of batch widths tested: 1, 2, 4, 8, and the default
+const int NUM_WIDTHS = 5;
+
+//----------------------------------------------------------------------
+
+/// Initialize left and right reconstructed primitives with smooth values
+template <class LUT>
+static void init_primitives_(CelloView<enzo_float,4> prim_l,
+                             CelloView<enzo_float,4> prim_r)
+{
+  for (int iz=0; iz<N; iz++) {
+    for (int iy=0; iy<N; iy++) {
+      for (int ix=0; ix<N; ix++) {
+        const double x = 2.0*cello::pi*(ix + 0.5*iy + 0.25*iz)/N;
+        for (int side=0; side<2; side++) {
+          CelloView<enzo_float,4> & prim = (side==0) ? prim_l : prim_r;
+          const double s = (side==0) ? 0.0 : 0.1;
+          prim(LUT::density,iz,iy,ix)      = 1.0 + 0.5*std::sin(x + s);
+          prim(LUT::velocity_i,iz,iy,ix)   = 0.3*std::cos(x - s);
+          prim(LUT::velocity_j,iz,iy,ix)   = 0.2*std::sin(2*x + s);
+          prim(LUT::velocity_k,iz,iy,ix)   = -0.1*std::cos(3*x);
+          if (LUT::has_bfields) {
+            prim(LUT::bfield_i,iz,iy,ix)   = 0.5;
+            prim(LUT::bfield_j,iz,iy,ix)   = 0.4*std::sin(x + 2*s);
+            prim(LUT::bfield_k,iz,iy,ix)   = 0.3*std::cos(x - 2*s);
+          }
+          // the total_energy entry holds pressure
+          prim(LUT::total_energy,iz,iy,ix) = 0.6 + 0.2*std::cos(x + s);
+        }
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+/// Overwrite a buffer larger than the caches, so that the next timing
+/// starts with none of the kernel's data in cache
+static void flush_cache_()
+{
+  static std::vector<char> buffer(FLUSH_BYTES);
+  static char value = 0;
+  ++value;
+  std::fill(buffer.begin(), buffer.end(), value);
+  // read a value back so the writes are not optimized away
+  volatile char sink = buffer[(std::size_t)(unsigned char)value];
+  (void) sink;
+}
+
+//----------------------------------------------------------------------
+
+/// Evaluate the kernel NUM_REPEAT times with batch width W and return the
+/// throughput in millions of interfaces per second
+template <int W, class KernelFunctor>
+static double time_kernel_(const KernelConfig<EnzoEOSIdeal> & config,
+                           int stale_depth)
+{
+  const KernelFunctor kernel{config};
+  const int mz = config.flux_arr.shape(1);
+  const int my = config.flux_arr.shape(2);
+  const int mx = config.flux_arr.shape(3);
+  flush_cache_();
+  Timer timer;
+  timer.start();
+  for (int i=0; i<NUM_REPEAT; i++) {
+    enzo_riemann_utils::execute_kernel<W>(kernel, mz, my, mx, stale_depth);
+  }
+  timer.stop();
+  const double n = double(NUM_REPEAT)*
+    (mz - 2*stale_depth)*(my - 2*stale_depth)*(mx - 2*stale_depth);
+  return (timer.value() > 0.0) ? 1e-6*n/timer.value() : 0.0;
+}
+
+//----------------------------------------------------------------------
+
+/// Time the kernel with the iw'th tested batch width
+template <class KernelFunctor>
+static double time_width_(int iw, const KernelConfig<EnzoEOSIdeal> & config,
+                          int stale_depth)
+{
+  switch (iw) {
+  case 0:  return time_kernel_<1,KernelFunctor>(config,stale_depth);
+  case 1:  return time_kernel_<2,KernelFunctor>(config,stale_depth);
+  case 2:  return time_kernel_<4,KernelFunctor>(config,stale_depth);
+  case 3:  return time_kernel_<8,KernelFunctor>(config,stale_depth);
+  default: return time_kernel_
+      <enzo_riemann_utils::batch_width,KernelFunctor>(config,stale_depth);
+  }
+}
+
+//----------------------------------------------------------------------
+
+/// Return whether the fluxes computed in config match those in config_ref
+template <class LUT>
+static bool fluxes_match_(const KernelConfig<EnzoEOSIdeal> & config,
+                          const KernelConfig<EnzoEOSIdeal> & config_ref)
+{
+  // batched evaluation may reorder floating-point operations
+  const double tol = (sizeof(enzo_float) == 8) ? 1e-12 : 1e-5;
+  double err = 0.0;
+  auto update_err = [&err](enzo_float a, enzo_float b)
+    { err = std::max(err, (double) cello::err_abs(a,b)); };
+  for (int iz=0; iz<N; iz++) {
+    for (int iy=0; iy<N; iy++) {
+      for (int ix=0; ix<N; ix++) {
+        for (std::size_t iq=0; iq<LUT::num_entries; iq++) {
+          update_err(config.flux_arr(iq,iz,iy,ix),
+                     config_ref.flux_arr(iq,iz,iy,ix));
+        }
+        update_err(config.internal_energy_flux_arr(iz,iy,ix),
+                   config_ref.internal_energy_flux_arr(iz,iy,ix));
+        update_err(config.velocity_i_bar_arr(iz,iy,ix),
+                   config_ref.velocity_i_bar_arr(iz,iy,ix));
+      }
+    }
+  }
+  return err <= tol;
+}
+
+//----------------------------------------------------------------------
+
+/// Test and benchmark a kernel along each axis for several batch widths
+template <class KernelFunctor>
+static void test_kernel_(const char * name)
+{
+  using LUT = typename KernelFunctor::LUT;
+  const int nq = LUT::num_entries;
+
+  unit_func (name);
+
+  CelloView<enzo_float,4> prim_l(nq,N,N,N), prim_r(nq,N,N,N);
+  init_primitives_<LUT>(prim_l, prim_r);
+
+  const EnzoEOSIdeal eos = {5.0/3.0};
+  const int stale_depth = 1;
+
+  for (int dim=0; dim<3; dim++) {
+
+    // reference (unbatched) fluxes
+    const KernelConfig<EnzoEOSIdeal> config_ref =
+      {dim, eos, CelloView<enzo_float,4>(nq,N,N,N), prim_l, prim_r,
+       CelloView<enzo_float,3>(N,N,N), CelloView<enzo_float,3>(N,N,N)};
+    const KernelConfig<EnzoEOSIdeal> config =
+      {dim, eos, CelloView<enzo_float,4>(nq,N,N,N), prim_l, prim_r,
+       CelloView<enzo_float,3>(N,N,N), CelloView<enzo_float,3>(N,N,N)};
+
+    // check each width against the unbatched fluxes
+    time_width_<KernelFunctor>(0,config_ref,stale_depth);
+    for (int iw=1; iw<NUM_WIDTHS; iw++) {
+      time_width_<KernelFunctor>(iw,config,stale_depth);
+      unit_assert (fluxes_match_<LUT>(config, config_ref));
+    }
+
+    // keep the best rate of each width over rounds in alternating order
+    double rate[NUM_WIDTHS] = {0.0, 0.0, 0.0, 0.0, 0.0};
+    for (int round=0; round<NUM_ROUNDS; round++) {
+      for (int k=0; k<NUM_WIDTHS; k++) {
+        const int iw = (round % 2 == 0) ? k : NUM_WIDTHS - 1 - k;
+        rate[iw] = std::max
+          (rate[iw], time_width_<KernelFunctor>(iw,config,stale_depth));
+      }
+    }
+
+    CkPrintf ("%-10s dim %d  Minterfaces/s  W=1: %7.2f  W=2: %7.2f  "
+              "W=4: %7.2f  W=8: %7.2f  W=%d (default): %7.2f\n",
+              name, dim, rate[0], rate[1], rate[2], rate[3],
+              enzo_riemann_utils::batch_width, rate[4]);
+  }
+}
+
+//----------------------------------------------------------------------
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class ("EnzoRiemannBatch");
+
+  test_kernel_<HLLKernel<EinfeldtWavespeed<HydroLUT>>> ("HLLE");
+  test_kernel_<HLLCKernel> ("HLLC");
+  test_kernel_<HLLKernel<EinfeldtWavespeed<MHDLUT>>> ("HLLE-MHD");
+  test_kernel_<HLLDKernel> ("HLLD");
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
+#include "enzo.def.h"
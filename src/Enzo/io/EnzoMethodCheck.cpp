@@ -34,7 +34,8 @@ int Simulation::file_counter_ = 0;
 //----------------------------------------------------------------------
 
 EnzoMethodCheck::EnzoMethodCheck
-(int num_files, std::string ordering, std::vector<std::string> directory, int monitor_iter)
+(int num_files, std::string ordering, std::vector<std::string> directory,
+ int monitor_iter, std::string layout, FileFilter file_filter)
   : Method(),
     num_files_(num_files),
     ordering_(ordering),
@@ -55,7 +56,7 @@ EnzoMethodCheck::EnzoMethodCheck
     opts.setMap(io_map);
   
     proxy_io_enzo_writer = CProxy_IoEnzoWriter::ckNew
-      (num_files, ordering,monitor_iter, opts);
+      (num_files, ordering,monitor_iter, layout, file_filter, opts);
 
     proxy_io_enzo_writer.doneInserting();
 
@@ -104,6 +105,20 @@ void EnzoSimulation::r_method_check_enter(CkReductionMsg *msg)
   
   delete msg;
 
+  if (check_active_) {
+    // [Method:check:async] Wait for the previous checkpoint to finish
+    // writing before starting this one
+    check_pending_ = true;
+  } else {
+    check_start_();
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSimulation::check_start_()
+// [ Called on ip=0 only ]
+{
   check_num_files_  = enzo::config()->method_check_num_files;
   check_ordering_   = enzo::config()->method_check_ordering;
   check_directory_  = enzo::config()->method_check_dir;
@@ -139,8 +154,12 @@ void EnzoSimulation::r_method_check_enter(CkReductionMsg *msg)
     for (int i=0; i<check_num_files_; i++) {
       stream_file_list << "block_data-" << std::setw(max_digits) << i << "\n";
     }
+    // field layout, read by Simulation::r_restart_start()
+    stream_file_list << enzo::config()->method_check_layout << "\n";
     stream_file_list.flush();
 
+    check_active_ = enzo::config()->method_check_async;
+
     enzo::block_array().p_check_write_first
       (check_num_files_, check_ordering_, name_dir);
   }
@@ -152,11 +171,22 @@ void EnzoSimulation::r_method_check_enter(CkReductionMsg *msg)
 //----------------------------------------------------------------------
 
 IoEnzoWriter::IoEnzoWriter
-(int num_files, std::string ordering, int monitor_iter) throw ()
+(int num_files, std::string ordering, int monitor_iter,
+ std::string layout, FileFilter file_filter) throw ()
   : CBase_IoEnzoWriter(),
     num_files_(num_files),
     ordering_(ordering),
-    monitor_iter_(monitor_iter)
+    file_(nullptr),
+    monitor_iter_(monitor_iter),
+    layout_(layout),
+    file_filter_(file_filter),
+    num_blocks_file_(0),
+    num_rows_(0),
+    row_buffer_(0),
+    field_buffer_(),
+    field_name_(),
+    field_type_(),
+    field_size_()
 {
   TRACE_CHECK("[4] IoEnzoWriter::IoEnzoWriter()");
 }
@@ -173,13 +203,110 @@ void EnzoBlock::p_check_write_first
   const int index_file = create_msg_check_
     (&msg_check,num_files,ordering,name_dir,&is_first);
 
-  if (is_first) {
+  if (enzo::config()->method_check_async) {
+    // Continue once the block's data is copied, rather than after it
+    // is written
+    if (enzo::simulation()->check_stage(msg_check,index_file,index())) {
+      compute_done();
+    }
+  } else if (is_first) {
     proxy_io_enzo_writer[index_file].p_write (msg_check);
   }
 }
 
 //----------------------------------------------------------------------
 
+bool EnzoSimulation::check_stage
+(EnzoMsgCheck * msg_check, int index_file, Index index)
+{
+  // Give the message its own copies of the Block's field and particle
+  // data, and of the file metadata, so that the Block can continue
+  // before the message is sent and written.  The message is sent
+  // once as is, so it is packed from these copies rather than from an
+  // earlier packed buffer
+
+  DataMsg * data_msg = msg_check->data_msg_;
+  if (data_msg && data_msg->field_data()) {
+    data_msg->set_field_data
+      (new FieldData(*data_msg->field_data()),true);
+  }
+  if (data_msg && data_msg->particle_data()) {
+    data_msg->set_particle_data
+      (new ParticleData(*data_msg->particle_data()),true);
+  }
+  IoEnzoWriter::save_hierarchy_meta(msg_check->hierarchy_meta_);
+  msg_check->set_pe_send(CkMyPe());
+
+  const long long bytes = msg_check->data_size();
+  const long long index_block = msg_check->index_block_;
+
+  check_staged_.push_back(std::pair<int,EnzoMsgCheck *>
+                          (index_file,msg_check));
+  check_bytes_[index_block] = bytes;
+  check_staged_bytes_ += bytes;
+
+  check_send_();
+
+  // Block waits if staging memory exceeds Method:check:async_memory
+
+  const long long limit =
+    1024ll*1024ll*enzo::config()->method_check_async_memory;
+  if (limit > 0 && check_staged_bytes_ > limit) {
+    check_blocked_.push_back(index);
+    return false;
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSimulation::check_send_()
+{
+  // Limit messages in flight from this process, so that staged data
+  // stays here until the writer is ready for it
+  int i = 0;
+  const int n = check_staged_.size();
+  for (; i<n && check_in_flight_ < CHECK_ASYNC_WINDOW; i++) {
+    const int index_file = check_staged_[i].first;
+    proxy_io_enzo_writer[index_file].p_write (check_staged_[i].second);
+    ++check_in_flight_;
+  }
+  check_staged_.erase(check_staged_.begin(),check_staged_.begin()+i);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSimulation::p_check_written(long long index_block)
+{
+  --check_in_flight_;
+  check_staged_bytes_ -= check_bytes_[index_block];
+  check_bytes_.erase(index_block);
+
+  check_send_();
+
+  // Release waiting blocks once staging memory is available
+
+  const long long limit =
+    1024ll*1024ll*enzo::config()->method_check_async_memory;
+  if (check_staged_bytes_ <= limit) {
+    for (size_t i=0; i<check_blocked_.size(); i++) {
+      enzo::block_array()[check_blocked_[i]].p_check_done();
+    }
+    check_blocked_.clear();
+  }
+}
+
+//----------------------------------------------------------------------
+
+bool EnzoSimulation::check_defer_exit()
+// [ Called on ip=0 only ]
+{
+  if (check_active_) check_exit_pending_ = true;
+  return check_active_;
+}
+
+//----------------------------------------------------------------------
+
 void EnzoBlock::p_check_write_next(int num_files, std::string ordering)
 {
   TRACE_CHECK_BLOCK("[9] EnzoBlock::p_check_write_next",this);
@@ -206,6 +333,14 @@ void IoEnzoWriter::p_write (EnzoMsgCheck * msg_check)
     (index_this,index_next,name_this,name_next,
      index_block,is_first,is_last,name_dir);
 
+  const bool is_async = enzo::config()->method_check_async;
+  if (is_async) {
+    // Blocks arrive in any order, so the file is opened by the first
+    // to arrive and closed by the last
+    is_first = (num_rows_ == 0);
+    is_last  = (num_rows_ + 1 == msg_check->num_blocks_file());
+  }
+
   if (thisIndex == 0 && monitor_iter_ &&
       ((is_first || is_last) || ((index_block % monitor_iter_) == 0))) {
     cello::monitor()->print("Method", "check %d",index_block);
@@ -230,7 +365,10 @@ void IoEnzoWriter::p_write (EnzoMsgCheck * msg_check)
     file_ = file_open_(name_dir,name_file);
 
     // Write HDF5 header meta data
-    file_write_hierarchy_();
+    file_write_hierarchy_(msg_check);
+
+    num_blocks_file_ = msg_check->num_blocks_file();
+    row_buffer_ = 0;
   }
 
   // Write block list
@@ -238,16 +376,37 @@ void IoEnzoWriter::p_write (EnzoMsgCheck * msg_check)
 
   // Write Block to HDF5
   file_write_block_(msg_check);
+  ++num_rows_;
+
+  if (layout_ == "aggregate") {
+    const int nf = field_buffer_.size();
+    if (num_rows_ == 1) aggregate_create_fields_();
+    long long bytes = 0;
+    for (int i_f=0; i_f<nf; i_f++) bytes += field_buffer_[i_f].size();
+    if (is_last || bytes >= CHECK_AGGREGATE_BYTES) {
+      aggregate_write_fields_();
+    }
+  }
 
   if (is_last) {
+    ASSERT2 ("IoEnzoWriter::p_write()",
+             "Wrote %d blocks but expected %d",
+             num_rows_,num_blocks_file_,
+             (num_rows_ == num_blocks_file_));
     // close block list
     close_block_list_();
     // close HDF5 file
     file_->file_close();
+    num_rows_ = 0;
   }
 
   TRACE_CHECK("[A] IoEnzoWriter::p_write_first");
-  if (!is_last) {
+  if (is_async) {
+    // Release the staged message's memory on its process
+    proxy_enzo_simulation[msg_check->pe_send()].p_check_written(index_block);
+    delete msg_check;
+    if (is_last) proxy_enzo_simulation[0].p_check_done();
+  } else if (!is_last) {
     enzo::block_array()[index_next].p_check_write_next(num_files_, ordering_);
   } else {
     proxy_enzo_simulation[0].p_check_done();
@@ -287,7 +446,20 @@ void EnzoSimulation::p_check_done()
 {
   TRACE_CHECK("[B] EnzoSimulation::p_check_done");
   if (sync_check_done_.next()) {
-    enzo::block_array().p_check_done();
+    if (check_active_) {
+      // [Method:check:async] Blocks have already continued
+      check_active_ = false;
+      cello::monitor()->print("Method", "check done");
+      if (check_pending_) {
+        check_pending_ = false;
+        check_start_();
+      } else if (check_exit_pending_) {
+        check_exit_pending_ = false;
+        proxy_main.p_exit(1);
+      }
+    } else {
+      enzo::block_array().p_check_done();
+    }
   }
 }
 
@@ -340,6 +512,12 @@ int EnzoBlock::create_msg_check_
   index_block    = *scalar_data_long_long->value(scalar_descr_long_long,is_index);
   index_file = index_block*num_files/count;
 
+  // Number of blocks in the file: block ib is in file ib*nf/nb, so
+  // file f begins with block ceil(f*nb/nf)
+  const int num_blocks_file =
+    ((index_file+1)*count + num_files - 1)/num_files -
+    ((index_file  )*count + num_files - 1)/num_files;
+
   const long long ib  = index_block;
   const long long ibm = index_block - 1;
   const long long ibp = index_block + 1;
@@ -358,6 +536,8 @@ int EnzoBlock::create_msg_check_
 
   (*msg_check)->set_name_dir (name_dir);
 
+  (*msg_check)->set_num_blocks_file (num_blocks_file);
+
   (*msg_check)->set_adapt(adapt_);
   
   DataMsg * data_msg = create_data_msg_();
@@ -401,40 +581,69 @@ FileHdf5 * IoEnzoWriter::file_open_
 
 //----------------------------------------------------------------------
 
-void IoEnzoWriter::file_write_hierarchy_()
+void IoEnzoWriter::save_hierarchy_meta (std::vector<char> & meta)
 {
-  IoSimulation io_simulation = (cello::simulation());
+  // Save each Simulation and Hierarchy metadata item as
+  // [ name length | type | nx | ny | nz | name | values ]
 
-  for (size_t i=0; i<io_simulation.meta_count(); i++) {
+  IoSimulation io_simulation (cello::simulation());
+  IoHierarchy  io_hierarchy  (cello::hierarchy());
+  Io * io_list[2] = { &io_simulation, &io_hierarchy };
 
-    void * buffer;
-    std::string name;
-    int type_scalar;
-    int nx,ny,nz;
+  meta.clear();
+  for (Io * io : io_list) {
+    for (size_t i=0; i<io->meta_count(); i++) {
 
-    // Get object's ith metadata
-    io_simulation.meta_value(i,& buffer, &name, &type_scalar, &nx,&ny,&nz);
+      void * buffer;
+      std::string name;
+      int type_scalar;
+      int nx,ny,nz;
 
-    // Write object's ith metadata
-    file_->file_write_meta(buffer,name.c_str(),type_scalar,nx,ny,nz);
+      // Get object's ith metadata
+      io->meta_value(i,& buffer, &name, &type_scalar, &nx,&ny,&nz);
+
+      const int item[5] = { int(name.size()), type_scalar, nx, ny, nz };
+      const int bytes = cello::type_bytes[type_scalar]*
+        nx*std::max(ny,1)*std::max(nz,1);
+
+      const char * pc_item = (const char *) item;
+      meta.insert(meta.end(), pc_item, pc_item + sizeof(item));
+      meta.insert(meta.end(), name.begin(), name.end());
+      meta.insert(meta.end(), (char *) buffer, (char *) buffer + bytes);
+    }
   }
+}
 
-  io_simulation.save_to(cello::simulation());
+//----------------------------------------------------------------------
 
-  IoHierarchy io_hierarchy = (cello::hierarchy());
+void IoEnzoWriter::file_write_hierarchy_(EnzoMsgCheck * msg_check)
+{
+  // [Method:check:async] use the metadata saved when the message was
+  // staged, since the simulation may have continued since then
 
-  for (size_t i=0; i<io_hierarchy.meta_count(); i++) {
+  std::vector<char> meta = msg_check->hierarchy_meta();
+  if (meta.empty()) save_hierarchy_meta(meta);
 
-    void * buffer;
-    std::string name;
-    int type_scalar;
-    int nx,ny,nz;
+  const char * pc = meta.data();
+  const char * pc_end = pc + meta.size();
+  while (pc < pc_end) {
 
-    // Get object's ith metadata
-    io_hierarchy.meta_value(i,& buffer, &name, &type_scalar, &nx,&ny,&nz);
+    int item[5];
+    std::copy_n (pc, sizeof(item), (char *) item);
+    pc += sizeof(item);
+
+    const std::string name (pc, item[0]);
+    pc += item[0];
+
+    const int type_scalar = item[1];
+    const int nx = item[2];
+    const int ny = item[3];
+    const int nz = item[4];
 
     // Write object's ith metadata
-    file_->file_write_meta(buffer,name.c_str(),type_scalar,nx,ny,nz);
+    file_->file_write_meta((void *) pc,name.c_str(),type_scalar,nx,ny,nz);
+
+    pc += cello::type_bytes[type_scalar]*nx*std::max(ny,1)*std::max(nz,1);
   }
 }
 
@@ -504,45 +713,15 @@ void IoEnzoWriter::file_write_block_ (EnzoMsgCheck * msg_check)
 
   // Write Block Field data
 
-  // number of "history" field data objects
-  const int nh = data->num_field_data();
-  const int nf = cello::field_descr()->field_count();
-  // // May have multiple field_data objects for field history
-  if (nh > 0) {
-    for (int i_h=0; i_h<nh; i_h++) {
-      FieldData * field_data = data->field_data(i_h);
-      for (int i_f=0; i_f<nf; i_f++) {
-        const int index_field = i_f;
-;
-        IoFieldData * io_field_data = enzo::factory()->create_io_field_data();
-
-        void * buffer;
-        std::string name;
-        int type;
-        int mx,my,mz;  // Array dimension
-        int nx,ny,nz;  // Array size
-
-        io_field_data->set_field_data((FieldData*)field_data);
-        io_field_data->set_field_index(index_field);
-
-        io_field_data->field_array
-          (&buffer, &name, &type, &mx,&my,&mz, &nx,&ny,&nz);
-
-        file_->mem_create(nx,ny,nz,nx,ny,nz,0,0,0);
-        if (mz > 1) {
-          file_->data_create(name.c_str(),type,mz,my,mx,1,nz,ny,nx,1);
-        } else if (my > 1) {
-          file_->data_create(name.c_str(),type,my,mx,  1,1,ny,nx, 1,1);
-        } else {
-          file_->data_create(name.c_str(),type,mx,  1,  1,1,nx,  1,1,1);
-        }
-        file_->data_write(buffer);
-        file_->data_close();
-
-        delete io_field_data;
-      }
-    }
+  if (layout_ == "aggregate") {
+    // Block's row in the file's aggregated field datasets
+    int field_offset = num_rows_;
+    file_->group_write_meta(&field_offset,"field_offset",type_int,1);
+    aggregate_buffer_fields_(data);
+  } else {
+    file_write_block_fields_(data);
   }
+
   // // Write Block Particle data
 
   Particle particle = data->particle();
@@ -569,6 +748,7 @@ void IoEnzoWriter::file_write_block_ (EnzoMsgCheck * msg_check)
       const int type = particle.attribute_type(it,ia);
 
       // create the disk array
+      file_filter_.apply(file_);
       file_->data_create(name.c_str(),type,np,1,1,1,np,1,1,1);
 
       // running count of particles in the type
@@ -619,6 +799,148 @@ void IoEnzoWriter::file_write_block_ (EnzoMsgCheck * msg_check)
 
 //----------------------------------------------------------------------
 
+void IoEnzoWriter::file_write_block_fields_ (Data * data)
+{
+  // number of "history" field data objects
+  const int nh = data->num_field_data();
+  const int nf = cello::field_descr()->field_count();
+  // // May have multiple field_data objects for field history
+  if (nh > 0) {
+    for (int i_h=0; i_h<nh; i_h++) {
+      FieldData * field_data = data->field_data(i_h);
+      for (int i_f=0; i_f<nf; i_f++) {
+        const int index_field = i_f;
+        IoFieldData * io_field_data = enzo::factory()->create_io_field_data();
+
+        void * buffer;
+        std::string name;
+        int type;
+        int mx,my,mz;  // Array dimension
+        int nx,ny,nz;  // Array size
+
+        io_field_data->set_field_data((FieldData*)field_data);
+        io_field_data->set_field_index(index_field);
+
+        io_field_data->field_array
+          (&buffer, &name, &type, &mx,&my,&mz, &nx,&ny,&nz);
+
+        file_filter_.apply_field
+          (file_,cello::field_descr()->field_name(index_field));
+
+        file_->mem_create(nx,ny,nz,nx,ny,nz,0,0,0);
+        if (mz > 1) {
+          file_->data_create(name.c_str(),type,mz,my,mx,1,nz,ny,nx,1);
+        } else if (my > 1) {
+          file_->data_create(name.c_str(),type,my,mx,  1,1,ny,nx, 1,1);
+        } else {
+          file_->data_create(name.c_str(),type,mx,  1,  1,1,nx,  1,1,1);
+        }
+        file_->data_write(buffer);
+        file_->data_close();
+
+        delete io_field_data;
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoWriter::aggregate_buffer_fields_ (Data * data)
+{
+  // Append the block's fields to field_buffer_, one row per block
+
+  FieldData * field_data = data->field_data();
+  const int nf = cello::field_descr()->field_count();
+
+  const bool is_first_row = (num_rows_ == 0);
+  if (is_first_row) {
+    field_buffer_.resize(nf);
+    field_name_.resize(nf);
+    field_type_.resize(nf);
+    field_size_.resize(nf);
+  }
+
+  for (int i_f=0; i_f<nf; i_f++) {
+
+    IoFieldData * io_field_data = enzo::factory()->create_io_field_data();
+
+    void * buffer;
+    std::string name;
+    int type;
+    int mx,my,mz;  // Array dimension
+    int nx,ny,nz;  // Array size
+
+    io_field_data->set_field_data((FieldData*)field_data);
+    io_field_data->set_field_index(i_f);
+
+    io_field_data->field_array
+      (&buffer, &name, &type, &mx,&my,&mz, &nx,&ny,&nz);
+
+    const int size = nx*ny*nz;
+    if (is_first_row) {
+      field_name_[i_f] = name;
+      field_type_[i_f] = type;
+      field_size_[i_f] = size;
+    }
+
+    ASSERT3 ("IoEnzoWriter::aggregate_buffer_fields_()",
+             "Field %s size %d differs from size %d of first block",
+             name.c_str(),size,field_size_[i_f],
+             (size == field_size_[i_f]));
+
+    const int bytes = size*cello::type_bytes[type];
+    std::vector<char> & row = field_buffer_[i_f];
+    const char * values = (const char *)buffer;
+    row.insert(row.end(), values, values + bytes);
+
+    delete io_field_data;
+  }
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoWriter::aggregate_create_fields_ ()
+{
+  // Create one dataset per field in the file's root group, with a row
+  // for each block in the file
+
+  const int nf = field_name_.size();
+  for (int i_f=0; i_f<nf; i_f++) {
+    file_filter_.apply_field(file_,cello::field_descr()->field_name(i_f));
+    file_->data_create(field_name_[i_f].c_str(),field_type_[i_f],
+                       num_blocks_file_,field_size_[i_f],1,1);
+    file_->data_close();
+  }
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoWriter::aggregate_write_fields_ ()
+{
+  // Write all buffered rows of each field with a single write
+
+  const int nr = num_rows_ - row_buffer_;
+  const int nf = field_name_.size();
+  if (nr == 0) return;
+
+  for (int i_f=0; i_f<nf; i_f++) {
+    const int m = field_size_[i_f];
+    int type;
+    file_->data_open(field_name_[i_f],&type);
+    file_->data_slice
+      (num_blocks_file_,m,1,1, nr,m,1,1, row_buffer_,0,0,0);
+    file_->mem_create(nr,m,1,nr,m,1,0,0,0);
+    file_->data_write(field_buffer_[i_f].data());
+    file_->mem_close();
+    file_->data_close();
+    field_buffer_[i_f].clear();
+  }
+  row_buffer_ = num_rows_;
+}
+
+//----------------------------------------------------------------------
+
 DataMsg * EnzoBlock::create_data_msg_ ()
 {
   int if3[3] = {0,0,0};
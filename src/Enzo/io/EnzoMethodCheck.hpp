@@ -20,7 +20,9 @@ public: // interface
   EnzoMethodCheck
   (int num_files, std::string ordering,
    std::vector<std::string> directory,
-   int monitor_iter);
+   int monitor_iter,
+   std::string layout,
+   FileFilter file_filter);
 
   /// Charm++ PUP::able declarations
   PUPable_decl(EnzoMethodCheck);
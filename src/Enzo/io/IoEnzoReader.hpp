@@ -34,11 +34,19 @@ public: // interface
     //    p | file_;
     p | sync_blocks_;
     //    p | io_msg_check_;
+    p | io_block_name_;
+    p | io_field_offset_;
+    p | layout_;
+    //    p | aggregate_rows_;
+    p | read_level_;
+    p | read_index_;
+    p | time_read_;
   }
 
   /// Send data to existing root blocks
   void p_init_root
-  (std::string name_dir, std::string name_file, int max_level);
+  (std::string name_dir, std::string name_file, int max_level,
+   std::string layout);
 
   /// Create blocks in the given level
   void p_create_level(int level);
@@ -50,6 +58,9 @@ public: // interface
   /// Initialize existing blocks in the given level
   void p_init_level(int level);
 
+  /// Read data for the next few refined blocks ahead of p_init_level()
+  void p_read_ahead();
+
   /// Received acknowledgement that the block is done
   void p_block_ready();
 
@@ -60,8 +71,18 @@ protected: // functions
   void block_created_();
 
   void file_open_block_list_(std::string name_dir, std::string name_file);
-  void file_read_block_(EnzoMsgCheck * msg_check, std::string file_name,
-                        IoEnzoBlock * io_block);
+  /// Read the block's attributes; return the block's row in
+  /// aggregated field datasets, or -1 for the "block" layout
+  int file_read_block_meta_(EnzoMsgCheck * msg_check, std::string file_name,
+                            IoEnzoBlock * io_block);
+  void file_read_block_data_(EnzoMsgCheck * msg_check, std::string file_name,
+                             int field_offset);
+
+  /// Read data for the next unread refined block; return false if
+  /// there are none left
+  bool read_next_block_();
+  /// Read data for any unread refined blocks up to the given level
+  void read_through_level_(int level);
   bool read_block_list_(std::string & block_name, int & level);
   void file_close_block_list_();
 
@@ -72,6 +93,15 @@ protected: // functions
   (char * buffer, int type_data,
    int nx, int ny, int nz,
    int m4[4]);
+  /// Read rows of aggregated field datasets for blocks starting at
+  /// io_msg_check_[level][index], unless the block's row is already
+  /// read.  Rows are read for following blocks in the level until
+  /// CHECK_AGGREGATE_BYTES are read.
+  void file_read_aggregate_rows_(int level, int index);
+  /// Copy the block's row of the aggregated dataset for field i_f,
+  /// which must have been read by file_read_aggregate_rows_()
+  void file_read_aggregate_dataset_
+  (char * buffer, int i_f, int size, int field_offset);
 
   template <class T>
   void copy_buffer_to_particle_attribute_
@@ -105,6 +135,29 @@ private: // attributes
 
   /// Count of blocks in each level_
   std::vector<int> blocks_in_level_;
+
+  /// Block names corresponding to io_msg_check_
+  std::vector< std::vector<std::string> > io_block_name_;
+
+  /// Rows in aggregated field datasets corresponding to io_msg_check_
+  std::vector< std::vector<int> > io_field_offset_;
+
+  /// Field layout of the checkpoint, "block" or "aggregate"
+  std::string layout_;
+
+  /// Rows of each aggregated field dataset last read, in the order of
+  /// aggregate_row_list_, and the row size in bytes of each field
+  std::vector< std::vector<char> > aggregate_rows_;
+  std::vector<int> aggregate_row_list_;
+  std::vector<int> aggregate_row_bytes_;
+
+  /// Level and index in io_msg_check_ of the next refined block whose
+  /// data has not been read
+  int read_level_;
+  int read_index_;
+
+  /// Time spent reading block data from the file
+  double time_read_;
 };
 
 #endif /* ENZO_IO_ENZO_READER_HPP */
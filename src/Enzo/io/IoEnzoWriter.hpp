@@ -7,6 +7,15 @@
 
 #ifndef ENZO_IO_ENZO_WRITER_HPP
 #define ENZO_IO_ENZO_WRITER_HPP
+
+/// Maximum bytes of field data buffered by IoEnzoWriter between writes
+/// to aggregated field datasets, and read at once by IoEnzoReader
+#define CHECK_AGGREGATE_BYTES (64*1024*1024)
+
+/// Maximum number of asynchronous checkpoint messages sent from a
+/// process that have not yet been written
+#define CHECK_ASYNC_WINDOW 2
+
 class IoEnzoWriter : public CBase_IoEnzoWriter {
 
   /// @class    IoEnzoWriter
@@ -22,13 +31,24 @@ public: // interface
     ordering_(""),
     stream_block_list_(),
     file_(nullptr),
-    monitor_iter_(0)
+    monitor_iter_(0),
+    layout_("block"),
+    file_filter_(),
+    num_blocks_file_(0),
+    num_rows_(0),
+    row_buffer_(0),
+    field_buffer_(),
+    field_name_(),
+    field_type_(),
+    field_size_()
   {  }
 
   /// Constructor
   IoEnzoWriter(int num_files,
                std::string ordering,
-               int monitor_iter) throw();
+               int monitor_iter,
+               std::string layout,
+               FileFilter file_filter) throw();
 
   /// CHARM++ migration constructor
   IoEnzoWriter(CkMigrateMessage *m) : CBase_IoEnzoWriter(m) {}
@@ -41,20 +61,32 @@ public: // interface
     p | num_files_;
     p | ordering_;
     p | monitor_iter_;
+    p | layout_;
+    p | file_filter_;
   }
 
 public: // entry methods
 
   void p_write(EnzoMsgCheck *);
 
+public: // static functions
+
+  /// Save the current Simulation and Hierarchy metadata written to
+  /// the header of each checkpoint file
+  static void save_hierarchy_meta (std::vector<char> & meta);
+
   // void r_created(CkReductionMsg *msg);
 
 protected: // functions
 
   FileHdf5 * file_open_(std::string name_dir, std::string name_file);
   std::ofstream create_block_list_(std::string name_dir, std::string name_file);
-  void file_write_hierarchy_();
+  void file_write_hierarchy_(EnzoMsgCheck * msg_check);
   void file_write_block_(EnzoMsgCheck * msg_check);
+  void file_write_block_fields_(Data * data);
+  void aggregate_buffer_fields_(Data * data);
+  void aggregate_create_fields_();
+  void aggregate_write_fields_();
   void write_meta_ ( FileHdf5 * file, Io * io, std::string type_meta );
 
   void write_block_list_(std::string block_name, int level);
@@ -77,6 +109,31 @@ protected: // attributes
   /// How often to output write status wrt block indices in first
   /// file; 0 for no output
   int monitor_iter_;
+
+  /// Field layout: "block" for one dataset per field per block, or
+  /// "aggregate" for one dataset per field per file, with one row per
+  /// block
+  std::string layout_;
+
+  /// Compression filters for field and particle datasets
+  FileFilter file_filter_;
+
+  /// [aggregate] Number of blocks (rows) in the current file
+  int num_blocks_file_;
+
+  /// Number of blocks written to the current file so far
+  int num_rows_;
+
+  /// [aggregate] First row held in field_buffer_
+  int row_buffer_;
+
+  /// [aggregate] Rows not yet written for each field
+  std::vector< std::vector<char> > field_buffer_;
+
+  /// [aggregate] Dataset name, scalar type, and row length of each field
+  std::vector<std::string> field_name_;
+  std::vector<int> field_type_;
+  std::vector<int> field_size_;
 };
 
 #endif /* ENZO_IO_ENZO_WRITER_HPP */
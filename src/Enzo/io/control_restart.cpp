@@ -107,6 +107,8 @@ void Simulation::p_restart_enter (std::string name_dir)
 
   restart_directory_ = name_dir;
 
+  restart_time_begin_ = restart_time_phase_ = timer();
+
   // Open and read the checkpoint file_list file
   restart_stream_file_list_ = file_open_file_list_(restart_directory_);
   restart_stream_file_list_ >> restart_num_files_;
@@ -140,7 +142,16 @@ IoEnzoReader::IoEnzoReader()
     level_(0),
     block_name_list_(),
     block_level_list_(),
-    blocks_in_level_()
+    blocks_in_level_(),
+    io_block_name_(),
+    io_field_offset_(),
+    layout_("block"),
+    aggregate_rows_(),
+    aggregate_row_list_(),
+    aggregate_row_bytes_(),
+    read_level_(1),
+    read_index_(0),
+    time_read_(0.0)
 {
   
   proxy_enzo_simulation.p_io_reader_created();
@@ -178,14 +189,23 @@ void Simulation::r_restart_start (CkReductionMsg * msg)
   delete msg;
   // [ Called on root process only ]
 
+  restart_monitor_phase_("create readers",-1);
+
   // Insert an IoEnzoReader element for each file
   const int max_level = cello::config()->mesh_max_level;
+  std::vector<std::string> restart_files(restart_num_files_);
+  for (int i=0; i<restart_num_files_; i++) {
+    restart_stream_file_list_ >> restart_files[i];
+  }
+  // field layout follows the file names; checkpoints without it use
+  // the "block" layout
+  std::string layout;
+  if (! (restart_stream_file_list_ >> layout)) layout = "block";
+
   for (int i=0; i<restart_num_files_; i++) {
-    std::string restart_file;
-    restart_stream_file_list_ >> restart_file;
     // Create ith io_reader to read name_file
     proxy_io_enzo_reader[i].p_init_root
-      (restart_directory_,restart_file,max_level);
+      (restart_directory_,restart_files[i],max_level,layout);
   }
 }
 
@@ -194,13 +214,15 @@ void Simulation::r_restart_start (CkReductionMsg * msg)
 //----------------------------------------------------------------------
 
 void IoEnzoReader::p_init_root
-(std::string name_dir, std::string name_file, int max_level)
+(std::string name_dir, std::string name_file, int max_level,
+ std::string layout)
 {
   TRACE_READER("p_init_root()",this);
   // save initialization parameters
   name_dir_  = name_dir;
   name_file_ = name_file;
   max_level_ = max_level;
+  layout_    = layout;
 
   io_msg_check_.resize(max_level+1);
 
@@ -231,16 +253,19 @@ void IoEnzoReader::p_init_root
       // (including negative level blocks)
       ++ sync_blocks_;
       TRACE_SYNC(sync_blocks_,"sync_blocks_ inc_stop(1)");
-    } else {
-      // count blocks per refined level for array allocation below
-      ++blocks_in_level_[block_level];
     }
+    // count blocks per level for array allocation below
+    ++blocks_in_level_[std::max(block_level,0)];
   }
 
   // Allocate io_msg_check_ array
   io_msg_check_.resize(max_level+1);
-  for (int level=1; level<=max_level; level++) {
+  io_block_name_.resize(max_level+1);
+  io_field_offset_.resize(max_level+1);
+  for (int level=0; level<=max_level; level++) {
     io_msg_check_[level].resize(blocks_in_level_[level]);
+    io_block_name_[level].resize(blocks_in_level_[level]);
+    io_field_offset_[level].resize(blocks_in_level_[level]);
   }
 
   // initialize vector of array offsets into io_msg_check_ for each level
@@ -248,32 +273,37 @@ void IoEnzoReader::p_init_root
   level_index.resize(max_level+1);
   std::fill(level_index.begin(), level_index.end(), 0);
 
-  // Save block's meta-data and initialize root-level blocks
+  // Save block's meta-data.  Field and particle data are read below
+  // for root-level blocks, and by p_read_ahead() for refined blocks
+  // while coarser levels are being created and initialized
   for (int i=0; i<block_name_list_.size(); i++) {
 
-    // Increment block counter so know when to alert pe=0 when done
-    const int block_level = block_level_list_[i];
-    std::string block_name = block_name_list_[i];
-    int i_level = level_index[std::max(block_level,0)]++;
-
-    // For each Block in the file, read the block data and create the
-    // new Block
+    const int level = std::max(block_level_list_[i],0);
+    const int i_level = level_index[level]++;
 
     EnzoMsgCheck * msg_check = new EnzoMsgCheck;
-
-    // Save msg_check for later if block is in a refined level
-    if (block_level > 0) {
-      io_msg_check_[block_level][i_level] = msg_check;
-    }
-
-    // create new IoEnzoBlock object for root blocks, use io_msg_check_
-    // element for refined blocks
     IoEnzoBlock * io_enzo_block = new IoEnzoBlock;
 
-    file_read_block_ (msg_check, block_name, io_enzo_block);
+    io_msg_check_[level][i_level] = msg_check;
+    io_block_name_[level][i_level] = block_name_list_[i];
+    io_field_offset_[level][i_level] =
+      file_read_block_meta_ (msg_check, block_name_list_[i], io_enzo_block);
 
     // save this file IoReader index
     msg_check->index_file_ = thisIndex;
+  }
+
+  // Read root-level blocks and send their data
+  for (int i=0; i<blocks_in_level_[0]; i++) {
+
+    EnzoMsgCheck * msg_check = io_msg_check_[0][i];
+
+    Timer timer;
+    timer.start();
+    file_read_aggregate_rows_ (0,i);
+    file_read_block_data_ (msg_check,io_block_name_[0][i],
+                           io_field_offset_[0][i]);
+    time_read_ += timer.stop();
 
     // get Block's index
     int v3[3];
@@ -281,21 +311,17 @@ void IoEnzoReader::p_init_root
     Index index;
     index.set_values(v3);
 
-    // if non-refined block, initialize
-    if (block_level <= 0) {
-
-      // Block exists--send its data
+    // Block exists--send its data
 #ifdef DEBUG_RESTART
-      msg_check->print("send");
-      msg_check->data_msg_->print("send");
+    msg_check->print("send");
+    msg_check->data_msg_->print("send");
 #endif
-      enzo::block_array()[index].p_restart_set_data(msg_check);
-
-    }
+    enzo::block_array()[index].p_restart_set_data(msg_check);
   }
 
-  // close the HDF5 file
-  file_close_block_list_();
+  // start reading refined block data; the HDF5 file is closed once
+  // all blocks are read
+  thisProxy[thisIndex].p_read_ahead();
 
   // self + 1
   ++ sync_blocks_;
@@ -337,22 +363,88 @@ void IoEnzoReader::block_ready_()
   // Wait for all of the reader's blocks in the current level to be
   // ready
   if (sync_blocks_.next()) {
-    proxy_enzo_simulation[0].p_restart_next_level();
+    proxy_enzo_simulation[0].p_restart_next_level(time_read_);
+  }
+}
+
+//----------------------------------------------------------------------
+// READ-AHEAD
+//----------------------------------------------------------------------
+
+void IoEnzoReader::p_read_ahead()
+{
+  TRACE_READER("p_read_ahead()",this);
+  // Number of blocks read per call, so that block creation and
+  // synchronization messages for this PE are not delayed for long
+  const int num_blocks_read = 4;
+  for (int i=0; i<num_blocks_read; i++) {
+    if (! read_next_block_()) return;
+  }
+  thisProxy[thisIndex].p_read_ahead();
+}
+
+//----------------------------------------------------------------------
+
+bool IoEnzoReader::read_next_block_()
+{
+  // skip to next level with unread blocks
+  while (read_level_ <= max_level_ &&
+         read_index_ >= int(io_msg_check_[read_level_].size())) {
+    ++read_level_;
+    read_index_ = 0;
+  }
+  if (read_level_ > max_level_) {
+    // all blocks are read
+    if (file_ != nullptr) {
+      file_close_block_list_();
+      file_ = nullptr;
+    }
+    return false;
+  }
+
+  Timer timer;
+  timer.start();
+  file_read_aggregate_rows_ (read_level_,read_index_);
+  file_read_block_data_ (io_msg_check_[read_level_][read_index_],
+                         io_block_name_[read_level_][read_index_],
+                         io_field_offset_[read_level_][read_index_]);
+  time_read_ += timer.stop();
+
+  ++read_index_;
+  return true;
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoReader::read_through_level_(int level)
+{
+  while (read_level_ < level ||
+         (read_level_ == level &&
+          read_index_ < int(io_msg_check_[level].size()))) {
+    read_next_block_();
   }
 }
 
 //----------------------------------------------------------------------
 
-void EnzoSimulation::p_restart_next_level()
+void EnzoSimulation::p_restart_next_level(double time_read)
 {
   // [ Called on root process only ]
   TRACE_SIMULATION("EnzoSimulation::p_restart_next_level()",this);
   TRACE_SYNC(sync_restart_next_,"sync_restart_next_ next()");
+  restart_time_read_ = std::max(restart_time_read_,time_read);
   if (sync_restart_next_.next()) {
+    restart_monitor_phase_
+      ((restart_level_ == 0) ? "read root" : "init level",restart_level_);
     const int max_level = cello::config()->mesh_max_level;
     if (++restart_level_ <= max_level) {
       proxy_io_enzo_reader.p_create_level(restart_level_);
     } else {
+      cello::monitor()->print
+        ("Restart","time-read-max %.3f s",restart_time_read_);
+      cello::monitor()->print
+        ("Restart","time-total %.3f s",
+         timer() - restart_time_begin_);
       enzo::block_array().doneInserting();
       enzo::block_array().p_restart_done();
     }
@@ -468,6 +560,7 @@ void EnzoSimulation::p_restart_level_created()
   TRACE_SIMULATION("EnzoSimulation::p_restart_level_created()",this);
   TRACE_SYNC(sync_restart_created_,"sync_restart_created_ next()");
   if (sync_restart_created_.next()) {
+    restart_monitor_phase_("create level",restart_level_);
     proxy_io_enzo_reader.p_init_level(restart_level_);
   }
 }
@@ -482,6 +575,10 @@ void IoEnzoReader::p_init_level (int level)
   sync_blocks_.reset();
   TRACE_SYNC(sync_blocks_,"sync_blocks_ set_stop()");
   sync_blocks_.set_stop(num_blocks_level+1);
+
+  // Finish reading any blocks not yet read by p_read_ahead()
+  read_through_level_(level);
+
   // Loop through blocks in the given level
   for (int i=0; i<num_blocks_level; i++) {
 
@@ -515,6 +612,23 @@ void EnzoBlock::p_restart_done()
 
 //======================================================================
 
+void Simulation::restart_monitor_phase_(std::string phase, int level)
+{
+  const float time = timer();
+  if (level >= 0) {
+    cello::monitor()->print
+      ("Restart","%s %d time %.3f s",
+       phase.c_str(),level,time - restart_time_phase_);
+  } else {
+    cello::monitor()->print
+      ("Restart","%s time %.3f s",
+       phase.c_str(),time - restart_time_phase_);
+  }
+  restart_time_phase_ = time;
+}
+
+//----------------------------------------------------------------------
+
 std::ifstream Simulation::file_open_file_list_(std::string name_dir)
 {
   std::string name_file = name_dir + "/check.file_list";
@@ -586,7 +700,7 @@ void IoEnzoReader::file_read_hierarchy_()
 
 //----------------------------------------------------------------------
 
-void IoEnzoReader::file_read_block_
+int IoEnzoReader::file_read_block_meta_
 (EnzoMsgCheck * msg_check,
  std::string    name_block,
  IoEnzoBlock *  io_block)
@@ -605,6 +719,33 @@ void IoEnzoReader::file_read_block_
   file_->group_read_meta
     (msg_check->adapt_buffer_,"adapt_buffer",&type,&size);
 
+  // Read block's row in aggregated field datasets
+  int field_offset = -1;
+  if (layout_ == "aggregate") {
+    file_->group_read_meta (&field_offset,"field_offset",&type,&size);
+  }
+
+  file_->group_close();
+
+  return field_offset;
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoReader::file_read_block_data_
+(EnzoMsgCheck * msg_check,
+ std::string    name_block,
+ int            field_offset)
+{
+  // Open HDF5 group for the block, unless reading fields from
+  // aggregated datasets in the root group first
+  const bool is_aggregate = (field_offset >= 0);
+  std::string group_name = "/" + name_block;
+  if (! is_aggregate) {
+    file_->group_chdir(group_name);
+    file_->group_open();
+  }
+
   DataMsg * data_msg = new DataMsg;
   msg_check->data_msg_ = data_msg;
 
@@ -659,27 +800,32 @@ void IoEnzoReader::file_read_block_
     int index_field = field_descr->field_id(field_name);
 
     const std::string dataset_name = std::string("field_") + field_name;
-    int m4[4];
-    int type_data = type_unknown;
-    file_->data_open (dataset_name, &type_data,
-                      m4,m4+1,m4+2,m4+3);
     int mx,my,mz;
     int gx,gy,gz;
 
     field.dimensions(index_field,&mx,&my,&mz);
     field.ghost_depth(index_field,&gx,&gy,&gz);
 
-    double lower[3];
-    double upper[3];
-    io_block->lower(lower);
-    io_block->upper(upper);
     char * buffer = field.values(field_name);
 
-    file_read_dataset_
-      (buffer, type_data, mx,my,mz,m4);
+    if (is_aggregate) {
+      file_read_aggregate_dataset_
+        (buffer, i_f, mx*my*mz, field_offset);
+    } else {
+      int m4[4];
+      int type_data = type_unknown;
+      file_->data_open (dataset_name, &type_data,
+                        m4,m4+1,m4+2,m4+3);
+      file_read_dataset_
+        (buffer, type_data, mx,my,mz,m4);
+      file_->data_close();
+    }
 
-    file_->data_close();
+  }
 
+  if (is_aggregate) {
+    file_->group_chdir(group_name);
+    file_->group_open();
   }
 
   // Read in particle data
@@ -858,10 +1004,117 @@ void IoEnzoReader::file_read_dataset_
 }
 //----------------------------------------------------------------------
 
+void IoEnzoReader::file_read_aggregate_rows_(int level, int index)
+{
+  const int field_offset = io_field_offset_[level][index];
+
+  // "block" layout, or row already read
+  if (field_offset < 0 ||
+      std::binary_search (aggregate_row_list_.begin(),
+                          aggregate_row_list_.end(), field_offset)) return;
+
+  FieldDescr * field_descr = cello::field_descr();
+  const int num_fields = field_descr->num_permanent();
+
+  // Get the row size of each field dataset when first read
+
+  if (int(aggregate_row_bytes_.size()) < num_fields) {
+    aggregate_rows_.resize(num_fields);
+    aggregate_row_bytes_.resize(num_fields);
+    for (int i_f=0; i_f<num_fields; i_f++) {
+      const std::string dataset_name =
+        std::string("field_") + field_descr->field_name(i_f);
+      int m4[4];
+      int type_data = type_unknown;
+      file_->data_open (dataset_name, &type_data,
+                        m4,m4+1,m4+2,m4+3);
+      aggregate_row_bytes_[i_f] = m4[1]*cello::type_bytes[type_data];
+      file_->data_close();
+    }
+  }
+
+  long long bytes_block = 0;
+  for (int i_f=0; i_f<num_fields; i_f++) {
+    bytes_block += aggregate_row_bytes_[i_f];
+  }
+
+  // Rows of this block and of following blocks in the level, which
+  // are read in that order, up to CHECK_AGGREGATE_BYTES.  Rows of
+  // blocks in a level are not contiguous in the file, since blocks
+  // are written as they arrive, so only these rows are read
+
+  const int num_blocks_level = io_field_offset_[level].size();
+  const int num_rows = std::max
+    (1LL, std::min((long long)(num_blocks_level - index),
+                   CHECK_AGGREGATE_BYTES / std::max(1LL,bytes_block)));
+
+  aggregate_row_list_.assign
+    (io_field_offset_[level].begin() + index,
+     io_field_offset_[level].begin() + index + num_rows);
+  std::sort (aggregate_row_list_.begin(), aggregate_row_list_.end());
+
+  for (int i_f=0; i_f<num_fields; i_f++) {
+
+    const std::string dataset_name =
+      std::string("field_") + field_descr->field_name(i_f);
+
+    int m4[4];
+    int type_data = type_unknown;
+    file_->data_open (dataset_name, &type_data,
+                      m4,m4+1,m4+2,m4+3);
+
+    aggregate_rows_[i_f].resize(num_rows*aggregate_row_bytes_[i_f]);
+
+    file_->data_slice_rows (aggregate_row_list_);
+
+    file_->mem_create (num_rows,m4[1],1,num_rows,m4[1],1,0,0,0);
+
+    file_->data_read (aggregate_rows_[i_f].data());
+
+    file_->mem_close();
+    file_->data_close();
+  }
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoReader::file_read_aggregate_dataset_
+(char * buffer, int i_f, int size, int field_offset)
+{
+  auto it = std::lower_bound (aggregate_row_list_.begin(),
+                              aggregate_row_list_.end(), field_offset);
+
+  ASSERT1 ("IoEnzoReader::file_read_aggregate_dataset_()",
+           "Row %d of aggregated datasets was not read",
+           field_offset,
+           (it != aggregate_row_list_.end() && *it == field_offset));
+
+  const int bytes_row = aggregate_row_bytes_[i_f];
+  const int bytes_field =
+    size*cello::sizeof_precision(cello::field_descr()->precision(i_f));
+
+  ASSERT3 ("IoEnzoReader::file_read_aggregate_dataset_()",
+           "Aggregated dataset row of field %d has %d bytes, expected %d",
+           i_f, bytes_row, bytes_field,
+           (bytes_row == bytes_field));
+
+  const char * row = aggregate_rows_[i_f].data() +
+    (it - aggregate_row_list_.begin())*bytes_row;
+  std::copy_n (row, bytes_row, buffer);
+}
+
+//----------------------------------------------------------------------
+
 void IoEnzoReader::file_close_block_list_()
 {
   file_->data_close();
   file_->file_close();
   delete file_;
+
+  // free rows saved from aggregated field datasets
+  aggregate_rows_.clear();
+  aggregate_rows_.shrink_to_fit();
+  aggregate_row_list_.clear();
+  aggregate_row_bytes_.clear();
 }
 
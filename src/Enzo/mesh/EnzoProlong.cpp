@@ -68,8 +68,10 @@ void EnzoProlong::apply
     // only call EnzoProlong if accumulate = false
     if (!use_linear_) {
       // only call EnzoProlong if not reverting to linear
-      apply_((enzo_float *)     values_f,m3_f,o3_f,n3_f,
-             (const enzo_float*)values_c,m3_c,o3_c,n3_c,accumulate);
+      enzo_float * value_f = (enzo_float *) values_f;
+      const enzo_float * value_c = (const enzo_float *) values_c;
+      apply_(1,&value_f,m3_f,o3_f,n3_f,
+             &value_c,m3_c,o3_c,n3_c);
     }  else {
       static bool first_call = true;
       if (first_call) {
@@ -109,11 +111,45 @@ void EnzoProlong::apply
 }
 //----------------------------------------------------------------------
 
+void EnzoProlong::apply_fields
+( precision_type precision, int num_fields,
+  void * const * values_f, int m3_f[3], int o3_f[3], int n3_f[3],
+  const void * const * values_c, int m3_c[3], int o3_c[3], int n3_c[3],
+  bool accumulate)
+{
+  if (accumulate || use_linear_) {
+    // defer to ProlongLinear through apply()
+    Prolong::apply_fields
+      (precision,num_fields,
+       values_f,m3_f,o3_f,n3_f,
+       values_c,m3_c,o3_c,n3_c,accumulate);
+  } else {
+    apply_(num_fields,
+           (enzo_float * const *)      values_f,m3_f,o3_f,n3_f,
+           (const enzo_float * const *)values_c,m3_c,o3_c,n3_c);
+  }
+}
+
+//----------------------------------------------------------------------
+
+namespace {
+
+  /// Per-thread work array for interpolate(), kept between calls
+  thread_local std::vector<enzo_float> scratch_work;
+
+  enzo_float * scratch_ (std::vector<enzo_float> & scratch, std::size_t n)
+  {
+    if (scratch.size() < n) scratch.resize(n);
+    return scratch.data();
+  }
+}
+
+//----------------------------------------------------------------------
+
 void EnzoProlong::apply_
-( 
- enzo_float * values_f, int m3_f[3], int o3_f[3], int n3_f[3],
- const enzo_float * values_c, int m3_c[3], int o3_c[3], int n3_c[3],
- bool accumulate)
+( int num_fields,
+  enzo_float * const * values_f, int m3_f[3], int o3_f[3], int n3_f[3],
+  const enzo_float * const * values_c, int m3_c[3], int o3_c[3], int n3_c[3])
 {
   int rank = cello::rank();
 
@@ -122,9 +158,6 @@ void EnzoProlong::apply_
   int r3[3] = {2,2,2};
   int gdims[3],gstart[3],pdims[3],pstart[3],pend[3];
 
-  //  enzo_float * grid = new enzo_float[nf];
-  //  DEBUG_FILL_ARRAY("grid",grid,n3_f,n3_f);
-
   for (int i=0; i<rank; i++) {
     pdims[i] = m3_c[i];
     pstart[i] = 2;
@@ -136,27 +169,17 @@ void EnzoProlong::apply_
   int size=gdims[0]/2 + 1;
   if (rank >= 2) size*=gdims[1]/2 + 1;
   if (rank >= 3) size*=gdims[2]/2 + 1;
-  enzo_float * work = new enzo_float[2*size+100];
+  enzo_float * work = scratch_(scratch_work,2*size+100);
 
 #ifdef DEBUG_ENZO_PROLONG
   CkPrintf ("DEBUG_ENZO_PROLONG EnzoProlong\n");
+  CkPrintf ("DEBUG_ENZO_PROLONG num_fields %d\n",num_fields);
   CkPrintf ("DEBUG_ENZO_PROLONG m3_f    %d %d %d\n",m3_f[0],m3_f[1],m3_f[2]);
   CkPrintf ("DEBUG_ENZO_PROLONG n3_f    %d %d %d\n",n3_f[0],n3_f[1],n3_f[2]);
   CkPrintf ("DEBUG_ENZO_PROLONG o3_f    %d %d %d\n",o3_f[0],o3_f[1],o3_f[2]);
   CkPrintf ("DEBUG_ENZO_PROLONG m3_c    %d %d %d\n",m3_c[0],m3_c[1],m3_c[2]);
   CkPrintf ("DEBUG_ENZO_PROLONG n3_c    %d %d %d\n",n3_c[0],n3_c[1],n3_c[2]);
   CkPrintf ("DEBUG_ENZO_PROLONG o3_c    %d %d %d\n",o3_c[0],o3_c[1],o3_c[2]);
-  CkPrintf ("DEBUG_ENZO_PROLONG\n");
-
-  // convert to fortran ordering for interpolate parameters
-  // for (int i=0; i<rank/2; i++) {
-  //   std::swap(pdims[i],pdims[rank-i-1]);
-  //   std::swap(pstart[i],pstart[rank-i-1]);
-  //   std::swap(pend[i],pend[rank-i-1]);
-  //   std::swap(gdims[i],gdims[rank-i-1]);
-  //   std::swap(gstart[i],gstart[rank-i-1]);
-  // }
-  
   CkPrintf ("DEBUG_ENZO_PROLONG pdims   %d %d %d\n",pdims[0],pdims[1],pdims[2]);
   CkPrintf ("DEBUG_ENZO_PROLONG pstart  %d %d %d\n",pstart[0],pstart[1],pstart[2]);
   CkPrintf ("DEBUG_ENZO_PROLONG pend    %d %d %d\n",pend[0],pend[1],pend[2]);
@@ -164,36 +187,20 @@ void EnzoProlong::apply_
   CkPrintf ("DEBUG_ENZO_PROLONG gdims   %d %d %d\n",gdims[0],gdims[1],gdims[2]);
   CkPrintf ("DEBUG_ENZO_PROLONG gstart  %d %d %d\n",gstart[0],gstart[1],gstart[2]);
   CkPrintf ("DEBUG_ENZO_PROLONG rank    %d\n",rank);
-
 #endif
 
-  int o_c = o3_c[0] + m3_c[0]*(o3_c[1] + m3_c[1]*o3_c[2]);
-  int o_f = o3_f[0] + m3_f[0]*(o3_f[1] + m3_f[1]*o3_f[2]);
-
-  const int mf = m3_f[0]*m3_f[1]*m3_f[2];
-  enzo_float * temp_f = (accumulate) ? (new enzo_float [mf]) : values_f;
-
-  FORTRAN_NAME(interpolate)
-    (&rank,
-     ((enzo_float*)(values_c))+o_c, pdims, pstart, pend, r3,
-     ((enzo_float*)(temp_f))+o_f, gdims, gstart, work, &method_,
-     &positive_, &error);
-
-  DEBUG_PRINT_ARRAY0("values_c",values_c,m3_c,n3_c,o3_c);
-  DEBUG_PRINT_ARRAY0("values_f",values_f,m3_f,n3_f,o3_f);
-
-  if (accumulate) {
-    int i0 = o3_f[0] + m3_f[0]*(o3_f[1] + m3_f[1]*o3_f[2]);
-    for (int iz=0; iz<n3_f[2]; iz++) {
-      for (int iy=0; iy<n3_f[1]; iy++) {
-        for (int ix=0; ix<n3_f[0]; ix++) {
-          int i = i0 + ix + m3_f[0]*(iy + m3_f[1]*iz);
-          values_f[i] += temp_f[i];
-        }
-      }
-    }
-    delete [] temp_f;
-  }
+  const int o_c = o3_c[0] + m3_c[0]*(o3_c[1] + m3_c[1]*o3_c[2]);
+  const int o_f = o3_f[0] + m3_f[0]*(o3_f[1] + m3_f[1]*o3_f[2]);
 
-  delete [] work;
+  for (int i_f=0; i_f<num_fields; i_f++) {
+
+    FORTRAN_NAME(interpolate)
+      (&rank,
+       ((enzo_float*)(values_c[i_f]))+o_c, pdims, pstart, pend, r3,
+       values_f[i_f] + o_f, gdims, gstart, work, &method_,
+       &positive_, &error);
+
+    DEBUG_PRINT_ARRAY0("values_c",values_c[i_f],m3_c,n3_c,o3_c);
+    DEBUG_PRINT_ARRAY0("values_f",values_f[i_f],m3_f,n3_f,o3_f);
+  }
 }
@@ -43,6 +43,16 @@ public: // interface
     const void * values_c, int nd3_c[3], int im3_c[3], int n3_c[3],
     bool accumulate = false);
 
+  /// Prolong several fields with the same array sizes and offsets,
+  /// reusing interpolate() parameters and scratch for all fields.
+  /// With accumulate = true each field is still prolonged separately
+  /// by ProlongLinear, as in apply()
+  virtual void apply_fields
+  ( precision_type precision, int num_fields,
+    void * const * values_f, int nd3_f[3], int im3_f[3], int n3_f[3],
+    const void * const * values_c, int nd3_c[3], int im3_c[3], int n3_c[3],
+    bool accumulate = false);
+
   /// Return the name identifying the prolongation operator
   virtual std::string name () const { return "enzo"; }
 
@@ -54,10 +64,12 @@ protected: // protected virtual methods
 
 private: // functions
 
+  /// Interpolate num_fields fields using interpolate() with scratch
+  /// arrays that persist between calls
   void apply_
-  ( enzo_float *  values_f, int nd3_f[3], int im3_f[3], int n3_f[3],
-    const enzo_float * values_c, int nd3_c[3], int im3_c[3], int n3_c[3],
-    bool accumulate = false);
+  ( int num_fields,
+    enzo_float * const * values_f, int nd3_f[3], int im3_f[3], int n3_f[3],
+    const enzo_float * const * values_c, int nd3_c[3], int im3_c[3], int n3_c[3]);
   
 private: // attributes
 
@@ -7,8 +7,6 @@
 
 #include "enzo.hpp"
 
-// #define DEBUG_ENZO_REFINE_SHOCK
-
 //----------------------------------------------------------------------
 
 EnzoRefineShock::EnzoRefineShock(double pressure_min_refine,
@@ -26,166 +24,131 @@ EnzoRefineShock::EnzoRefineShock(double pressure_min_refine,
     energy_ratio_min_refine_ (energy_ratio_min_refine),
     energy_ratio_max_coarsen_(energy_ratio_max_coarsen),
     gamma_(gamma),
-    comoving_coordinates_(comoving_coordinates)
+    comoving_coordinates_(comoving_coordinates),
+    tile_rank_(0),
+    tile_te_(NULL),
+    tile_de_(NULL),
+    tile_p_(NULL),
+    tile_output_values_(NULL)
 {
 }
 
 //----------------------------------------------------------------------
 
-int EnzoRefineShock::apply ( Block * block ) throw ()
+int EnzoRefineShock::tile_begin ( Block * block ) throw ()
 {
-
   Field field = block->data()->field();
 
   int nx,ny,nz;
   field.size(&nx,&ny,&nz);
 
   int rank = cello::rank();
+  tile_rank_ = rank;
 
   // compute pressure using the EnzoComputePressure class
-
   EnzoComputePressure compute_pressure (gamma_,comoving_coordinates_);
   compute_pressure.compute(block);
 
-  Data * data = block->data();
-  double xm[3],xp[3];
-  data->lower(&xm[0],&xm[1],&xm[2]);
-  data->upper(&xp[0],&xp[1],&xp[2]);
-
   int id_velocity = field.field_id("velocity_x");
 
-  ASSERT("EnzoRefineShock::apply",
+  ASSERT("EnzoRefineShock::tile_begin",
 	  "velocity_x field must be defined",
 	 (id_velocity >= 0));
 
-    void * v3[3] = {
-    (rank >= 1) ? field.values("velocity_x") : NULL,
-    (rank >= 2) ? field.values("velocity_y") : NULL,
-    (rank >= 3) ? field.values("velocity_z") : NULL
-  };
+  tile_v3_[0] = (rank >= 1) ? (enzo_float*) field.values("velocity_x") : NULL;
+  tile_v3_[1] = (rank >= 2) ? (enzo_float*) field.values("velocity_y") : NULL;
+  tile_v3_[2] = (rank >= 3) ? (enzo_float*) field.values("velocity_z") : NULL;
+
+  tile_te_ = (enzo_float*) field.values("total_energy");
+  tile_de_ = (enzo_float*) field.values("density");
+  tile_p_  = (enzo_float*) field.values("pressure");
 
-  void * te = field.values("total_energy");
-  void * de = field.values("density");
-  void * p  = field.values("pressure");
-   
   int gx,gy,gz;
   field.ghost_depth(id_velocity, &gx,&gy,&gz);
 
-  int nxd = nx + 2*gx;
-  int nyd = ny + 2*gy;
-  int nzd = nz + 2*gz;
+  tile_m3_[0] = nx + 2*gx;
+  tile_m3_[1] = ny + 2*gy;
+  tile_m3_[2] = nz + 2*gz;
 
   if (rank < 1) gx = 0;
   if (rank < 2) gy = 0;
   if (rank < 3) gz = 0;
 
-  //  precision_type precision = field.precision(id_velocity);
-
-  void * output = initialize_output_(field.field_data());
-
-  bool any_refine  = false;
-  bool all_coarsen = true;
-  
-  evaluate_block_((const enzo_float**) v3,
-		  (const enzo_float*)  te,
-		  (const enzo_float*)  de,
-		  (const enzo_float*)  p,
-		  (enzo_float*) output,
-		  nxd,nyd,nzd,nx,ny,nz,gx,gy,gz,
-		  &any_refine,&all_coarsen, rank);
+  tile_n3_[0] = nx;
+  tile_n3_[1] = ny;
+  tile_n3_[2] = nz;
+  tile_g3_[0] = gx;
+  tile_g3_[1] = gy;
+  tile_g3_[2] = gz;
 
-  int adapt_result =  
-    any_refine ? adapt_refine : (all_coarsen ? adapt_coarsen : adapt_same) ;
-
-  // Don't refine if already at maximum level
-  adjust_for_level_ (&adapt_result,block->level());
-
-  return adapt_result;
+  tile_output_values_ =
+    (enzo_float*) initialize_output_(field.field_data());
+  tile_initialize_ (block,tile_output_values_);
 
+  return ny*nz;
 }
 
 //----------------------------------------------------------------------
 
-void EnzoRefineShock::evaluate_block_
-(const enzo_float * v3[],
- const enzo_float * te,
- const enzo_float * de,
- const enzo_float * p,
- enzo_float * output,
- int ndx, int ndy, int ndz,
- int nx, int ny, int nz,
- int gx, int gy, int gz,
- bool *any_refine,
- bool * all_coarsen, 
- int rank)
+void EnzoRefineShock::tile_apply ( int ir_begin, int ir_end ) throw ()
 {
-  (*all_coarsen) = true;
-  (*any_refine)  = false;
+  const enzo_float ** v3 = (const enzo_float **) tile_v3_;
+  const enzo_float * te = tile_te_;
+  const enzo_float * de = tile_de_;
+  const enzo_float * p  = tile_p_;
+  enzo_float * output = tile_output_values_;
+
+  const int rank = tile_rank_;
+  const int ndx = tile_m3_[0];
+  const int ndy = tile_m3_[1];
+  const int nx = tile_n3_[0];
+  const int ny = tile_n3_[1];
+  const int gx = tile_g3_[0];
+  const int gy = tile_g3_[1];
+  const int gz = tile_g3_[2];
 
   const int d3[3] = {1, ndx, ndx*ndy};
 
-#ifdef DEBUG_ENZO_REFINE_SHOCK
-  enzo_float dp_min = std::numeric_limits<enzo_float>::max();
-  enzo_float dp_max = -std::numeric_limits<enzo_float>::max();
-  enzo_float er_min = std::numeric_limits<enzo_float>::max();
-  enzo_float er_max = -std::numeric_limits<enzo_float>::max();
-#endif
-  
-  for (int axis=0; axis<rank; axis++) {
-
-    for (int iz=gz; iz<nz+gz; iz++) {
-      for (int iy=gy; iy<ny+gy; iy++) {
-	for (int ix=gx; ix<nx+gx; ix++) {
-
-	  int i = ix + ndx*(iy + ndy*iz);
-	  int id = d3[axis];
-
-	  enzo_float dp = fabs    (p[i+id] - p[i-id]) 
-	    / (std::min(p[i+id] , p[i-id])) ;
-
-	  enzo_float dv = v3[axis][i+id] - v3[axis][i-id];
-
-	  enzo_float e = p[i]/(gamma_ - 1.0);
-
-	  enzo_float ep = te[i+id]*de[i+id];
-	  enzo_float e0 = te[i]   *de[i];
-	  enzo_float em = te[i-id]*de[i-id];
-
-	  enzo_float er = e / std::max (std::max(em,e0),ep);
-
-	  bool l_refine = (dv < 0.0) && 
-	    (dp > pressure_min_refine_) &&
-	    (er > energy_ratio_min_refine_);
-
-	  bool l_same = (dv < 0.0) &&
-	    (dp > pressure_max_coarsen_) &&
-	    (er > energy_ratio_max_coarsen_);
-
-#ifdef DEBUG_ENZO_REFINE_SHOCK
-	  dp_min = std::min(dp_min,dp);
-	  dp_max = std::max(dp_max,dp);
-	  er_min = std::min(er_min,er);
-	  er_max = std::max(er_max,er);
-#endif
-	  if (l_refine)  *any_refine = true;
-	  if (l_same)    *all_coarsen = false;
-
-	  if (output) {
-	    if (l_same)   output[i] =  0;
-	    if (l_refine) output[i] = +1;
-	  }
-	}
+  for (int ir=ir_begin; ir<ir_end; ir++) {
+    const int iy = gy + ir % ny;
+    const int iz = gz + ir / ny;
+    const int i0 = ndx*(iy + ndy*iz);
+    bool row_refine = false;
+    bool row_same   = false;
+    for (int ix=gx; ix<nx+gx; ix++) {
+      int i = i0 + ix;
+      const enzo_float e  = p[i]/(gamma_ - 1.0);
+      const enzo_float e0 = te[i]*de[i];
+      bool l_refine = false;
+      bool l_same   = false;
+      // all axes are evaluated in the same sweep
+      for (int axis=0; axis<rank; axis++) {
+	int id = d3[axis];
+	enzo_float dp = fabs    (p[i+id] - p[i-id]) 
+	  / (std::min(p[i+id] , p[i-id])) ;
+	enzo_float dv = v3[axis][i+id] - v3[axis][i-id];
+	enzo_float ep = te[i+id]*de[i+id];
+	enzo_float em = te[i-id]*de[i-id];
+	enzo_float er = e / std::max (std::max(em,e0),ep);
+	l_refine = l_refine || ((dv < 0.0) && 
+				(dp > pressure_min_refine_) &&
+				(er > energy_ratio_min_refine_));
+	l_same = l_same || ((dv < 0.0) &&
+			    (dp > pressure_max_coarsen_) &&
+			    (er > energy_ratio_max_coarsen_));
+      }
+      row_refine = row_refine || l_refine;
+      row_same   = row_same   || l_same;
+      if (output) {
+	if (l_same)   output[i] =  0;
+	if (l_refine) output[i] = +1;
       }
     }
+    if (row_refine) tile_any_refine_  = true;
+    if (row_same)   tile_all_coarsen_ = false;
+
+    if (tile_decided()) return;
   }
-#ifdef DEBUG_ENZO_REFINE_SHOCK
-  CkPrintf ("%s dp limits %lf %lf  dp min/max %lf %lf\n",
-	    pressure_max_coarsen_,pressure_min_refine_,
-	    dp_min,dp_max);
-  CkPrintf ("%s er limits %lf %lf  er min/max %lf %lf\n",
-	    energy_ratio_max_coarsen_,energy_ratio_min_refine_,
-	    er_min,er_max);
-#endif  
 }
-//======================================================================
 
+//======================================================================
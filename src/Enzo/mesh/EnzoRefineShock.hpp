@@ -41,7 +41,12 @@ public: // interface
       energy_ratio_min_refine_(0.0),
       energy_ratio_max_coarsen_(0.0),
       gamma_(0.0),
-      comoving_coordinates_(false)
+      comoving_coordinates_(false),
+      tile_rank_(0),
+      tile_te_(NULL),
+      tile_de_(NULL),
+      tile_p_(NULL),
+      tile_output_values_(NULL)
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -61,24 +66,13 @@ public: // interface
     p | comoving_coordinates_;
   }
 
-  /// Evaluate the refinement criteria, updating the refinement field
-  virtual int apply (Block * block) throw();
+  /// Compute pressure and prepare to evaluate shocks on the Block
+  virtual int tile_begin (Block * block) throw();
 
-  virtual std::string name () const { return "shock"; };
-
-private: // functions
+  /// Evaluate shock conditions along all axes in the given rows
+  virtual void tile_apply (int ir_begin, int ir_end) throw();
 
-  void evaluate_block_( const enzo_float ** v3,
-			const enzo_float * te,
-			const enzo_float * de,
-			const enzo_float * p,
-			enzo_float * output,
-			int ndx, int ndy, int ndz,
-			int nx, int ny, int nz,
-			int gx, int gy, int gz,
-			bool *any_refine,
-			bool *all_coarsen, 
-			int rank);
+  virtual std::string name () const { return "shock"; };
 
 private: // attributes
 
@@ -99,6 +93,23 @@ private: // attributes
 
   /// Comoving coordinates
   bool comoving_coordinates_;
+
+  // Block being evaluated by tile_apply() (not pupped)
+
+  /// Rank of the Block
+  int tile_rank_;
+
+  /// Field values
+  enzo_float * tile_v3_[3];
+  enzo_float * tile_te_;
+  enzo_float * tile_de_;
+  enzo_float * tile_p_;
+  enzo_float * tile_output_values_;
+
+  /// Field dimensions, active size, and loop offsets
+  int tile_m3_[3];
+  int tile_n3_[3];
+  int tile_g3_[3];
 };
 
 #endif /* ENZO_ENZO_REFINE_SHOCK_HPP */
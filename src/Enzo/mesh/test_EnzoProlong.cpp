@@ -0,0 +1,169 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_EnzoProlong.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    Test program and micro-benchmark for batched EnzoProlong
+///
+/// Prolongs NF fields from a coarse (padded) array to a fine block in
+/// three ways: calling interpolate() with work arrays allocated for each
+/// field, as EnzoProlong did previously; calling EnzoProlong::apply()
+/// for each field; and calling EnzoProlong::apply_fields() once for all
+/// fields.  Results must agree exactly, and the number of fields
+/// prolonged per second is printed for each.  Since there is no
+/// Simulation, cello::rank() is 1, so blocks are one-dimensional.
+
+#include "test.hpp"
+#include "main.hpp"
+#include "enzo.hpp"
+
+#define CK_TEMPLATES_ONLY
+#include "enzo.def.h"
+#undef CK_TEMPLATES_ONLY
+
+// number of fine cells in the prolonged region
+const int N = 32;
+// fine ghost depth
+const int G = 4;
+// number of fields
+const int NF = 32;
+// number of times each method is evaluated
+const int NUM_REPEAT = 2000;
+// thousands of fields prolonged by each method, for reporting throughput
+const double KFIELDS = 1e-3*NUM_REPEAT*NF;
+
+//----------------------------------------------------------------------
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class ("EnzoProlong");
+
+  EnzoProlong prolong ("3A",true,false);
+
+  // fine arrays include ghost zones; coarse arrays include the one
+  // coarse cell of padding on each side required by EnzoProlong
+
+  int m3_f[3] = {N+2*G,1,1};
+  int o3_f[3] = {G,0,0};
+  int n3_f[3] = {N,1,1};
+  int m3_c[3] = {N/2+2,1,1};
+  int o3_c[3] = {0,0,0};
+  int n3_c[3] = {N/2+2,1,1};
+
+  const int mf = m3_f[0]*m3_f[1]*m3_f[2];
+  const int mc = m3_c[0]*m3_c[1]*m3_c[2];
+
+  std::vector< std::vector<enzo_float> > coarse (NF);
+  std::vector< std::vector<enzo_float> > fine_ref (NF);
+  std::vector< std::vector<enzo_float> > fine_apply (NF);
+  std::vector< std::vector<enzo_float> > fine_batch (NF);
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<double> rand(1.0,2.0);
+  for (int i_f=0; i_f<NF; i_f++) {
+    coarse[i_f].resize(mc);
+    for (int i=0; i<mc; i++) coarse[i_f][i] = rand(gen);
+    fine_ref[i_f].assign(mf,0.0);
+    fine_apply[i_f].assign(mf,0.0);
+    fine_batch[i_f].assign(mf,0.0);
+  }
+
+  //--------------------------------------------------
+  unit_func ("interpolate() with allocated work");
+  //--------------------------------------------------
+
+  int error_alloc = 0;
+  Timer timer_alloc;
+  timer_alloc.start();
+  for (int k=0; k<NUM_REPEAT; k++) {
+    for (int i_f=0; i_f<NF; i_f++) {
+      int rank = 1, error = 0, method = 0, positive = 1;
+      int r3[3] = {2,2,2};
+      int pdims[1]  = {m3_c[0]};
+      int pstart[1] = {2};
+      int pend[1]   = {n3_f[0]+1};
+      int gdims[1]  = {m3_f[0]};
+      int gstart[1] = {0};
+      enzo_float * work = new enzo_float[2*(gdims[0]/2+1)+100];
+      FORTRAN_NAME(interpolate)
+        (&rank, coarse[i_f].data(), pdims, pstart, pend, r3,
+         fine_ref[i_f].data()+o3_f[0], gdims, gstart, work, &method,
+         &positive, &error);
+      delete [] work;
+      error_alloc = std::max(error_alloc,error);
+    }
+  }
+  timer_alloc.stop();
+
+  // interpolate() fills the prolonged region with positive values,
+  // since coarse values are positive, and leaves ghost zones unchanged
+
+  bool filled = (error_alloc == 0);
+  for (int i_f=0; i_f<NF; i_f++) {
+    for (int i=0; i<mf; i++) {
+      const bool in_region = (o3_f[0] <= i && i < o3_f[0]+n3_f[0]);
+      filled = filled &&
+        (in_region ? (fine_ref[i_f][i] > 0.0) : (fine_ref[i_f][i] == 0.0));
+    }
+  }
+  unit_assert (filled);
+
+  //--------------------------------------------------
+  unit_func ("apply()");
+  //--------------------------------------------------
+
+  Timer timer_apply;
+  timer_apply.start();
+  for (int k=0; k<NUM_REPEAT; k++) {
+    for (int i_f=0; i_f<NF; i_f++) {
+      prolong.apply (default_precision,
+                     fine_apply[i_f].data(),m3_f,o3_f,n3_f,
+                     coarse[i_f].data(),    m3_c,o3_c,n3_c);
+    }
+  }
+  timer_apply.stop();
+
+  bool match = true;
+  for (int i_f=0; i_f<NF; i_f++) match = match && (fine_apply[i_f] == fine_ref[i_f]);
+  unit_assert (match);
+
+  //--------------------------------------------------
+  unit_func ("apply_fields()");
+  //--------------------------------------------------
+
+  std::vector<void *> values_f (NF);
+  std::vector<const void *> values_c (NF);
+  for (int i_f=0; i_f<NF; i_f++) {
+    values_f[i_f] = fine_batch[i_f].data();
+    values_c[i_f] = coarse[i_f].data();
+  }
+
+  Timer timer_batch;
+  timer_batch.start();
+  for (int k=0; k<NUM_REPEAT; k++) {
+    prolong.apply_fields (default_precision, NF,
+                          values_f.data(),m3_f,o3_f,n3_f,
+                          values_c.data(),m3_c,o3_c,n3_c);
+  }
+  timer_batch.stop();
+
+  match = true;
+  for (int i_f=0; i_f<NF; i_f++) match = match && (fine_batch[i_f] == fine_ref[i_f]);
+  unit_assert (match);
+
+  CkPrintf ("EnzoProlong  Kfields/s  allocating: %7.2f  apply: %7.2f  "
+            "apply_fields: %7.2f\n",
+            unit_rate(KFIELDS,timer_alloc),
+            unit_rate(KFIELDS,timer_apply),
+            unit_rate(KFIELDS,timer_batch));
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
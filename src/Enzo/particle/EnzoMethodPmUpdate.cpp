@@ -22,12 +22,26 @@
 //----------------------------------------------------------------------
 
 EnzoMethodPmUpdate::EnzoMethodPmUpdate
-( double max_dt )
+( double max_dt, std::string sort_order )
   : Method(),
-    max_dt_(max_dt)
+    max_dt_(max_dt),
+    sort_order_(sort_order_none)
 {
   TRACE_PM("EnzoMethodPmUpdate()");
 
+  if (sort_order == "none") {
+    sort_order_ = sort_order_none;
+  } else if (sort_order == "cell") {
+    sort_order_ = sort_order_cell;
+  } else if (sort_order == "morton") {
+    sort_order_ = sort_order_morton;
+  } else {
+    ERROR1 ("EnzoMethodPmUpdate::EnzoMethodPmUpdate()",
+	    "Unknown Method:pm_update:sort_order \"%s\": "
+	    "expecting \"none\", \"cell\", or \"morton\"",
+	    sort_order.c_str());
+  }
+
   const int rank = cello::rank();
  
   if (rank >= 1) cello::define_field("acceleration_x");
@@ -66,6 +80,7 @@ void EnzoMethodPmUpdate::pup (PUP::er &p)
   Method::pup(p);
 
   p | max_dt_;
+  p | sort_order_;
 }
 
 //----------------------------------------------------------------------
@@ -153,6 +168,9 @@ void EnzoMethodPmUpdate::compute ( Block * block) throw()
 
       const int nb = particle.num_batches (it);
 
+      // attributes are contiguous arrays if not interleaved
+      const bool is_soa = (dp == 1 && dv == 1 && da == 1);
+
       // check precisions match
 
       const int ba = particle.attribute_bytes(it,ia_x); // "bytes (actual)"
@@ -192,6 +210,19 @@ void EnzoMethodPmUpdate::compute ( Block * block) throw()
 
         const int np = particle.num_particles(it,ib);
 
+#ifndef DEBUG_UPDATE
+        if (is_soa) {
+          // vectorized update of contiguous attribute arrays
+          if (rank >= 1)
+            enzo_particle_kernels::kick_drift_kick (x,vx,ax,np,cp,cvv,cva);
+          if (rank >= 2)
+            enzo_particle_kernels::kick_drift_kick (y,vy,ay,np,cp,cvv,cva);
+          if (rank >= 3)
+            enzo_particle_kernels::kick_drift_kick (z,vz,az,np,cp,cvv,cva);
+          continue;
+        }
+#endif
+
         if (rank >= 1) {
 
 	        for (int ip=0; ip<np; ip++) {
@@ -257,6 +288,11 @@ void EnzoMethodPmUpdate::compute ( Block * block) throw()
 	        } // ip
         } // rank 3
       } // ib loop
+
+      if (sort_order_ != sort_order_none) {
+        sort_particles_(block, particle, it);
+      }
+
     } // end loop over particle types
 
 #ifdef DEBUG_UPDATE
@@ -275,6 +311,119 @@ void EnzoMethodPmUpdate::compute ( Block * block) throw()
 
 //----------------------------------------------------------------------
 
+namespace {
+
+  /// Spread the low 10 bits of i so that there are two zero bits
+  /// between each
+  inline int morton_spread_3_ (int i)
+  {
+    unsigned v = i & 0x3ff;
+    v = (v | (v << 16)) & 0x030000ff;
+    v = (v | (v <<  8)) & 0x0300f00f;
+    v = (v | (v <<  4)) & 0x030c30c3;
+    v = (v | (v <<  2)) & 0x09249249;
+    return v;
+  }
+
+  /// Spread the low 15 bits of i so that there is one zero bit between each
+  inline int morton_spread_2_ (int i)
+  {
+    unsigned v = i & 0x7fff;
+    v = (v | (v << 8)) & 0x00ff00ff;
+    v = (v | (v << 4)) & 0x0f0f0f0f;
+    v = (v | (v << 2)) & 0x33333333;
+    v = (v | (v << 1)) & 0x55555555;
+    return v;
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodPmUpdate::sort_particles_
+(Block * block, Particle & particle, int it)
+{
+  // Sort particles by the (ghosted) cell containing them so that
+  // particles sharing a cell are adjacent in memory, which improves
+  // locality of subsequent CIC deposit and interpolation.  Sorting is
+  // skipped if particles are still in order from the previous cycle
+
+  const int np = particle.num_particles(it);
+  if (np == 0) return;
+
+  const int rank = cello::rank();
+
+  Field field = block->data()->field();
+  int nx,ny,nz;
+  int gx,gy,gz;
+  field.size(&nx,&ny,&nz);
+  field.ghost_depth(0,&gx,&gy,&gz);
+  const int mx = nx + 2*gx;
+  const int my = (rank >= 2) ? ny + 2*gy : 1;
+  const int mz = (rank >= 3) ? nz + 2*gz : 1;
+
+  double xm,ym,zm;
+  double xp,yp,zp;
+  block->lower(&xm,&ym,&zm);
+  block->upper(&xp,&yp,&zp);
+  const double hxi = nx / (xp-xm);
+  const double hyi = ny / (yp-ym);
+  const double hzi = nz / (zp-zm);
+
+  int num_keys = mx*my*mz;
+  if (sort_order_ == sort_order_morton) {
+    int mm = std::max(mx,std::max(my,mz));
+    int nbits = 0;
+    while ((1 << nbits) < mm) ++nbits;
+    ASSERT1 ("EnzoMethodPmUpdate::sort_particles_()",
+	     "Block size %d too large for Morton sort order",
+	     mm, (nbits <= ((rank == 3) ? 10 : 15)));
+    num_keys = 1 << (rank*nbits);
+  }
+
+  const int ia_x  = (rank >= 1) ? particle.attribute_index (it, "x") : -1;
+  const int ia_y  = (rank >= 2) ? particle.attribute_index (it, "y") : -1;
+  const int ia_z  = (rank >= 3) ? particle.attribute_index (it, "z") : -1;
+  const int dp = particle.stride(it, ia_x);
+
+  std::vector<int> key (np);
+
+  const int nb = particle.num_batches (it);
+  int i = 0;
+  for (int ib=0; ib<nb; ib++) {
+    const enzo_float * x = (rank >= 1) ?
+      (enzo_float *) particle.attribute_array (it, ia_x, ib) : nullptr;
+    const enzo_float * y = (rank >= 2) ?
+      (enzo_float *) particle.attribute_array (it, ia_y, ib) : nullptr;
+    const enzo_float * z = (rank >= 3) ?
+      (enzo_float *) particle.attribute_array (it, ia_z, ib) : nullptr;
+    const int npb = particle.num_particles(it,ib);
+    for (int ip=0; ip<npb; ip++,i++) {
+      int ix = 0, iy = 0, iz = 0;
+      if (rank >= 1) ix = gx + (int)std::floor((x[ip*dp]-xm)*hxi);
+      if (rank >= 2) iy = gy + (int)std::floor((y[ip*dp]-ym)*hyi);
+      if (rank >= 3) iz = gz + (int)std::floor((z[ip*dp]-zm)*hzi);
+      ix = std::max(0,std::min(ix,mx-1));
+      iy = std::max(0,std::min(iy,my-1));
+      iz = std::max(0,std::min(iz,mz-1));
+      if (sort_order_ == sort_order_cell) {
+        key[i] = ix + mx*(iy + my*iz);
+      } else if (rank == 3) {
+        key[i] = morton_spread_3_(ix)
+          | (morton_spread_3_(iy) << 1)
+          | (morton_spread_3_(iz) << 2);
+      } else if (rank == 2) {
+        key[i] = morton_spread_2_(ix) | (morton_spread_2_(iy) << 1);
+      } else {
+        key[i] = ix;
+      }
+    }
+  }
+
+  particle.sort(it, key.data(), num_keys);
+}
+
+//----------------------------------------------------------------------
+
 double EnzoMethodPmUpdate::timestep ( Block * block ) throw()
 {
   TRACE_PM("timestep()");
@@ -17,7 +17,7 @@ class EnzoMethodPmUpdate : public Method {
 public: // interface
 
   /// Create a new EnzoMethodPmUpdate object
-  EnzoMethodPmUpdate(double max_dt);
+  EnzoMethodPmUpdate(double max_dt, std::string sort_order = "none");
 
   /// Charm++ PUP::able declarations
   PUPable_decl(EnzoMethodPmUpdate);
@@ -25,7 +25,8 @@ public: // interface
   /// Charm++ PUP::able migration constructor
   EnzoMethodPmUpdate (CkMigrateMessage *m)
     : Method (m),
-      max_dt_(0.0)
+      max_dt_(0.0),
+      sort_order_(sort_order_none)
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -40,10 +41,25 @@ public: // interface
   /// Compute maximum timestep for this method
   virtual double timestep ( Block * block) throw();
 
+protected: // methods
+
+  /// Reorder particles of type it by the cell containing them
+  void sort_particles_ (Block * block, Particle & particle, int it);
+
 protected: // attributes
 
+  /// Order in which particles are stored after updating positions
+  enum sort_order_type {
+    sort_order_none,   // no sorting
+    sort_order_cell,   // row-major cell index
+    sort_order_morton  // Morton (Z-order) index of cell
+  };
+
   double max_dt_;
 
+  /// Particle sort order, one of sort_order_type
+  int sort_order_;
+
 };
 
 #endif /* ENZO_ENZO_METHOD_PM_UPDATE_HPP */
@@ -0,0 +1,181 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     EnzoParticleKernels.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    [\ref Enzo] Vectorizable kernels for particle batches
+///
+/// These kernels operate on a single batch of particles whose attributes
+/// are stored as separate contiguous arrays (that is, particle types
+/// that are not interleaved, for which Particle::stride() is 1).  Unit
+/// stride lets the compiler use aligned vector loads and stores, which
+/// the general strided loops in EnzoMethodPmUpdate and
+/// EnzoMethodPmDeposit do not allow.
+///
+/// CIC deposit is split into two passes over chunks of cic_chunk
+/// particles: a vectorized pass computing each particle's base cell
+/// and weights, followed by a scalar pass that scatters them.  Only
+/// the scatter can conflict, so deposit_private() distributes batches
+/// among ParallelFor threads that each scatter into a private copy of
+/// the density array, and then sums the copies.
+
+#ifndef ENZO_ENZO_PARTICLE_KERNELS_HPP
+#define ENZO_ENZO_PARTICLE_KERNELS_HPP
+
+namespace enzo_particle_kernels {
+
+  /// Number of particles whose CIC weights are computed together
+  constexpr int cic_chunk = 64;
+
+  //----------------------------------------------------------------------
+
+  /// Kick-drift-kick update of one axis of np particles with unit
+  /// stride, as in EnzoMethodPmUpdate::compute()
+  inline void kick_drift_kick (enzo_float * x, enzo_float * v,
+                               const enzo_float * a, int np,
+                               double cp, double cvv, double cva)
+  {
+    #pragma omp simd
+    for (int ip=0; ip<np; ip++) {
+      v[ip] = cvv*v[ip] + cva*a[ip];
+      x[ip] += cp*v[ip];
+      v[ip] = cvv*v[ip] + cva*a[ip];
+    }
+  }
+
+  //----------------------------------------------------------------------
+
+  /// CIC deposit of np particles with unit stride into the array de of
+  /// size mx*my*mz.  Positions are first drifted by dt times velocity.
+  /// Particle ip deposits scale*mass[ip*dm], so dm is 0 for a constant
+  /// mass.  The base cell along x is gx + floor((x-xm)*hxi - 0.5),
+  /// where hxi is the inverse cell width, and similarly along y and z.
+  /// Unused axes (rank < 3) are ignored.
+  template <int RANK>
+  void cic_deposit (enzo_float * de, int mx, int my,
+                    const enzo_float * x,  const enzo_float * y,
+                    const enzo_float * z,
+                    const enzo_float * vx, const enzo_float * vy,
+                    const enzo_float * vz, double dt,
+                    const enzo_float * mass, int dm, double scale, int np,
+                    double xm, double ym, double zm,
+                    double hxi, double hyi, double hzi,
+                    int gx, int gy, int gz)
+  {
+    int        index[cic_chunk];
+    enzo_float pdens[cic_chunk];
+    enzo_float wx[cic_chunk], wy[cic_chunk], wz[cic_chunk];
+
+    const int dy = mx;
+    const int dz = mx*my;
+
+    for (int ip0=0; ip0<np; ip0+=cic_chunk) {
+
+      const int nc = std::min(cic_chunk, np - ip0);
+
+      // compute base cell index and lower weights (vectorized)
+
+      #pragma omp simd
+      for (int ic=0; ic<nc; ic++) {
+        const int ip = ip0 + ic;
+        const double tx = (x[ip] + vx[ip]*dt - xm)*hxi - 0.5;
+        const double fx = std::floor(tx);
+        int i = gx + int(fx);
+        wx[ic] = 1.0 - (tx - fx);
+        if (RANK >= 2) {
+          const double ty = (y[ip] + vy[ip]*dt - ym)*hyi - 0.5;
+          const double fy = std::floor(ty);
+          i += dy*(gy + int(fy));
+          wy[ic] = 1.0 - (ty - fy);
+        }
+        if (RANK >= 3) {
+          const double tz = (z[ip] + vz[ip]*dt - zm)*hzi - 0.5;
+          const double fz = std::floor(tz);
+          i += dz*(gz + int(fz));
+          wz[ic] = 1.0 - (tz - fz);
+        }
+        index[ic] = i;
+        pdens[ic] = scale*mass[ip*dm];
+      }
+
+      // scatter (may update the same cell more than once)
+
+      for (int ic=0; ic<nc; ic++) {
+        const int i = index[ic];
+        const enzo_float x0 = wx[ic];
+        const enzo_float x1 = 1.0 - x0;
+        const enzo_float d  = pdens[ic];
+        if (RANK == 1) {
+          de[i]   += d*x0;
+          de[i+1] += d*x1;
+        } else if (RANK == 2) {
+          const enzo_float y0 = d*wy[ic];
+          const enzo_float y1 = d - y0;
+          de[i]      += x0*y0;
+          de[i+1]    += x1*y0;
+          de[i+dy]   += x0*y1;
+          de[i+dy+1] += x1*y1;
+        } else {
+          const enzo_float y0 = wy[ic];
+          const enzo_float y1 = 1.0 - y0;
+          const enzo_float z0 = d*wz[ic];
+          const enzo_float z1 = d - z0;
+          de[i]         += x0*y0*z0;
+          de[i+1]       += x1*y0*z0;
+          de[i+dy]      += x0*y1*z0;
+          de[i+dy+1]    += x1*y1*z0;
+          de[i+dz]      += x0*y0*z1;
+          de[i+dz+1]    += x1*y0*z1;
+          de[i+dz+dy]   += x0*y1*z1;
+          de[i+dz+dy+1] += x1*y1*z1;
+        }
+      }
+    }
+  }
+
+  //----------------------------------------------------------------------
+
+  /// Call deposit(i,grid) for 0 <= i < num_items, where items are
+  /// distributed among ParallelFor threads and each thread deposits
+  /// into its own array.  Arrays of size m are summed into de when all
+  /// items are complete.  With one thread, items deposit directly into
+  /// de.
+  template <class F>
+  void deposit_private (enzo_float * de, int m, int num_items,
+                        const F & deposit)
+  {
+    const int nt = std::min(ParallelFor::num_threads(), num_items);
+
+    if (nt <= 1) {
+      for (int i=0; i<num_items; i++) deposit(i,de);
+      return;
+    }
+
+    // the first thread deposits directly into de
+    std::vector< std::vector<enzo_float> > grid (nt-1);
+
+    ParallelFor::apply
+      (0, nt, [&](int it_start, int it_stop) {
+        for (int it=it_start; it<it_stop; it++) {
+          enzo_float * g = de;
+          if (it > 0) {
+            grid[it-1].assign(m,0.0);
+            g = grid[it-1].data();
+          }
+          for (int i=it; i<num_items; i+=nt) deposit(i,g);
+        }
+      });
+
+    ParallelFor::apply
+      (0, m, [&](int i_start, int i_stop) {
+        for (int k=0; k<nt-1; k++) {
+          const enzo_float * g = grid[k].data();
+          #pragma omp simd
+          for (int i=i_start; i<i_stop; i++) de[i] += g[i];
+        }
+      });
+  }
+
+}
+
+#endif /* ENZO_ENZO_PARTICLE_KERNELS_HPP */
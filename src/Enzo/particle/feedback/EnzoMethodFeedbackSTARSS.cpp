@@ -186,33 +186,46 @@ int EnzoMethodFeedbackSTARSS::determineWinds(double age_Myr, double * eWinds, do
 void EnzoMethodFeedbackSTARSS::transformComovingWithStar(enzo_float * density, 
                                   enzo_float * velocity_x, enzo_float * velocity_y, enzo_float * velocity_z,
                                   const enzo_float up, const enzo_float vp, const enzo_float wp,
-                                  const int mx, const int my, const int mz, int direction) const throw()
+                                  const int mx, const int my,
+                                  const int ixl, const int ixu,
+                                  const int iyl, const int iyu,
+                                  const int izl, const int izu,
+                                  int direction) const throw()
 {
-  int size = mx*my*mz;
   if (direction > 0)
   {
     // to comoving with star
     // NOTE: This transforms the velocity field into a momentum density
     //       field for the sake of depositing momentum easily
  
-    for (int ind = 0; ind<size; ind++) {
-      double mult = density[ind];
-      velocity_x[ind] = (velocity_x[ind]-up)*mult;
-      velocity_y[ind] = (velocity_y[ind]-vp)*mult;
-      velocity_z[ind] = (velocity_z[ind]-wp)*mult;
+    for (int iz = izl; iz <= izu; iz++) {
+      for (int iy = iyl; iy <= iyu; iy++) {
+        for (int ix = ixl; ix <= ixu; ix++) {
+          int ind = INDEX(ix,iy,iz,mx,my);
+          double mult = density[ind];
+          velocity_x[ind] = (velocity_x[ind]-up)*mult;
+          velocity_y[ind] = (velocity_y[ind]-vp)*mult;
+          velocity_z[ind] = (velocity_z[ind]-wp)*mult;
+        }
+      }
     }
   }
 
   else if (direction < 0)
   {
     // back to "lab" frame. Convert momentum density field back to velocity
-    for (int ind = 0; ind<size; ind++) {
-      //if (density[ind] <= 10*1e-20) continue;
-      if (density[ind] == 0) continue;
-      double mult = 1/density[ind];
-      velocity_x[ind] = velocity_x[ind]*mult + up;
-      velocity_y[ind] = velocity_y[ind]*mult + vp;
-      velocity_z[ind] = velocity_z[ind]*mult + wp;
+    for (int iz = izl; iz <= izu; iz++) {
+      for (int iy = iyl; iy <= iyu; iy++) {
+        for (int ix = ixl; ix <= ixu; ix++) {
+          int ind = INDEX(ix,iy,iz,mx,my);
+          //if (density[ind] <= 10*1e-20) continue;
+          if (density[ind] == 0) continue;
+          double mult = 1/density[ind];
+          velocity_x[ind] = velocity_x[ind]*mult + up;
+          velocity_y[ind] = velocity_y[ind]*mult + vp;
+          velocity_z[ind] = velocity_z[ind]*mult + wp;
+        }
+      }
     }
   }
 
@@ -628,6 +641,12 @@ void EnzoMethodFeedbackSTARSS::compute_ (Block * block)
 
   const int nb = particle.num_batches(it);
 
+  // shared by all feedback events on this block
+  DepositHistory history;
+  int num_events = 0;
+  Timer timer;
+  timer.start();
+
   for (int ib=0; ib<nb; ib++){
     enzo_float *px=0, *py=0, *pz=0, *pvx=0, *pvy=0, *pvz=0;
     enzo_float *plifetime=0, *pcreation=0, *pmass=0, *pmetal=0, *psncounter=0, *plum=0;
@@ -708,7 +727,9 @@ void EnzoMethodFeedbackSTARSS::compute_ (Block * block)
             this->deposit_feedback( block, energySN, SNMassEjected, SNMetalEjected,
                                     pvx[ipdv],pvy[ipdv],pvz[ipdv],
                                     px[ipdp],py[ipdp],pz[ipdp],
-                                    ix, iy, iz, 0, nSNII, nSNIa, starZ); // removed P3
+                                    ix, iy, iz, 0, nSNII, nSNIa, starZ,
+                                    history); // removed P3
+            num_events++;
 
             // add counter for number of SNe for the particle
             psncounter[ipsn] += nSNII+nSNIa;
@@ -733,7 +754,9 @@ void EnzoMethodFeedbackSTARSS::compute_ (Block * block)
             this->deposit_feedback( block, windEnergy, windMass, windMetals,
                                     pvx[ipdv],pvy[ipdv],pvz[ipdv],
                                     px[ipdp],py[ipdp],pz[ipdp],
-                                    ix, iy, iz, 1, 0, 0, starZ); // removed P3
+                                    ix, iy, iz, 1, 0, 0, starZ,
+                                    history); // removed P3
+            num_events++;
 
           } // if wind mass > 0
         } // if winds
@@ -762,10 +785,14 @@ void EnzoMethodFeedbackSTARSS::compute_ (Block * block)
     } // end particle loop
   } // end batch loop
 
+  timer.stop();
 
   if (count > 0){
-    CkPrintf("FeedbackSTARSS: Num FB particles = %d  Events = %d  FeedbackTime %e\n",
-              count, numSN, 0.00);
+    const double feedback_time = timer.value();
+    CkPrintf("FeedbackSTARSS: Num FB particles = %d  Events = %d  FeedbackTime %e"
+             "  Deposits = %d  Deposits/s %e\n",
+              count, numSN, feedback_time, num_events,
+              (feedback_time > 0.0) ? num_events / feedback_time : 0.0);
   }
 
   // refresh
@@ -789,7 +816,8 @@ void EnzoMethodFeedbackSTARSS::deposit_feedback (Block * block,
                                               const int ix, const int iy, const int iz,
                                               const int winds, const int nSNII,
                                               const int nSNIA,
-                                              const double starZ)
+                                              const double starZ,
+                                              DepositHistory & history)
 
  const throw(){
   /*
@@ -824,8 +852,6 @@ void EnzoMethodFeedbackSTARSS::deposit_feedback (Block * block,
   my = ny + 2*gy;
   mz = nz + 2*gz;
 
-  int size = mx*my*mz;
-
   const int rank = cello::rank();
 
   double cell_volume_code = hx*hy*hz;
@@ -885,28 +911,27 @@ void EnzoMethodFeedbackSTARSS::deposit_feedback (Block * block,
   // holds just shell densities (used for refresh+accumulate)
   enzo_float * d_shell   = (enzo_float *) field.values(i_d_shell);
 
-  // allocate another set of temporary deposit fields for this event 
-  enzo_float *  d_dep = new enzo_float[size]; 
-  enzo_float * te_dep = new enzo_float[size];
-  enzo_float * ge_dep = new enzo_float[size];
-  enzo_float * mf_dep = new enzo_float[size];
-  enzo_float * vx_dep = new enzo_float[size];
-  enzo_float * vy_dep = new enzo_float[size];
-  enzo_float * vz_dep = new enzo_float[size];
-
-  // initialize temporary deposit fields as zero
-  // Not doing so gives in screwy results
-  for (int i=0; i<size; i++) {
-    d_dep [i] = 0;
-    te_dep[i] = 0;
-    ge_dep[i] = 0;
-    mf_dep[i] = 0;
-    vx_dep[i] = 0;
-    vy_dep[i] = 0;
-    vz_dep[i] = 0;
-  }
-
-
+  // Everything this event deposits lies within two cells of the host
+  // cell: coupling particles are one cell width from the star, and
+  // each is CIC-deposited into the cells under its one-cell-wide cloud.
+  // Deposits for this event are accumulated in arrays covering just this
+  // stencil (clipped to the block) instead of the full block.
+  const int ixl = std::max(ix-2,0), ixu = std::min(ix+2,mx-1);
+  const int iyl = std::max(iy-2,0), iyu = std::min(iy+2,my-1);
+  const int izl = std::max(iz-2,0), izu = std::min(iz+2,mz-1);
+  int sx = ixu-ixl+1;
+  int sy = iyu-iyl+1;
+  int sz = izu-izl+1;
+
+  // temporary deposit fields for this event, initialized as zero
+  enzo_float  d_dep[125] = {};
+  enzo_float te_dep[125] = {};
+  enzo_float ge_dep[125] = {};
+  enzo_float mf_dep[125] = {};
+  enzo_float vx_dep[125] = {};
+  enzo_float vy_dep[125] = {};
+  enzo_float vz_dep[125] = {};
+  enzo_float d_shell_dep[125] = {};
 
   const int index = INDEX(ix,iy,iz,mx,my);
 
@@ -960,14 +985,37 @@ void EnzoMethodFeedbackSTARSS::deposit_feedback (Block * block,
       }
   }
 
+  // compute the temperature (returns temperature in Kelvin) in the
+  // "lab" frame.  Temperature depends only on values in each cell, so it
+  // is computed once for all events on the block until an event's host
+  // cell has been deposited into by an earlier event.
+  bool temperature_valid = history.temperature_valid;
+  for (std::size_t k = 0; k < history.stencils.size(); k += 6) {
+    const int * b = &history.stencils[k];
+    if (b[0] <= ix && ix <= b[1] &&
+        b[2] <= iy && iy <= b[3] &&
+        b[4] <= iz && iz <= b[5]) temperature_valid = false;
+  }
+
+  if (! temperature_valid) {
+    EnzoComputeTemperature compute_temperature(enzo::fluid_props(),
+                                               enzo_config->physics_cosmology);
+
+    compute_temperature.compute(enzo_block);
+    history.temperature_valid = true;
+    history.stencils.clear();
+  }
+
      /* 
          transform to comoving with the star and transform velocities to momenta
          for easy momentum deposition, since the fluid variable that PPM pushes
          around is velocity
      */
   
-  this->transformComovingWithStar(d,vx,vy,vz,up,vp,wp,mx,my,mz, 1);
-  this->transformComovingWithStar(d_shell,vx_dep_tot,vy_dep_tot,vz_dep_tot,up,vp,wp,mx,my,mz, 1);
+  this->transformComovingWithStar(d,vx,vy,vz,up,vp,wp,mx,my,
+                                  ixl,ixu,iyl,iyu,izl,izu, 1);
+  this->transformComovingWithStar(d_shell,vx_dep_tot,vy_dep_tot,vz_dep_tot,up,vp,wp,mx,my,
+                                  ixl,ixu,iyl,iyu,izl,izu, 1);
 
   const GrackleChemistryData * grackle_chem = enzo::grackle_chemistry();
   const int primordial_chemistry = (grackle_chem == nullptr) ?
@@ -1066,12 +1114,6 @@ void EnzoMethodFeedbackSTARSS::deposit_feedback (Block * block,
     pTerminal = 8.3619e5 * pow(ejectaEnergy/1e51, 13./14.) * pow(n_mean, -0.25);
   } 
 
-  // compute the temperature (returns temperature in Kelvin)
-  EnzoComputeTemperature compute_temperature(enzo::fluid_props(),
-                                             enzo_config->physics_cosmology);
-
-  compute_temperature.compute(enzo_block);
-
   double T = temperature[index];
 
   double cSound = sqrt(enzo_constants::kboltz*T/(mu_mean*enzo_constants::mass_hydrogen)) / 1e5; // km/s
@@ -1329,6 +1371,7 @@ void EnzoMethodFeedbackSTARSS::deposit_feedback (Block * block,
       for (int iy_ = iy-1; iy_ <= iy+1; iy_++) {
         for (int iz_ = iz-1; iz_ <= iz+1; iz_++) {
           int flat = INDEX(ix_,iy_,iz_,mx,my);
+          int flat_s = INDEX(ix_-ixl,iy_-iyl,iz_-izl,sx,sy);
 
           // cell left edges for CiC (starting from ghost zones)
           double xcell = xm + (ix_+0.5 - gx)*hx; 
@@ -1347,15 +1390,15 @@ void EnzoMethodFeedbackSTARSS::deposit_feedback (Block * block,
           #endif
 
           // subtract values from the "deposit" fields
-          d_dep[flat] -= std::min(window * remainMass, maxEvacFraction*dpre);
+          d_dep[flat_s] -= std::min(window * remainMass, maxEvacFraction*dpre);
 
-          minusRho    += -1*d_dep[flat];
-          msubtracted += -1*d_dep[flat];
+          minusRho    += -1*d_dep[flat_s];
+          msubtracted += -1*d_dep[flat_s];
          
-          mf_dep[flat] -= std::min(window * remainZ, maxEvacFraction*zpre); 
+          mf_dep[flat_s] -= std::min(window * remainZ, maxEvacFraction*zpre); 
 
-          minusZ      += -1*mf_dep[flat];
-          zsubtracted += -1*mf_dep[flat];
+          minusZ      += -1*mf_dep[flat_s];
+          zsubtracted += -1*mf_dep[flat_s];
         } // endfor iz_
       } // endfor iy_
     } // endfor ix_
@@ -1426,102 +1469,108 @@ void EnzoMethodFeedbackSTARSS::deposit_feedback (Block * block,
     coupledGasEnergy_list[n] = coupledGasEnergy/nCouple;
   }
 
-  enzo_float left_edge[3] = {xm-gx*hx, ym-gy*hy, zm-gz*hz};
+  // left edge of the stencil
+  enzo_float left_edge[3] = {xm+(ixl-gx)*hx, ym+(iyl-gy)*hy, zm+(izl-gz)*hz};
 
   // CiC deposit mass/energy/momentum
   FORTRAN_NAME(cic_deposit)
   (&CloudParticlePositionX, &CloudParticlePositionY,
    &CloudParticlePositionZ, &rank, &nCouple, &coupledMass_list, d_dep, &left_edge,
-   &mx, &my, &mz, &hx, &A);
+   &sx, &sy, &sz, &hx, &A);
 
   FORTRAN_NAME(cic_deposit)
   (&CloudParticlePositionX, &CloudParticlePositionY,
    &CloudParticlePositionZ, &rank, &nCouple, &coupledMomenta_x, vx_dep, &left_edge,
-   &mx, &my, &mz, &hx, &A);
+   &sx, &sy, &sz, &hx, &A);
 
   FORTRAN_NAME(cic_deposit)
   (&CloudParticlePositionX, &CloudParticlePositionY,
    &CloudParticlePositionZ, &rank, &nCouple, &coupledMomenta_y, vy_dep, &left_edge,
-   &mx, &my, &mz, &hx, &A);
+   &sx, &sy, &sz, &hx, &A);
 
   FORTRAN_NAME(cic_deposit)
   (&CloudParticlePositionX, &CloudParticlePositionY,
    &CloudParticlePositionZ, &rank, &nCouple, &coupledMomenta_z, vz_dep, &left_edge,
-   &mx, &my, &mz, &hx, &A);
+   &sx, &sy, &sz, &hx, &A);
 
   FORTRAN_NAME(cic_deposit)
   (&CloudParticlePositionX, &CloudParticlePositionY,
    &CloudParticlePositionZ, &rank, &nCouple, &coupledMetals_list, mf_dep, &left_edge,
-   &mx, &my, &mz, &hx, &A);
+   &sx, &sy, &sz, &hx, &A);
 
   FORTRAN_NAME(cic_deposit)
   (&CloudParticlePositionX, &CloudParticlePositionY,
    &CloudParticlePositionZ, &rank, &nCouple, &coupledEnergy_list, te_dep, &left_edge,
-   &mx, &my, &mz, &hx, &A);
+   &sx, &sy, &sz, &hx, &A);
 
   FORTRAN_NAME(cic_deposit)
   (&CloudParticlePositionX, &CloudParticlePositionY,
    &CloudParticlePositionZ, &rank, &nCouple, &coupledGasEnergy_list, ge_dep, &left_edge,
-   &mx, &my, &mz, &hx, &A);
+   &sx, &sy, &sz, &hx, &A);
 
   FORTRAN_NAME(cic_deposit)
   (&CloudParticlePositionX, &CloudParticlePositionY,
-   &CloudParticlePositionZ, &rank, &nCouple, &coupledMass_list, d_shell, &left_edge,
-   &mx, &my, &mz, &hx, &A);
+   &CloudParticlePositionZ, &rank, &nCouple, &coupledMass_list, d_shell_dep, &left_edge,
+   &sx, &sy, &sz, &hx, &A);
 
 
   // copy deposited quantites to original fields
-  for (int i=0; i<size; i++){
+  for (int iz_ = izl; iz_ <= izu; iz_++) {
+    for (int iy_ = iyl; iy_ <= iyu; iy_++) {
+      for (int ix_ = ixl; ix_ <= ixu; ix_++) {
 
-    double d_old = d[i]; 
-    d[i] += d_dep[i];
-    double d_new = d[i];
+        const int i = INDEX(ix_,iy_,iz_,mx,my);
+        const int i_s = INDEX(ix_-ixl,iy_-iyl,iz_-izl,sx,sy);
 
-    double cell_mass = d_new*cell_volume_code;
-    double M_scale = d_new / d_old;
+        double d_old = d[i]; 
+        d[i] += d_dep[i_s];
+        double d_new = d[i];
 
-    mf[i] += mf_dep[i]; 
+        double cell_mass = d_new*cell_volume_code;
+        double M_scale = d_new / d_old;
 
-    // need to rescale specific energies to account for added mass
-    te[i] = te[i]/M_scale + te_dep[i] * cell_volume_code/cell_mass;
-    ge[i] = ge[i]/M_scale + ge_dep[i] * cell_volume_code/cell_mass;
-    vx[i] += vx_dep[i];
-    vy[i] += vy_dep[i];
-    vz[i] += vz_dep[i];
+        mf[i] += mf_dep[i_s]; 
+
+        // need to rescale specific energies to account for added mass
+        te[i] = te[i]/M_scale + te_dep[i_s] * cell_volume_code/cell_mass;
+        ge[i] = ge[i]/M_scale + ge_dep[i_s] * cell_volume_code/cell_mass;
+        vx[i] += vx_dep[i_s];
+        vy[i] += vy_dep[i_s];
+        vz[i] += vz_dep[i_s];
      
-    // Rescale color fields to account for new densities.
-    // Don't need to rescale metal_density because we already deposited
-    // into the metal_density field.
-
-    EnzoMethodStarMaker::rescale_densities(enzo_block, i, d_new/d_old);
-
-    // undo rescaling of metal_density
-    mf[i] /= (d_new/d_old);
-
-    // add deposited quantities to fields that track depositions
-    // of all star particles in the block this cycle
-     d_dep_tot[i] += d_dep[i];
-    mf_dep_tot[i] += mf_dep[i];
-    te_dep_tot[i] += te_dep[i];
-    ge_dep_tot[i] += ge_dep[i];
-    vx_dep_tot[i] += vx_dep[i];
-    vy_dep_tot[i] += vy_dep[i];
-    vz_dep_tot[i] += vz_dep[i];  
+        // Rescale color fields to account for new densities.
+        // Don't need to rescale metal_density because we already deposited
+        // into the metal_density field.
+
+        EnzoMethodStarMaker::rescale_densities(enzo_block, i, d_new/d_old);
+
+        // undo rescaling of metal_density
+        mf[i] /= (d_new/d_old);
+
+        // add deposited quantities to fields that track depositions
+        // of all star particles in the block this cycle
+         d_dep_tot[i] += d_dep[i_s];
+        mf_dep_tot[i] += mf_dep[i_s];
+        te_dep_tot[i] += te_dep[i_s];
+        ge_dep_tot[i] += ge_dep[i_s];
+        vx_dep_tot[i] += vx_dep[i_s];
+        vy_dep_tot[i] += vy_dep[i_s];
+        vz_dep_tot[i] += vz_dep[i_s];
+        d_shell[i]    += d_shell_dep[i_s];
+      }
+    }
   }
 
   // transform velocities back to "lab" frame
   // convert velocity (actually momentum density at the moment) field back to velocity 
-  this->transformComovingWithStar(d,vx,vy,vz,up,vp,wp,mx,my,mz, -1);
-  this->transformComovingWithStar(d_shell,vx_dep_tot,vy_dep_tot,vz_dep_tot,up,vp,wp,mx,my,mz, -1);
-
-  // clear temporary fields 
-  delete []  d_dep;
-  delete [] mf_dep;
-  delete [] te_dep;
-  delete [] ge_dep;
-  delete [] vx_dep;
-  delete [] vy_dep;
-  delete [] vz_dep;
+  this->transformComovingWithStar(d,vx,vy,vz,up,vp,wp,mx,my,
+                                  ixl,ixu,iyl,iyu,izl,izu, -1);
+  this->transformComovingWithStar(d_shell,vx_dep_tot,vy_dep_tot,vz_dep_tot,up,vp,wp,mx,my,
+                                  ixl,ixu,iyl,iyu,izl,izu, -1);
+
+  // temperature is no longer valid in this stencil
+  const int stencil[6] = {ixl,ixu,iyl,iyu,izl,izu};
+  history.stencils.insert(history.stencils.end(),stencil,stencil+6);
 }
 
 
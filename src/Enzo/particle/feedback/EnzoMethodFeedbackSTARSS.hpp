@@ -56,6 +56,17 @@ public:
    int determineWinds(double age_Myr, double * eWinds, double * mWinds, double * zWinds,
                       double mass_Msun, double metallicity_Zsun, double tunit, double dt); 
 
+   /// Cell ranges deposited into by feedback events on a block since
+   /// the temperature field was last computed.  Temperature is only
+   /// recomputed for an event whose host cell lies in one of them, so
+   /// that events on a block share a single temperature computation
+   struct DepositHistory {
+     DepositHistory() : temperature_valid(false), stencils() {}
+     bool temperature_valid;
+     /// inclusive bounds ixl,ixu,iyl,iyu,izl,izu of each stencil
+     std::vector<int> stencils;
+   };
+
    // this can raise errors -- remove const throw() ???
    void deposit_feedback (Block * block, 
                           double ejectaEnergy, double ejectaMass, double ejectaMetals,
@@ -63,12 +74,20 @@ public:
                           const enzo_float xp, const enzo_float yp, const enzo_float zp,
                           const int ix, const int iy, const int iz,
                           const int winds, const int nSNII, const int nSNIa,
-                          const double starZ) const throw();
+                          const double starZ,
+                          DepositHistory & history) const throw();
 
+   /// Transform velocities in the inclusive cell range
+   /// [ixl:ixu,iyl:iyu,izl:izu] to momentum densities comoving with the
+   /// star (direction > 0) or back (direction < 0)
    void transformComovingWithStar(enzo_float * density,
                                   enzo_float * velocity_x, enzo_float * velocity_y, enzo_float * velocity_z,
                                   const enzo_float up, const enzo_float vp, const enzo_float wp,
-                                  const int mx, const int my, const int mz, int direction) const throw();
+                                  const int mx, const int my,
+                                  const int ixl, const int ixu,
+                                  const int iyl, const int iyu,
+                                  const int izl, const int izu,
+                                  int direction) const throw();
 
    void add_accumulate_fields(EnzoBlock * enzo_block) throw();
 
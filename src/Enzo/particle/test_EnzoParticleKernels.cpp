@@ -0,0 +1,219 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_EnzoParticleKernels.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    Test program and micro-benchmark for vectorized particle
+///           kernels
+///
+/// Checks that the unit-stride kick-drift-kick kernel matches the strided
+/// loop used for interleaved particle types, and that the two-pass CIC
+/// deposit (serial, and through deposit_private()) matches the Fortran
+/// cic_deposit() routine.  The throughput of each is printed in millions
+/// of particles per second.
+
+#include "test.hpp"
+#include "main.hpp"
+#include "enzo.hpp"
+
+#define CK_TEMPLATES_ONLY
+#include "enzo.def.h"
+#undef CK_TEMPLATES_ONLY
+
+#ifndef FORTRAN_NAME
+#  define FORTRAN_NAME(NAME) NAME##_
+#endif
+
+extern "C" void FORTRAN_NAME(cic_deposit)
+  (enzo_float * posx, enzo_float * posy, enzo_float * posz,
+   const int * ndim, const int * npositions,
+   enzo_float * mass, enzo_float * field, enzo_float * leftedge,
+   int * dim1, int * dim2, int * dim3,
+   enzo_float * cellsize, enzo_float * cloudsize);
+
+// number of active cells along each axis
+const int N = 32;
+// ghost depth along each axis
+const int G = 3;
+// number of particles
+const int NP = 8*N*N*N;
+// number of particles per batch in deposit_private()
+const int NB = 4096;
+// number of times each kernel is evaluated
+const int NUM_REPEAT = 4;
+// millions of particles updated by each kernel, for reporting throughput
+const double MPARTICLES = 1e-6*NUM_REPEAT*NP;
+
+//----------------------------------------------------------------------
+
+static double max_err_ (const std::vector<enzo_float> & a,
+                        const std::vector<enzo_float> & b)
+{
+  double err = 0.0;
+  for (std::size_t i=0; i<a.size(); i++) {
+    err = std::max(err, (double) cello::err_abs(a[i],b[i]));
+  }
+  return err;
+}
+
+//----------------------------------------------------------------------
+
+static void test_kick_drift_kick_ ()
+{
+  unit_func ("kick_drift_kick()");
+
+  const int stride = 3;
+  std::vector<enzo_float> x(NP), v(NP), a(NP);
+  std::vector<enzo_float> xs(stride*NP), vs(stride*NP), as(stride*NP);
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<double> rand(-1.0,1.0);
+  for (int ip=0; ip<NP; ip++) {
+    x[ip] = xs[ip*stride] = rand(gen);
+    v[ip] = vs[ip*stride] = rand(gen);
+    a[ip] = as[ip*stride] = rand(gen);
+  }
+  const double cp = 0.01, cvv = 0.999, cva = 0.005;
+
+  Timer timer_soa;
+  timer_soa.start();
+  for (int i=0; i<NUM_REPEAT; i++) {
+    enzo_particle_kernels::kick_drift_kick
+      (x.data(),v.data(),a.data(),NP,cp,cvv,cva);
+  }
+  timer_soa.stop();
+
+  Timer timer_strided;
+  timer_strided.start();
+  for (int i=0; i<NUM_REPEAT; i++) {
+    for (int ip=0; ip<NP; ip++) {
+      const int k = ip*stride;
+      vs[k] = cvv*vs[k] + cva*as[k];
+      xs[k] += cp*vs[k];
+      vs[k] = cvv*vs[k] + cva*as[k];
+    }
+  }
+  timer_strided.stop();
+
+  const double tol = (sizeof(enzo_float) == 8) ? 1e-12 : 1e-5;
+  double err = 0.0;
+  for (int ip=0; ip<NP; ip++) {
+    err = std::max(err, (double) cello::err_abs(x[ip],xs[ip*stride]));
+    err = std::max(err, (double) cello::err_abs(v[ip],vs[ip*stride]));
+  }
+  unit_assert (err <= tol);
+
+  CkPrintf ("kick_drift_kick  Mparticles/s  strided: %7.2f  "
+            "unit stride: %7.2f\n",
+            unit_rate(MPARTICLES,timer_strided),
+            unit_rate(MPARTICLES,timer_soa));
+}
+
+//----------------------------------------------------------------------
+
+static void test_cic_deposit_ ()
+{
+  unit_func ("cic_deposit()");
+
+  int mx = N + 2*G, my = N + 2*G, mz = N + 2*G;
+  const int m = mx*my*mz;
+  const double xm = 0.0, ym = 0.0, zm = 0.0;
+  enzo_float h = 1.0 / N;
+
+  // particles are kept away from the block edge, where the Fortran
+  // routine clamps positions
+  std::vector<enzo_float> x(NP), y(NP), z(NP), mass(NP), zero(NP,0.0);
+  std::mt19937 gen(2);
+  std::uniform_real_distribution<double> rand_x(0.0,1.0);
+  std::uniform_real_distribution<double> rand_m(0.5,1.5);
+  for (int ip=0; ip<NP; ip++) {
+    x[ip] = rand_x(gen);
+    y[ip] = rand_x(gen);
+    z[ip] = rand_x(gen);
+    mass[ip] = rand_m(gen);
+  }
+
+  // reference deposit using cic_deposit.F
+
+  std::vector<enzo_float> de_ref(m,0.0);
+  enzo_float left_edge[3] = {enzo_float(xm-G*h),
+                             enzo_float(ym-G*h),
+                             enzo_float(zm-G*h)};
+  const int rank = 3;
+  const int np = NP;
+  Timer timer_fortran;
+  timer_fortran.start();
+  for (int i=0; i<NUM_REPEAT; i++) {
+    std::fill(de_ref.begin(),de_ref.end(),0.0);
+    FORTRAN_NAME(cic_deposit)
+      (x.data(),y.data(),z.data(),&rank,&np,mass.data(),de_ref.data(),
+       left_edge,&mx,&my,&mz,&h,&h);
+  }
+  timer_fortran.stop();
+
+  // two-pass deposit of all particles
+
+  std::vector<enzo_float> de(m,0.0);
+  Timer timer_serial;
+  timer_serial.start();
+  for (int i=0; i<NUM_REPEAT; i++) {
+    std::fill(de.begin(),de.end(),0.0);
+    enzo_particle_kernels::cic_deposit<3>
+      (de.data(),mx,my, x.data(),y.data(),z.data(),
+       zero.data(),zero.data(),zero.data(), 0.0,
+       mass.data(),1,1.0,NP, xm,ym,zm, N,N,N, G,G,G);
+  }
+  timer_serial.stop();
+
+  const double tol = (sizeof(enzo_float) == 8) ? 1e-10 : 1e-3;
+  unit_assert (max_err_(de,de_ref) <= tol);
+
+  // batched deposit using private arrays per thread
+
+  const int num_batches = (NP + NB - 1) / NB;
+  auto deposit_batch = [&](int ib, enzo_float * g)
+    {
+      const int ip = ib*NB;
+      enzo_particle_kernels::cic_deposit<3>
+        (g,mx,my, &x[ip],&y[ip],&z[ip],
+         &zero[ip],&zero[ip],&zero[ip], 0.0,
+         &mass[ip],1,1.0,std::min(NB,NP-ip), xm,ym,zm, N,N,N, G,G,G);
+    };
+  Timer timer_private;
+  timer_private.start();
+  for (int i=0; i<NUM_REPEAT; i++) {
+    std::fill(de.begin(),de.end(),0.0);
+    enzo_particle_kernels::deposit_private
+      (de.data(),m,num_batches,deposit_batch);
+  }
+  timer_private.stop();
+
+  unit_assert (max_err_(de,de_ref) <= tol);
+
+  CkPrintf ("cic_deposit  Mparticles/s  Fortran: %7.2f  two-pass: %7.2f  "
+            "private (%d threads): %7.2f\n",
+            unit_rate(MPARTICLES,timer_fortran),
+            unit_rate(MPARTICLES,timer_serial),
+            ParallelFor::num_threads(),
+            unit_rate(MPARTICLES,timer_private));
+}
+
+//----------------------------------------------------------------------
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class ("EnzoParticleKernels");
+
+  test_kick_drift_kick_();
+  test_cic_deposit_();
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END